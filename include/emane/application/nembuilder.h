@@ -39,6 +39,7 @@
 #include "emane/application/nem.h"
 #include "emane/nemlayer.h"
 #include "emane/maclayerimpl.h"
+#include "emane/transport.h"
 #include "emane/radioserviceprovider.h"
 
 #include "emane/configurationupdate.h"
@@ -188,6 +189,50 @@ namespace EMANE
                           const ConfigurationUpdateRequest & request,
                           bool bSkipConfigure = false);
 
+      /**
+       * Builds a Transport layer from template.
+       *
+       * @tparam T Transport derived implementation
+       *
+       * @param id id of the NEM that will contain the transport
+       * @param sRegistrationName Registration name
+       * @param request Configuration update request
+       * @param bSkipConfigure Flag indicating whether to skip
+       * calling Component::configure
+       *
+       * @return std::pair with first being a borrowed reference to
+       * the newly created transport and second being a
+       * unique_ptr<NEMLayer> that should be added (moved)
+       * to an NEM layers list.
+       *
+       * @throw InitializeException when an error occurs during
+       * initialization.
+       * @throw ConfigureException when an error occurs during
+       * configure.
+       */
+      template<typename T, typename... Args>
+      std::pair<T *, std::unique_ptr<EMANE::NEMLayer>>
+      buildTransportLayer_T(NEMId id,
+                            const std::string & sRegistrationName,
+                            const ConfigurationUpdateRequest & request,
+                            bool bSkipConfigure,
+                            Args&&... args);
+
+      /**
+       * Configures a layer that was built with bSkipConfigure set
+       *
+       * @param layer Layer to configure
+       * @param request Configuration update request
+       *
+       * @throw ConfigureException when an error occurs during
+       * configure.
+       *
+       * @note Layers belonging to different NEMs may be configured
+       * concurrently.
+       */
+      void configureLayer(NEMLayer & layer,
+                          const ConfigurationUpdateRequest & request);
+
 
       /**
        * Builds an NEM
@@ -246,6 +291,14 @@ namespace EMANE
                       const ConfigurationUpdateRequest & request,
                       bool bSkipConfigure);
 
+      std::unique_ptr<NEMLayer>
+      buildTransportLayer_i(Transport * pImpl,
+                            PlatformServiceProvider * pProvider,
+                            NEMId id,
+                            const std::string & sLibraryFile,
+                            const ConfigurationUpdateRequest & request,
+                            bool bSkipConfigure);
+
       RadioServiceProvider * createRadioService(NEMId id);
 
       PlatformServiceProvider * createPlatformService();
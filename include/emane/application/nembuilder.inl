@@ -54,3 +54,25 @@ EMANE::Application::NEMBuilder::buildMACLayer_T(NEMId id,
                                     request,
                                     bSkipConfigure)};
 }
+
+template<typename T, typename... Args>
+std::pair<T *, std::unique_ptr<EMANE::NEMLayer>>
+EMANE::Application::NEMBuilder::buildTransportLayer_T(NEMId id,
+                                                      const std::string & sRegistrationName,
+                                                      const ConfigurationUpdateRequest & request,
+                                                      bool bSkipConfigure,
+                                                      Args&&... args)
+{
+  // new platform service
+  PlatformServiceProvider * pPlatformService{createPlatformService()};
+
+  // create the transport
+  T * pTransport{new T(id,pPlatformService,std::forward<Args>(args)...)};
+
+  return {pTransport,buildTransportLayer_i(pTransport,
+                                           pPlatformService,
+                                           id,
+                                           sRegistrationName,
+                                           request,
+                                           bSkipConfigure)};
+}
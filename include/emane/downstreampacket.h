@@ -64,6 +64,17 @@ namespace EMANE
      */
     DownstreamPacket(const PacketInfo & info, const void * buf, size_t size);
 
+    /**
+     * Creates a DownstreamPacket instance from a Utils::VectorIO
+     *
+     * @param info The PacketInfo to use
+     * @param vectorIO Vectored IO object
+     *
+     * @note A deep copy is performed and the internal packet data
+     * is stored contiguously
+     */
+    DownstreamPacket(const PacketInfo & info, const Utils::VectorIO & vectorIO);
+
     /**
      * Creates a DownstreamPacket instance by copying another instance
      */
@@ -142,6 +153,17 @@ namespace EMANE
      */
     const PacketInfo & getPacketInfo() const;
 
+    /**
+     * Records a latency trace stamp. Trace stamps are local to this
+     * packet instance and its copies, they are never transmitted.
+     *
+     * @param now Time of the stamp
+     *
+     * @return Time elapsed since the previous stamp or, for the
+     * first stamp, since the packet creation time
+     */
+    Microseconds stampTrace(const TimePoint & now);
+
     /**
      * Attach an event to the packet.
      *
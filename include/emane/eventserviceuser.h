@@ -37,8 +37,12 @@
 #include "emane/types.h"
 #include "emane/serializable.h"
 
+#include <memory>
+
 namespace EMANE
 {
+  class Event;
+
   /**
    * @class EventServiceUser
    *
@@ -62,6 +66,27 @@ namespace EMANE
       (void) serialization;
     };
 
+    /**
+     * Process an event that has already been decoded by the event
+     * service. The decoded event is shared by every event service
+     * user on the platform and must not be modified.
+     *
+     * @param eventId event identifier corresponding to the event
+     * @param pEvent decoded event, whose type is determined by the
+     * decoder registered for @a eventId
+     * @param serialization opaque event object data
+     *
+     * @note Default implementation processes the serialization
+     * using processEvent(). Override to opt in to decoded delivery.
+     */
+    virtual void processDecodedEvent(const EventId & eventId,
+                                     const std::shared_ptr<const Event> & pEvent,
+                                     const Serialization & serialization)
+    {
+      (void) pEvent;
+      processEvent(eventId,serialization);
+    };
+
   protected:
     EventServiceUser(){}
   };
@@ -37,6 +37,7 @@
 #include "emane/utils/vectorio.h"
 
 #include <list>
+#include <memory>
 #include <vector>
 
 namespace EMANE
@@ -110,13 +111,76 @@ namespace EMANE
                          std::uint64_t u64FragmentSequence,
                          bool bMore);
 
+        /**
+         * Creates a component representing a complete message that
+         * references its data instead of copying it
+         *
+         * @param type Type of component
+         * @param destination NEM destination
+         * @param priority Message priority
+         * @param vectorIO Scatter-Gather component data
+         * @param pStorage Owner of the memory referenced by @a vectorIO,
+         * held for the lifetime of the component
+         */
+        MessageComponent(Type type,
+                         NEMId destination,
+                         Priority priority,
+                         const Utils::VectorIO & vectorIO,
+                         std::shared_ptr<const void> pStorage);
+
+        /**
+         * Creates a component representing a message fragment that
+         * references its data instead of copying it
+         *
+         * @param type Type of component
+         * @param destination NEM destination
+         * @param priority Message priority
+         * @param vectorIO Scatter-Gather component data
+         * @param fragmentIndex Fragment index
+         * @param fragmentOffset Fragment byte offset
+         * @param u64FragmentSequence Fragment sequence number
+         * @param bMore Flag indicating if more fragment(s) follow
+         * @param pStorage Owner of the memory referenced by @a vectorIO,
+         * held for the lifetime of the component
+         */
+        MessageComponent(Type type,
+                         NEMId destination,
+                         Priority priority,
+                         const Utils::VectorIO & vectorIO,
+                         size_t fragmentIndex,
+                         size_t fragmentOffset,
+                         std::uint64_t u64FragmentSequence,
+                         bool bMore,
+                         std::shared_ptr<const void> pStorage);
+
         /**
          * Gets the component data
          *
          * @return Component data reference
+         *
+         * @note A component referencing its data copies it into
+         * contiguous storage on first call. Use getVectorIO() to
+         * access the data without a copy.
          */
         const Data & getData() const;
 
+        /**
+         * Gets the component data as a Scatter-Gather list
+         *
+         * @return Vectored IO referencing the component data
+         *
+         * @note Component data is not copied and is valid for the
+         * lifetime of the component.
+         */
+        Utils::VectorIO getVectorIO() const;
+
+        /**
+         * Gets the component data size
+         *
+         * @return size in bytes
+         */
+        size_t getDataSize() const;
+
         /**
          * Gets the destination
          *
@@ -177,7 +241,10 @@ namespace EMANE
         Type type_;
         NEMId destination_;
         Priority priority_;
-        Data data_;
+        mutable Data data_;
+        std::shared_ptr<const void> pStorage_;
+        Utils::VectorIO vectorIO_;
+        size_t dataSize_;
         size_t fragmentIndex_;
         size_t fragmentOffset_;
         bool bMoreFragments_;
@@ -38,6 +38,9 @@ EMANE::Models::TDMA::MessageComponent::MessageComponent(Type type,
   type_{type},
   destination_{destination},
   priority_{priority},
+  pStorage_{},
+  vectorIO_{},
+  dataSize_{},
   fragmentIndex_{},
   fragmentOffset_{},
   bMoreFragments_{},
@@ -49,6 +52,8 @@ EMANE::Models::TDMA::MessageComponent::MessageComponent(Type type,
                    reinterpret_cast<std::uint8_t*>(entry.iov_base),
                    reinterpret_cast<std::uint8_t*>(entry.iov_base) + entry.iov_len);
     }
+
+  dataSize_ = data_.size();
 }
 
 inline
@@ -63,6 +68,9 @@ EMANE::Models::TDMA::MessageComponent::MessageComponent(Type type,
   type_{type},
   destination_{destination},
   priority_{priority},
+  pStorage_{},
+  vectorIO_{},
+  dataSize_{},
   fragmentIndex_{fragmentIndex},
   fragmentOffset_{fragmentOffset},
   bMoreFragments_{bMore},
@@ -74,15 +82,91 @@ EMANE::Models::TDMA::MessageComponent::MessageComponent(Type type,
                    reinterpret_cast<std::uint8_t*>(entry.iov_base),
                    reinterpret_cast<std::uint8_t*>(entry.iov_base) + entry.iov_len);
     }
+
+  dataSize_ = data_.size();
+}
+
+inline
+EMANE::Models::TDMA::MessageComponent::MessageComponent(Type type,
+                                                        NEMId destination,
+                                                        Priority priority,
+                                                        const Utils::VectorIO & vectorIO,
+                                                        std::shared_ptr<const void> pStorage):
+  MessageComponent{type,
+    destination,
+    priority,
+    vectorIO,
+    0,
+    0,
+    0,
+    false,
+    std::move(pStorage)}{}
+
+inline
+EMANE::Models::TDMA::MessageComponent::MessageComponent(Type type,
+                                                        NEMId destination,
+                                                        Priority priority,
+                                                        const Utils::VectorIO & vectorIO,
+                                                        size_t fragmentIndex,
+                                                        size_t fragmentOffset,
+                                                        std::uint64_t u64FragmentSequence,
+                                                        bool bMore,
+                                                        std::shared_ptr<const void> pStorage):
+  type_{type},
+  destination_{destination},
+  priority_{priority},
+  pStorage_{std::move(pStorage)},
+  vectorIO_{vectorIO},
+  dataSize_{},
+  fragmentIndex_{fragmentIndex},
+  fragmentOffset_{fragmentOffset},
+  bMoreFragments_{bMore},
+  u64FragmentSequence_{u64FragmentSequence}
+{
+  for(const auto & entry : vectorIO_)
+    {
+      dataSize_ += entry.iov_len;
+    }
 }
 
 inline
 const EMANE::Models::TDMA::MessageComponent::Data &
 EMANE::Models::TDMA::MessageComponent::getData() const
 {
+  // referenced data is made contiguous on first access
+  if(pStorage_ && data_.size() != dataSize_)
+    {
+      data_.reserve(dataSize_);
+
+      for(const auto & entry : vectorIO_)
+        {
+          data_.insert(data_.end(),
+                       reinterpret_cast<std::uint8_t*>(entry.iov_base),
+                       reinterpret_cast<std::uint8_t*>(entry.iov_base) + entry.iov_len);
+        }
+    }
+
   return data_;
 }
 
+inline
+EMANE::Utils::VectorIO
+EMANE::Models::TDMA::MessageComponent::getVectorIO() const
+{
+  if(pStorage_)
+    {
+      return vectorIO_;
+    }
+
+  return {Utils::make_iovec(data_.data(),data_.size())};
+}
+
+inline
+size_t EMANE::Models::TDMA::MessageComponent::getDataSize() const
+{
+  return dataSize_;
+}
+
 inline
 NEMId EMANE::Models::TDMA::MessageComponent::getDestination() const
 {
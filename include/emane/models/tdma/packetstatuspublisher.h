@@ -82,7 +82,10 @@ namespace EMANE
           ACCEPT_GOOD, /**< Accepted and sent downstream */
           DROP_TOO_BIG, /**< Dropped too big and fragmentation disabled */
           DROP_OVERFLOW, /**< Dropped queue overflow */
-          DROP_FLOW_CONTROL /**< Dropped flow control error */
+          DROP_FLOW_CONTROL, /**< Dropped flow control error */
+          DROP_TX_PREPARED /**< Dropped after dequeue, prepared transmission
+                              discarded before its slot. Reverses the bytes
+                              previously accepted. */
          };
 
         /**
@@ -44,11 +44,21 @@ inline
 void EMANE::PHYLayerImplementor::processUpstreamPacket(UpstreamPacket & pkt,
                                                        const ControlMessages & msgs)
 {
-  CommonPHYHeader hdr(pkt);
-  
-  processUpstreamPacket(hdr,
-                        pkt, 
-                        msgs);
+  // use the header decoded once for all local NEMs when available
+  if(auto pCommonPHYHeader = pkt.stripCommonPHYHeader())
+    {
+      processUpstreamPacket(*pCommonPHYHeader,
+                            pkt,
+                            msgs);
+    }
+  else
+    {
+      CommonPHYHeader hdr(pkt);
+
+      processUpstreamPacket(hdr,
+                            pkt,
+                            msgs);
+    }
 }
 
 inline
@@ -39,6 +39,7 @@
 #include <set>
 #include <vector>
 #include <tuple>
+#include <exception>
 
 namespace EMANE
 {
@@ -66,6 +67,26 @@ namespace EMANE
                                     double,
                                     bool>;
 
+  /**
+   * Spectrum window request parameters, see
+   * SpectrumServiceProvider::request
+   */
+  struct SpectrumWindowRequest
+  {
+    std::uint64_t u64FrequencyHz_; /**< Frequency to query */
+    Microseconds duration_; /**< Request duration */
+    TimePoint startTime_; /**< Request start time */
+  };
+
+  /**
+   * Spectrum window request result
+   *
+   * @param SpectrumWindow The spectrum window, empty on error
+   * @param std::exception_ptr The SpectrumServiceException raised by
+   * the request or null
+   */
+  using SpectrumWindowResult = std::pair<SpectrumWindow,std::exception_ptr>;
+
   /**
    * Spectrum filter window snapshot
    *
@@ -165,6 +186,45 @@ namespace EMANE
                                    const TimePoint & startTime = TimePoint::min()) const = 0;
 
 
+    /**
+     * Gets spectrum windows for a batch of requests on the default
+     * antenna. Each request is handled as by a single request.
+     *
+     * @param requests Spectrum window requests
+     *
+     * @return Results in request order. A request that violates the
+     * preconditions of a single request holds its exception instead
+     * of a window.
+     *
+     * @note The default implementation issues one single request per
+     * entry. The FrameworkPHY overrides it to use the same @c now and
+     * take the service locks once for the batch.
+     */
+    virtual std::vector<SpectrumWindowResult>
+    request(const std::vector<SpectrumWindowRequest> & requests) const
+    {
+      std::vector<SpectrumWindowResult> results{};
+
+      results.reserve(requests.size());
+
+      for(const auto & windowRequest : requests)
+        {
+          try
+            {
+              results.emplace_back(request(windowRequest.u64FrequencyHz_,
+                                           windowRequest.duration_,
+                                           windowRequest.startTime_),
+                                   nullptr);
+            }
+          catch(...)
+            {
+              results.emplace_back(SpectrumWindow{},std::current_exception());
+            }
+        }
+
+      return results;
+    }
+
     virtual SpectrumWindow requestAntenna(AntennaIndex antennaIndex,
                                           std::uint64_t u64FrequencyHz,
                                           const Microseconds & duration = Microseconds::zero(),
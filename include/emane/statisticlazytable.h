@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANESTATISTICLAZYTABLE_HEADER_
+#define EMANESTATISTICLAZYTABLE_HEADER_
+
+#include "emane/statistictablepublisher.h"
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <functional>
+
+namespace EMANE
+{
+  class StatisticRegistrar;
+
+  /**
+   * @class StatisticLazyTable
+   *
+   * @brief A two dimentional statistic table that holds compact
+   * per row values and only builds Any rows when the table is
+   * queried.
+   *
+   * Updating a row copies or modifies a Row value in place. No Any
+   * values are constructed on the update path.
+   *
+   * @tparam Key Type of the keys. Each row in the table is uniquely
+   *  identified by its key value
+   * @tparam Row Type of the row values
+   * @tparam Compare A binary predicate that takes two element
+   *  keys as arguments and returns a bool
+   * @tparam scolumn The column used when sorting the table using
+   *  Compare
+   */
+  template<typename Key,
+           typename Row,
+           typename Compare = std::less<EMANE::Any>,
+           std::size_t sortIndex = 0>
+  class StatisticLazyTable : public StatisticTablePublisher
+  {
+  public:
+    /**
+     * Function used to build the Any column values of a row
+     */
+    using Materializer = std::function<std::vector<Any>(const Key &, const Row &)>;
+
+    /**
+     * Destroys an instance
+     */
+    ~StatisticLazyTable();
+
+    /**
+     * Sets a row, adding it if not present
+     *
+     * @param key Table row key
+     * @param row Row value
+     */
+    void setRow(const Key & key, const Row & row);
+
+    /**
+     * Modifies a row in place, adding a value initialized row if
+     * not present
+     *
+     * @param key Table row key
+     * @param f Function taking a Row reference
+     */
+    template<typename Function>
+    void updateRow(const Key & key, Function f);
+
+    /**
+     * Deletes a row from the table
+     *
+     * @param key Table row key
+     */
+    void deleteRow(const Key & key);
+
+    StatisticTableLabels getLabels() const override;
+
+    StatisticTableValues getValues() const override;
+
+    void clear() override;
+
+  private:
+    using InternalTable = std::unordered_map<Key,Row>;
+    InternalTable table_;
+    mutable std::mutex mutex_;
+    const StatisticTableLabels labels_;
+    Materializer materializer_;
+
+    StatisticLazyTable(const StatisticTableLabels & labels,
+                       Materializer materializer);
+
+    friend StatisticRegistrar;
+  };
+}
+
+#include "emane/statisticlazytable.inl"
+
+#endif // EMANESTATISTICLAZYTABLE_HEADER_
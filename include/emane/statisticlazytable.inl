@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "emane/statistictableexception.h"
+#include <algorithm>
+
+template<typename Key,typename Row,typename Compare,std::size_t sortIndex>
+EMANE::StatisticLazyTable<Key,Row,Compare,sortIndex>::StatisticLazyTable(const StatisticTableLabels & labels,
+                                                                         Materializer materializer):
+  labels_{labels},
+  materializer_{materializer}{}
+
+template<typename Key,typename Row,typename Compare,std::size_t sortIndex>
+EMANE::StatisticLazyTable<Key,Row,Compare,sortIndex>::~StatisticLazyTable(){}
+
+template<typename Key,typename Row,typename Compare,std::size_t sortIndex>
+void EMANE::StatisticLazyTable<Key,Row,Compare,sortIndex>::setRow(const Key & key,
+                                                                  const Row & row)
+{
+  std::lock_guard<std::mutex> m(mutex_);
+
+  table_[key] = row;
+}
+
+template<typename Key,typename Row,typename Compare,std::size_t sortIndex>
+template<typename Function>
+void EMANE::StatisticLazyTable<Key,Row,Compare,sortIndex>::updateRow(const Key & key,
+                                                                     Function f)
+{
+  std::lock_guard<std::mutex> m(mutex_);
+
+  f(table_[key]);
+}
+
+template<typename Key,typename Row,typename Compare,std::size_t sortIndex>
+void EMANE::StatisticLazyTable<Key,Row,Compare,sortIndex>::deleteRow(const Key & key)
+{
+  std::lock_guard<std::mutex> m(mutex_);
+
+  table_.erase(key);
+}
+
+template<typename Key,typename Row,typename Compare,std::size_t sortIndex>
+EMANE::StatisticTableValues
+EMANE::StatisticLazyTable<Key,Row,Compare,sortIndex>::getValues() const
+{
+  InternalTable table{};
+
+  // lock guard block scope, only the compact rows are copied while
+  // holding the lock
+  {
+    std::lock_guard<std::mutex> m(mutex_);
+
+    table = table_;
+  }
+
+  StatisticTableValues values{};
+
+  values.reserve(table.size());
+
+  for(const auto & entry : table)
+    {
+      values.push_back(materializer_(entry.first,entry.second));
+
+      if(values.back().size() != labels_.size())
+        {
+          throw makeException<StatisticTableException>("column count not valid: %zu",
+                                                       values.back().size());
+        }
+    }
+
+  Compare cmp{};
+  std::sort(values.begin(),
+            values.end(),
+            [&cmp](const std::vector<Any> & a1,
+                   const std::vector<Any> & a2)
+            {
+              return cmp(a1[sortIndex],a2[sortIndex]);
+            });
+
+  return values;
+}
+
+template<typename Key,typename Row,typename Compare,std::size_t sortIndex>
+EMANE::StatisticTableLabels
+EMANE::StatisticLazyTable<Key,Row,Compare,sortIndex>::getLabels() const
+{
+  // labels_ is immutable - no synchronization required
+  return labels_;
+}
+
+template<typename Key,typename Row,typename Compare,std::size_t sortIndex>
+void
+EMANE::StatisticLazyTable<Key,Row,Compare,sortIndex>::clear()
+{
+  std::lock_guard<std::mutex> m(mutex_);
+  table_.clear();
+}
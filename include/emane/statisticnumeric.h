@@ -36,7 +36,9 @@
 
 #include "emane/statistic.h"
 
+#include <atomic>
 #include <mutex>
+#include <type_traits>
 
 namespace EMANE
 {
@@ -48,6 +50,10 @@ namespace EMANE
    *
    * @brief Defines a numeric statistic and its operations
    *
+   * Integral statistics are stored in a relaxed atomic so hot path
+   * updates and control port reads never contend on a lock. Other
+   * types are guarded by a mutex. get() and asAny() are the read
+   * API used by the StatisticService.
    */
   template<typename T>
   class StatisticNumeric : public Statistic
@@ -143,11 +149,34 @@ namespace EMANE
                            const T & alternate);
 
   private:
-    T value_;    
-    mutable std::mutex mutex_;
+    static constexpr bool isAtomic_ =
+      std::is_integral<T>::value && !std::is_same<T,bool>::value;
+
+    // integral values are atomic and need no lock
+    template<bool Atomic,typename Unused = void>
+    struct Storage
+    {
+      T value_;
+      mutable std::mutex mutex_;
+    };
+
+    template<typename Unused>
+    struct Storage<true,Unused>
+    {
+      std::atomic<T> value_;
+    };
+
+    Storage<isAtomic_> storage_;
 
     StatisticNumeric();
 
+    T load() const;
+
+    void store(const T & value);
+
+    template<typename Function>
+    T apply(Function f);
+
     friend StatisticRegistrar;
   };
 } 
@@ -33,61 +33,104 @@
 
 template<typename T>
 EMANE::StatisticNumeric<T>::StatisticNumeric():
-  value_{}{}
+  storage_{}{}
 
 template<typename T>
 EMANE::StatisticNumeric<T>::~StatisticNumeric(){}
 
+template<typename T>
+T EMANE::StatisticNumeric<T>::load() const
+{
+  if constexpr(isAtomic_)
+    {
+      return storage_.value_.load(std::memory_order_relaxed);
+    }
+  else
+    {
+      std::lock_guard<std::mutex> m(storage_.mutex_);
+
+      return storage_.value_;
+    }
+}
+
+template<typename T>
+void EMANE::StatisticNumeric<T>::store(const T & value)
+{
+  if constexpr(isAtomic_)
+    {
+      storage_.value_.store(value,std::memory_order_relaxed);
+    }
+  else
+    {
+      std::lock_guard<std::mutex> m(storage_.mutex_);
+
+      storage_.value_ = value;
+    }
+}
+
+template<typename T>
+template<typename Function>
+T EMANE::StatisticNumeric<T>::apply(Function f)
+{
+  if constexpr(isAtomic_)
+    {
+      T current{storage_.value_.load(std::memory_order_relaxed)};
+
+      while(!storage_.value_.compare_exchange_weak(current,
+                                          f(current),
+                                          std::memory_order_relaxed));
+
+      return current;
+    }
+  else
+    {
+      std::lock_guard<std::mutex> m(storage_.mutex_);
+
+      T tmp{storage_.value_};
+
+      storage_.value_ = f(storage_.value_);
+
+      return tmp;
+    }
+}
+
 template<typename T>
 EMANE::StatisticNumeric<T> & EMANE::StatisticNumeric<T>::operator++()
 {
-  std::lock_guard<std::mutex> m(mutex_);
-  
-  ++value_;
-  
+  operator+=(T{1});
+
   return *this;
 }
 
 template<typename T>
 const T EMANE::StatisticNumeric<T>::operator++(int)
 {
-  std::lock_guard<std::mutex> m(mutex_);
-  
-  T tmp{value_};
-      
-  ++value_;
-
-  return tmp;
+  if constexpr(isAtomic_)
+    {
+      return storage_.value_.fetch_add(1,std::memory_order_relaxed);
+    }
+  else
+    {
+      return apply([](const T & value){return value + 1;});
+    }
 }
 
 template<typename T>
 EMANE::StatisticNumeric<T> & EMANE::StatisticNumeric<T>::operator+=(const EMANE::StatisticNumeric<T> & rhs)
 {
-  std::lock_guard<std::mutex> m(mutex_);
-  
-  value_ += rhs.value_;
-  
-  return *this;
+  return operator+=(rhs.load());
 }
 
 template<typename T>
 const T EMANE::StatisticNumeric<T>::operator+(const EMANE::StatisticNumeric<T> & rhs) const
 {
-  std::lock_guard<std::mutex> m(mutex_);
-
-  T tmp{value_};
-      
-  tmp += rhs;
-
-  return tmp;
+  return load() + rhs.load();
 }
 
 template<typename T>
 EMANE::StatisticNumeric<T> & EMANE::StatisticNumeric<T>::operator--()
 {
-  std::lock_guard<std::mutex> m(mutex_);
-
-  --value_;
+  operator-=(T{1});
 
   return *this;
 }
@@ -95,87 +138,56 @@ EMANE::StatisticNumeric<T> & EMANE::StatisticNumeric<T>::operator--()
 template<typename T>
 const T EMANE::StatisticNumeric<T>::operator--(int)
 {
-  std::lock_guard<std::mutex> m(mutex_);
-
-  T tmp{value_};
-
-  --value_;
-
-  return tmp;
+  if constexpr(isAtomic_)
+    {
+      return storage_.value_.fetch_sub(1,std::memory_order_relaxed);
+    }
+  else
+    {
+      return apply([](const T & value){return value - 1;});
+    }
 }
 
 template<typename T>
 const T EMANE::StatisticNumeric<T>::operator-(const EMANE::StatisticNumeric<T> & rhs) const
 {
-  std::lock_guard<std::mutex> m(mutex_);
-
-  T tmp{value_};
-      
-  tmp -= rhs;
-  
-  return tmp;
+  return load() - rhs.load();
 }
 
 template<typename T>
 EMANE::StatisticNumeric<T> & EMANE::StatisticNumeric<T>::operator-=(const EMANE::StatisticNumeric<T> & rhs)
 {
-  std::lock_guard<std::mutex> m(mutex_);
-
-  value_ -= rhs.value_;
-
-  return *this;
+  return operator-=(rhs.load());
 }
 
 template<typename T>
 const T EMANE::StatisticNumeric<T>::operator*(const EMANE::StatisticNumeric<T> & rhs) const
 {
-  std::lock_guard<std::mutex> m(mutex_);
-
-  T tmp{value_};
-
-  tmp *= rhs;
-
-  return tmp;
+  return load() * rhs.load();
 }
 
 template<typename T>
 EMANE::StatisticNumeric<T> & EMANE::StatisticNumeric<T>::operator*=(const EMANE::StatisticNumeric<T> & rhs)
 {
-  std::lock_guard<std::mutex> m(mutex_);
-      
-  value_ *= rhs.value_;
-      
-  return *this;
+  return operator*=(rhs.load());
 }
 
 template<typename T>
 const T EMANE::StatisticNumeric<T>::operator/(const EMANE::StatisticNumeric<T> & rhs) const
 {
-  std::lock_guard<std::mutex> m(mutex_);
-
-  T tmp{value_};
-      
-  tmp /= rhs;
-      
-  return tmp;
+  return load() / rhs.load();
 }
 
 template<typename T>
 EMANE::StatisticNumeric<T> & EMANE::StatisticNumeric<T>::operator/=(const EMANE::StatisticNumeric<T> & rhs)
 {
-  std::lock_guard<std::mutex> m(mutex_);
-      
-  value_ /= rhs.value_;
-      
-  return *this;
+  return operator/=(rhs.load());
 }
 
 template<typename T>
 EMANE::StatisticNumeric<T> & EMANE::StatisticNumeric<T>::operator=(const EMANE::StatisticNumeric<T> & rhs)
 {
-  std::lock_guard<std::mutex> m(mutex_);
-            
-  value_ = rhs.value_;
+  store(rhs.load());
 
   return *this;
 }
@@ -183,9 +195,14 @@ EMANE::StatisticNumeric<T> & EMANE::StatisticNumeric<T>::operator=(const EMANE::
 template<typename T>
 EMANE::StatisticNumeric<T> & EMANE::StatisticNumeric<T>::operator+=(const T & rhs)
 {
-  std::lock_guard<std::mutex> m(mutex_);
-  
-  value_ += rhs;
+  if constexpr(isAtomic_)
+    {
+      storage_.value_.fetch_add(rhs,std::memory_order_relaxed);
+    }
+  else
+    {
+      apply([&rhs](const T & value){return value + rhs;});
+    }
 
   return *this;
 }
@@ -193,26 +210,27 @@ EMANE::StatisticNumeric<T> & EMANE::StatisticNumeric<T>::operator+=(const T & rh
 template<typename T>   
 T EMANE::StatisticNumeric<T>::operator+(const T & rhs) const
 {
-  std::lock_guard<std::mutex> m(mutex_);
-  
-  return value_ + rhs;
+  return load() + rhs;
 }
 
 
 template<typename T>
 T EMANE::StatisticNumeric<T>::operator-(const T & rhs) const
 {
-  std::lock_guard<std::mutex> m(mutex_);
-  
-  return value_ - rhs;
+  return load() - rhs;
 }
 
 template<typename T>
 EMANE::StatisticNumeric<T> & EMANE::StatisticNumeric<T>::operator-=(const T & rhs)
 {
-  std::lock_guard<std::mutex> m(mutex_);
-  
-  value_-= rhs;
+  if constexpr(isAtomic_)
+    {
+      storage_.value_.fetch_sub(rhs,std::memory_order_relaxed);
+    }
+  else
+    {
+      apply([&rhs](const T & value){return value - rhs;});
+    }
 
   return *this;
 }
@@ -220,17 +238,13 @@ EMANE::StatisticNumeric<T> & EMANE::StatisticNumeric<T>::operator-=(const T & rh
 template<typename T>
 T EMANE::StatisticNumeric<T>::operator*(const T & rhs) const
 {
-  std::lock_guard<std::mutex> m(mutex_);
-
-  return value_ * rhs;
+  return load() * rhs;
 }
 
 template<typename T>
 EMANE::StatisticNumeric<T> & EMANE::StatisticNumeric<T>::operator*=(const T & rhs)
 {
-  std::lock_guard<std::mutex> m(mutex_);
-
-  value_ *= rhs;
+  apply([&rhs](const T & value){return value * rhs;});
 
   return *this;
 }
@@ -238,18 +252,14 @@ EMANE::StatisticNumeric<T> & EMANE::StatisticNumeric<T>::operator*=(const T & rh
 template<typename T>
 T  EMANE::StatisticNumeric<T>::operator/(const T & rhs) const
 {
-  std::lock_guard<std::mutex> m(mutex_);
-  
-  return value_ / rhs;
+  return load() / rhs;
 }
 
 template<typename T>
 EMANE::StatisticNumeric<T> & EMANE::StatisticNumeric<T>::operator/=(const T & rhs)
 {
-  std::lock_guard<std::mutex> m(mutex_);
-  
-  value_ /= rhs;
-  
+  apply([&rhs](const T & value){return value / rhs;});
+
   return *this;
 }
 
@@ -257,9 +267,7 @@ EMANE::StatisticNumeric<T> & EMANE::StatisticNumeric<T>::operator/=(const T & rh
 template<typename T>
 EMANE::StatisticNumeric<T> & EMANE::StatisticNumeric<T>::operator=(const T & rhs)
 {
-  std::lock_guard<std::mutex> m(mutex_);
-            
-  value_ = rhs;
+  store(rhs);
 
   return *this;
 }
@@ -268,9 +276,7 @@ EMANE::StatisticNumeric<T> & EMANE::StatisticNumeric<T>::operator=(const T & rhs
 template<typename T>
 bool EMANE::StatisticNumeric<T>::operator==(const EMANE::StatisticNumeric<T> &rhs) const
 {
-  std::lock_guard<std::mutex> m(mutex_);
-
-  return value_ == rhs.value_;
+  return load() == rhs.load();
 }
 
 template<typename T>
@@ -282,103 +288,79 @@ bool EMANE::StatisticNumeric<T>::operator!=(const EMANE::StatisticNumeric<T> &rh
 template<typename T>
 bool EMANE::StatisticNumeric<T>::operator<(const EMANE::StatisticNumeric<T> &rhs) const
 {
-  std::lock_guard<std::mutex> m(mutex_);
-      
-  return value_ < rhs.value_;
+  return load() < rhs.load();
 }
 
 template<typename T>
 bool EMANE::StatisticNumeric<T>::operator<=(const EMANE::StatisticNumeric<T> &rhs) const
 {
-  std::lock_guard<std::mutex> m(mutex_);
-      
-  return value_ <= rhs.value_;
+  return load() <= rhs.load();
 }
 
 template<typename T>
 bool EMANE::StatisticNumeric<T>::operator>(const EMANE::StatisticNumeric<T> &rhs) const
 {
-  std::lock_guard<std::mutex> m(mutex_);
-      
-  return value_ > rhs.value_;
+  return load() > rhs.load();
 }
 
 template<typename T>
 bool EMANE::StatisticNumeric<T>::operator>=(const EMANE::StatisticNumeric<T> &rhs) const
 {
-  std::lock_guard<std::mutex> m(mutex_);
-      
-  return value_ >= rhs.value_;
+  return load() >= rhs.load();
 }
 
 template<typename T>
 bool EMANE::StatisticNumeric<T>::operator==(const T & rhs) const
 {
-  std::lock_guard<std::mutex> m(mutex_);
-  
-  return value_ == rhs;
+  return load() == rhs;
 }
 
 template<typename T>
 bool EMANE::StatisticNumeric<T>::operator!=(const T & rhs) const
 {
-  return value_ != rhs;
+  return load() != rhs;
 }
 
 template<typename T>
 bool EMANE::StatisticNumeric<T>::operator<(const T & rhs) const
 {
-  std::lock_guard<std::mutex> m(mutex_);
-      
-  return value_ < rhs;
+  return load() < rhs;
 }
 
 template<typename T>
 bool EMANE::StatisticNumeric<T>::operator<=(const T & rhs) const
 {
-  std::lock_guard<std::mutex> m(mutex_);
-      
-  return value_ <= rhs;
+  return load() <= rhs;
 }
 
 template<typename T>
 bool EMANE::StatisticNumeric<T>::operator>(const T & rhs) const
 {
-  std::lock_guard<std::mutex> m(mutex_);
-      
-  return value_ > rhs;
+  return load() > rhs;
 }
 
 template<typename T>
 bool EMANE::StatisticNumeric<T>::operator>=(const T & rhs) const
 {
-  std::lock_guard<std::mutex> m(mutex_);
-      
-  return value_ >= rhs;
+  return load() >= rhs;
 }
 
 template<typename T>
 T EMANE::StatisticNumeric<T>::get() const
 {
-  std::lock_guard<std::mutex> m(mutex_);
-
-  return value_;
+  return load();
 }
 
 template<typename T>
 EMANE::Any EMANE::StatisticNumeric<T>::asAny() const
 {
-  std::lock_guard<std::mutex> m(mutex_);
-  
-  return Any{value_};
+  return Any{load()};
 }
 
 template<typename T>
 void EMANE::StatisticNumeric<T>::clear()
 {
-  std::lock_guard<std::mutex> m(mutex_);
-  
-  value_ = 0;
+  store(T{});
 }
 
 template<typename T>
@@ -386,17 +368,17 @@ template<typename Compare>
 bool EMANE::StatisticNumeric<T>::compareExchange(const T & expected, const T & desired)
 {
   Compare cmp{};
-  
-  std::lock_guard<std::mutex> m(mutex_);
-  
-  if(cmp(value_,expected))
-    {
-      value_ = desired;
-      
-      return true;
-    }
-  
-  return false;
+
+  bool bMatch{};
+
+  apply([&cmp,&expected,&desired,&bMatch](const T & value)
+        {
+          bMatch = cmp(value,expected);
+
+          return bMatch ? desired : value;
+        });
+
+  return bMatch;
 }
 
 template<typename T>
@@ -407,32 +389,28 @@ bool EMANE::StatisticNumeric<T>::compareExchange(const T & expected,
 {
   Compare cmp{};
 
-  std::lock_guard<std::mutex> m(mutex_);
+  bool bMatch{};
 
-  if(cmp(value_,expected))
-    {
-      value_ = desired;
-        
-      return true;
-    }
-  else
-    {
-      value_ = alternate;
-    }
+  apply([&cmp,&expected,&desired,&alternate,&bMatch](const T & value)
+        {
+          bMatch = cmp(value,expected);
+
+          return bMatch ? desired : alternate;
+        });
 
-  return false;
+  return bMatch;
 }
 
 template <typename T>
 bool operator<=(const T & val, const EMANE::StatisticNumeric<T> & stat)
 {
-  return EMANE::StatisticNumeric<T>(val)<=stat;
+  return val <= stat.get();
 }
 
 template <typename T>
 bool operator>=(const T & val, const EMANE::StatisticNumeric<T> & stat)
 {
-  return EMANE::StatisticNumeric<T>(val)>=stat;
+  return val >= stat.get();
 }
 
 template <typename T>
@@ -444,65 +422,65 @@ bool operator>(const T & val, const EMANE::StatisticNumeric<T> & stat)
 template <typename T>
 bool operator<(const T & val, const EMANE::StatisticNumeric<T> & stat)
 {
-  return val > stat.getValue();
+  return val < stat.get();
 }
 
 template <typename T>
 bool operator==(const T & val, const EMANE::StatisticNumeric<T> & stat)
 {
-  return val == stat.getValue();
+  return val == stat.get();
 }
 
 template <typename T>
 bool operator!=(const T & val, const EMANE::StatisticNumeric<T> & stat)
 {
-  return val != stat.getValue();
+  return val != stat.get();
 }
 
 template <typename T>
 T operator+(const T & val, const EMANE::StatisticNumeric<T> & stat)
 {
-  return val + stat.getValue();
+  return val + stat.get();
 }
     
 template <typename T>
 T operator-(const T & val, const EMANE::StatisticNumeric<T> & stat)
 {
-  return val - stat.getValue();
+  return val - stat.get();
 }
 
 template <typename T>
 T operator*(const T & val, const EMANE::StatisticNumeric<T> & stat)
 {
-  return val * stat.getValue();
+  return val * stat.get();
 }
 
 template <typename T>
 T operator/(const T & val, const EMANE::StatisticNumeric<T> & stat)
 {
-  return val / stat.getValue();
+  return val / stat.get();
 }
 
 template <typename T>
 T & operator+=(T & val, const EMANE::StatisticNumeric<T> & stat)
 {
-  return val += stat.getValue();
+  return val += stat.get();
 }
 
 template <typename T>
 T & operator-=(T & val, const EMANE::StatisticNumeric<T> & stat)
 {
-  return val -= stat.getValue();
+  return val -= stat.get();
 }
 
 template <typename T>
 T & operator*=(T & val, const EMANE::StatisticNumeric<T> & stat)
 {
-  return val *= stat.getValue();
+  return val *= stat.get();
 }
 
 template <typename T>
 T & operator/=(T & val, const EMANE::StatisticNumeric<T> & stat)
 {
-  return val /= stat.getValue();
+  return val /= stat.get();
 }
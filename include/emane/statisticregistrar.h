@@ -38,6 +38,7 @@
 #include "emane/statisticnumeric.h"
 #include "emane/statisticnonnumeric.h"
 #include "emane/statistictable.h"
+#include "emane/statisticlazytable.h"
 #include "emane/statisticproperties.h"
 
 #include <string>
@@ -175,6 +176,83 @@ namespace EMANE
                   const std::string & sDescription = "");
 
 
+    /**
+     * Register a lazy statistic table. The registered statistic table
+     * is owned by the StatisticRegistrar.
+     *
+     * @tparam Key Type of the keys. Each row in the table is uniquely
+     *  identified by its key value
+     * @tparam Row Type of the compact row values
+     * @tparam Compare A binary predicate that takes two element
+     *  keys as arguments and returns a bool
+     * @tparam scolumn The column used when sorting the table using
+     *  Compare
+     *
+     * @param sName Name of the statistic table
+     * @param labels Table column labels
+     * @param materializer Function used to build the Any column
+     *  values of a row when the table is queried
+     * @param properties Table properties
+     * @param sDescription Statistic table description
+     *
+     * @return A borrowed reference to the statistic table that may
+     *  be used during the lifetime of the registered component.
+     *
+     * @throw RegistrarException when a error occurs during
+     *  registration.
+     */
+    template<typename Key,
+             typename Row,
+             typename Compare = std::less<EMANE::Any>,
+             std::size_t scolumn = 0>
+    StatisticLazyTable<Key,Row,Compare,scolumn> *
+    registerLazyTable(const std::string & sName,
+                      const StatisticTableLabels & labels,
+                      typename StatisticLazyTable<Key,Row,Compare,scolumn>::Materializer materializer,
+                      const StatisticProperties & properties = StatisticProperties::NONE,
+                      const std::string & sDescription = "");
+
+
+    /**
+     * Register a lazy statistic table. The registered statistic table
+     * is owned by the StatisticRegistrar.
+     *
+     * @tparam Key Type of the keys. Each row in the table is uniquely
+     *  identified by its key value
+     * @tparam Row Type of the compact row values
+     * @tparam Compare A binary predicate that takes two element
+     *  keys as arguments and returns a bool
+     * @tparam scolumn The column used when sorting the table using
+     *  Compare
+     *
+     * @param sName Name of the statistic table
+     * @param labels Table column labels
+     * @param materializer Function used to build the Any column
+     *  values of a row when the table is queried
+     * @param clearFunc Function called with the table when table clear
+     *  is requested
+     * @param sDescription Statistic table description
+     *
+     * @return A borrowed reference to the statistic table that may
+     *  be used during the lifetime of the registered component.
+     *
+     * @throw RegistrarException when a error occurs during
+     *  registration.
+     *
+     * @note The specified clear function is called on an internal emulator framework thread.
+     * It is responsible for clearing any state the materializer reads.
+     */
+    template<typename Key,
+             typename Row,
+             typename Compare = std::less<EMANE::Any>,
+             std::size_t scolumn = 0>
+    StatisticLazyTable<Key,Row,Compare,scolumn> *
+    registerLazyTable(const std::string & sName,
+                      const StatisticTableLabels & labels,
+                      typename StatisticLazyTable<Key,Row,Compare,scolumn>::Materializer materializer,
+                      std::function<void(StatisticTablePublisher *)> clearFunc,
+                      const std::string & sDescription = "");
+
   protected:
     /**
      * Register a statistic and take ownership
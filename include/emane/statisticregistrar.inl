@@ -118,3 +118,53 @@ EMANE::StatisticRegistrar::registerTable(const std::string & sName,
   
   return pStatisticTable;
 }
+
+template<typename Key, typename Row, typename Compare, std::size_t scolumn>
+EMANE::StatisticLazyTable<Key,Row,Compare,scolumn> *
+EMANE::StatisticRegistrar::registerLazyTable(const std::string & sName,
+                                             const StatisticTableLabels & labels,
+                                             typename StatisticLazyTable<Key,Row,Compare,scolumn>::Materializer materializer,
+                                             const StatisticProperties & properties,
+                                             const std::string & sDescription)
+{
+  auto pStatisticTable = new StatisticLazyTable<Key,Row,Compare,scolumn>(labels,materializer);
+
+  if(scolumn >= labels.size())
+    {
+      throw makeException<RegistrarException>("table sort column index out of range for: %s",
+                                              sName.c_str());
+    }
+
+  registerTablePublisher(sName,
+                         properties,
+                         sDescription,
+                         pStatisticTable,
+                         [](StatisticTablePublisher * p){p->clear();});
+
+  return pStatisticTable;
+}
+
+template<typename Key, typename Row, typename Compare, std::size_t scolumn>
+EMANE::StatisticLazyTable<Key,Row,Compare,scolumn> *
+EMANE::StatisticRegistrar::registerLazyTable(const std::string & sName,
+                                             const StatisticTableLabels & labels,
+                                             typename StatisticLazyTable<Key,Row,Compare,scolumn>::Materializer materializer,
+                                             std::function<void(StatisticTablePublisher *)> clearFunc,
+                                             const std::string & sDescription)
+{
+  auto pStatisticTable = new StatisticLazyTable<Key,Row,Compare,scolumn>(labels,materializer);
+
+  if(scolumn >= labels.size())
+    {
+      throw makeException<RegistrarException>("table sort column index out of range for: %s",
+                                              sName.c_str());
+    }
+
+  registerTablePublisher(sName,
+                         StatisticProperties::CLEARABLE,
+                         sDescription,
+                         pStatisticTable,
+                         clearFunc);
+
+  return pStatisticTable;
+}
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANESTATISTICSNAPSHOTFORMAT_HEADER_
+#define EMANESTATISTICSNAPSHOTFORMAT_HEADER_
+
+#include <cstdint>
+#include <cstring>
+#include <atomic>
+
+/**
+ * @file statisticsnapshotformat.h
+ *
+ * Layout of the memory-mapped statistic snapshot file written by the
+ * emulator when the @a stats.snapshot.file platform parameter is
+ * set. The file contains every numeric statistic of every registered
+ * build id and is updated in place every @a stats.snapshot.interval.
+ *
+ * The file starts with a Header followed by the name index, an array
+ * of Header::u32EntryCount IndexEntry records written once when the
+ * snapshot is opened. Values are grouped in one block per build
+ * id. Each block starts with a BlockHeader followed by
+ * BlockHeader::u32Count 8 byte values. A block is updated under a
+ * seqlock: BlockHeader::u64Sequence is odd while the block is
+ * written. Use readBlock() or readValue() to obtain a consistent
+ * copy.
+ *
+ * All values are native byte order.
+ */
+
+namespace EMANE
+{
+  namespace StatisticSnapshotFormat
+  {
+    /** 'EMANESTS' */
+    constexpr std::uint64_t MAGIC{0x454d414e45535453};
+
+    constexpr std::uint32_t FORMAT_VERSION{1};
+
+    /**
+     * Value encoding of an 8 byte value slot
+     */
+    enum class ValueType : std::uint8_t
+      {
+        INT64 = 1,  /**< int64_t, used for all signed integer statistics */
+        UINT64 = 2, /**< uint64_t, used for all unsigned integer statistics */
+        DOUBLE = 3, /**< double, used for float and double statistics */
+        BOOL = 4,   /**< uint64_t 0 or 1 */
+      };
+
+    struct Header
+    {
+      std::uint64_t u64Magic;
+      std::uint32_t u32Version;
+      std::uint32_t u32EntryCount;
+      std::uint32_t u32BlockCount;
+      std::uint32_t u32Reserved;
+      std::uint64_t u64IndexOffset;
+      std::uint64_t u64BlockOffset;
+      std::uint64_t u64IntervalMicroseconds;
+      std::uint64_t u64Size;
+    };
+
+    struct IndexEntry
+    {
+      char name[104];             /**< null terminated, truncated if needed */
+      std::uint64_t u64BlockOffset; /**< file offset of the BlockHeader */
+      std::uint64_t u64ValueOffset; /**< file offset of the value */
+      std::uint32_t u32BuildId;
+      ValueType type;
+      std::uint8_t u8Reserved[3];
+    };
+
+    struct BlockHeader
+    {
+      std::uint64_t u64Sequence;
+      std::uint64_t u64TimestampMicroseconds; /**< time since epoch of the last update */
+      std::uint32_t u32BuildId;
+      std::uint32_t u32Count;
+      std::uint64_t u64Reserved;
+    };
+
+    static_assert(sizeof(Header) == 56,"unexpected snapshot header size");
+    static_assert(sizeof(IndexEntry) == 128,"unexpected snapshot index entry size");
+    static_assert(sizeof(BlockHeader) == 32,"unexpected snapshot block header size");
+
+    /**
+     * Copies a consistent view of a block
+     *
+     * @param pBase Start of the mapped snapshot file
+     * @param u64BlockOffset File offset of the block
+     * @param pValues Destination for BlockHeader::u32Count values
+     * @param u32MaxTries Maximum attempts before giving up
+     *
+     * @return @a true if a consistent copy was made
+     */
+    inline bool readBlock(const void * pBase,
+                          std::uint64_t u64BlockOffset,
+                          std::uint64_t * pValues,
+                          std::uint32_t u32MaxTries = 1000)
+    {
+      auto pBlock =
+        reinterpret_cast<const BlockHeader *>(static_cast<const std::uint8_t *>(pBase) +
+                                              u64BlockOffset);
+
+      auto pSource = reinterpret_cast<const std::uint64_t *>(pBlock + 1);
+
+      for(std::uint32_t i = 0; i < u32MaxTries; ++i)
+        {
+          auto u64Before = __atomic_load_n(&pBlock->u64Sequence,__ATOMIC_ACQUIRE);
+
+          if(u64Before & 1)
+            {
+              continue;
+            }
+
+          for(std::uint32_t j = 0; j < pBlock->u32Count; ++j)
+            {
+              pValues[j] = __atomic_load_n(&pSource[j],__ATOMIC_RELAXED);
+            }
+
+          std::atomic_thread_fence(std::memory_order_acquire);
+
+          if(__atomic_load_n(&pBlock->u64Sequence,__ATOMIC_RELAXED) == u64Before)
+            {
+              return true;
+            }
+        }
+
+      return false;
+    }
+
+    /**
+     * Reads a single value consistent with its block
+     *
+     * @param pBase Start of the mapped snapshot file
+     * @param entry Index entry of the statistic
+     * @param u64Value Raw value, interpret using IndexEntry::type
+     * @param u32MaxTries Maximum attempts before giving up
+     *
+     * @return @a true if a consistent value was read
+     */
+    inline bool readValue(const void * pBase,
+                          const IndexEntry & entry,
+                          std::uint64_t & u64Value,
+                          std::uint32_t u32MaxTries = 1000)
+    {
+      auto pBytes = static_cast<const std::uint8_t *>(pBase);
+
+      auto pBlock = reinterpret_cast<const BlockHeader *>(pBytes + entry.u64BlockOffset);
+
+      auto pValue = reinterpret_cast<const std::uint64_t *>(pBytes + entry.u64ValueOffset);
+
+      for(std::uint32_t i = 0; i < u32MaxTries; ++i)
+        {
+          auto u64Before = __atomic_load_n(&pBlock->u64Sequence,__ATOMIC_ACQUIRE);
+
+          if(u64Before & 1)
+            {
+              continue;
+            }
+
+          u64Value = __atomic_load_n(pValue,__ATOMIC_RELAXED);
+
+          std::atomic_thread_fence(std::memory_order_acquire);
+
+          if(__atomic_load_n(&pBlock->u64Sequence,__ATOMIC_RELAXED) == u64Before)
+            {
+              return true;
+            }
+        }
+
+      return false;
+    }
+
+    /**
+     * Interprets a raw value as a double
+     */
+    inline double toDouble(ValueType type, std::uint64_t u64Value)
+    {
+      switch(type)
+        {
+        case ValueType::INT64:
+          return static_cast<double>(static_cast<std::int64_t>(u64Value));
+        case ValueType::DOUBLE:
+          {
+            double dValue{};
+            std::memcpy(&dValue,&u64Value,sizeof(dValue));
+            return dValue;
+          }
+        default:
+          return static_cast<double>(u64Value);
+        }
+    }
+  }
+}
+
+#endif // EMANESTATISTICSNAPSHOTFORMAT_HEADER_
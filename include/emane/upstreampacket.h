@@ -42,6 +42,8 @@
 
 namespace EMANE
 {
+  class CommonPHYHeader;
+
   /**
    * @class UpstreamPacket
    *
@@ -148,7 +150,44 @@ namespace EMANE
      * @return packet information
      */
     const PacketInfo & getPacketInfo() const;
-    
+
+    /**
+     * Records a latency trace stamp. Trace stamps are local to this
+     * packet instance and its copies, they are never transmitted.
+     *
+     * @param now Time of the stamp
+     *
+     * @return Time elapsed since the previous stamp or, for the
+     * first stamp, since the packet creation time
+     */
+    Microseconds stampTrace(const TimePoint & now);
+
+    /**
+     * Attaches an already decoded common PHY header to the packet
+     * data shared by this packet and all of its copies. The header
+     * must have been decoded from the @a size bytes starting at the
+     * current head of this packet.
+     *
+     * @param pCommonPHYHeader Immutable decoded header
+     * @param size Number of encoded header bytes, including framing
+     *
+     * @note The attachment is not synchronized and must be made
+     * before the packet is shared with other threads.
+     */
+    void attachCommonPHYHeader(std::shared_ptr<const CommonPHYHeader> pCommonPHYHeader,
+                               size_t size);
+
+    /**
+     * Removes an attached decoded common PHY header from the
+     * beginning of the packet.
+     *
+     * @return Decoded header or an empty pointer if no header is
+     * attached at the current head of the packet, in which case the
+     * packet is unchanged and the header must be decoded from the
+     * packet data.
+     */
+    std::shared_ptr<const CommonPHYHeader> stripCommonPHYHeader();
+
   private:
     class Implementation;
     std::unique_ptr<Implementation> pImpl_;
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANEUTILSASSETCACHE_HEADER_
+#define EMANEUTILSASSETCACHE_HEADER_
+
+#include "emane/utils/singleton.h"
+#include "emane/statisticnumeric.h"
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+namespace EMANE
+{
+  namespace Utils
+  {
+    /**
+     * @class AssetCache
+     *
+     * @brief Process-wide cache of immutable assets parsed from
+     * files, such as PCR curves and antenna patterns.
+     *
+     * Assets are keyed by asset type, resolved file path and a hash
+     * of the file contents. Each file is parsed once while any user
+     * holds a reference to the resulting asset. Hit, miss and bytes
+     * saved counts are published as emulator (build id 0) statistics.
+     *
+     * @note Cached types must provide <tt>std::size_t getBytes() const</tt>
+     * returning an estimate of their memory footprint.
+     */
+    class AssetCache : public Singleton<AssetCache>
+    {
+    public:
+      /**
+       * Gets a shared asset, invoking @a loader only if an asset of
+       * the same type loaded from the same file contents is not
+       * already held within the process.
+       *
+       * @param sType Asset type name, differentiates formats or parse
+       * options for the same file
+       * @param sFileName Asset file name
+       * @param loader Callable that parses the resolved file name and
+       * returns the asset
+       *
+       * @return shared immutable asset
+       *
+       * @throw Any exception thrown by @a loader
+       */
+      template<typename T>
+      std::shared_ptr<const T> load(const std::string & sType,
+                                    const std::string & sFileName,
+                                    const std::function<T(const std::string &)> & loader);
+
+    protected:
+      AssetCache();
+
+    private:
+      using Key = std::tuple<std::string, // type
+                             std::string, // resolved path
+                             std::uint64_t>; // content hash
+
+      struct Entry
+      {
+        std::mutex mutex_;
+        std::weak_ptr<const void> pAsset_;
+      };
+
+      std::mutex mutex_;
+      std::map<Key,std::shared_ptr<Entry>> cache_;
+
+      StatisticNumeric<std::uint64_t> * pNumAssetCacheHits_;
+      StatisticNumeric<std::uint64_t> * pNumAssetCacheMisses_;
+      StatisticNumeric<std::uint64_t> * pAssetCacheBytesSaved_;
+
+      std::pair<std::shared_ptr<Entry>,std::string> getEntry(const std::string & sType,
+                                                             const std::string & sFileName);
+
+      void recordHit(std::size_t bytes);
+
+      void recordMiss();
+    };
+  }
+}
+
+#include "emane/utils/assetcache.inl"
+
+#endif // EMANEUTILSASSETCACHE_HEADER_
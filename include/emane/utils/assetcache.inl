@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+template<typename T>
+std::shared_ptr<const T>
+EMANE::Utils::AssetCache::load(const std::string & sType,
+                               const std::string & sFileName,
+                               const std::function<T(const std::string &)> & loader)
+{
+  auto ret = getEntry(sType,sFileName);
+
+  auto & pEntry = ret.first;
+
+  // serializes loads of the same asset, different assets load
+  // concurrently
+  std::lock_guard<std::mutex> m(pEntry->mutex_);
+
+  auto pAsset = std::static_pointer_cast<const T>(pEntry->pAsset_.lock());
+
+  if(pAsset)
+    {
+      recordHit(pAsset->getBytes());
+    }
+  else
+    {
+      pAsset = std::make_shared<const T>(loader(ret.second));
+
+      pEntry->pAsset_ = pAsset;
+
+      recordMiss();
+    }
+
+  return pAsset;
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANEUTILSDUPLICATEDETECTOR_HEADER_
+#define EMANEUTILSDUPLICATEDETECTOR_HEADER_
+
+#include "emane/types.h"
+
+#include <vector>
+#include <cstdint>
+
+namespace EMANE
+{
+  namespace Utils
+  {
+    /**
+     * @class DuplicateDetector
+     *
+     * @brief Detects duplicate 16 bit sequence numbers per source
+     * using a sliding window bitmap anchored at the highest sequence
+     * number received from each source.
+     *
+     * Source state is held in contiguous storage indexed by NEM id,
+     * so a check is O(1) and a new source only grows shared
+     * storage. Each window position keeps a coarse millisecond
+     * timestamp and a sequence number is only a duplicate for the
+     * validity interval after it was first received. Sequence
+     * numbers older than the window are never duplicates.
+     *
+     * @note Not thread safe.
+     */
+    class DuplicateDetector
+    {
+    public:
+      /**
+       * Creates a DuplicateDetector instance
+       *
+       * @param u16WindowSize Number of sequence numbers, up to and
+       * including the highest received, tracked per source [1,32768]
+       * @param validity Duration a sequence number remains a duplicate
+       *
+       * @throw ConfigurationException if the window size is out of range
+       */
+      DuplicateDetector(std::uint16_t u16WindowSize = 1024,
+                        const Microseconds & validity = std::chrono::seconds{5});
+
+      /**
+       * Sets the window size and clears all sources
+       *
+       * @param u16WindowSize Number of sequence numbers tracked per
+       * source [1,32768]
+       *
+       * @throw ConfigurationException if the window size is out of range
+       */
+      void setWindowSize(std::uint16_t u16WindowSize);
+
+      /**
+       * Checks if a sequence number is a duplicate and records it
+       * when it is not
+       *
+       * @param src Source NEM id
+       * @param u16Sequence Sequence number
+       * @param timePoint Reception time
+       *
+       * @return true if the sequence number is a duplicate
+       */
+      bool isDuplicate(NEMId src,
+                       std::uint16_t u16Sequence,
+                       const TimePoint & timePoint);
+
+      /**
+       * Clears all sources
+       */
+      void clear();
+
+    private:
+      struct Source
+      {
+        bool bActive_;
+        std::uint16_t u16Highest_;
+        std::uint32_t u32LastMilliseconds_;
+      };
+
+      std::uint16_t u16WindowSize_;
+      std::uint32_t u32ValidityMilliseconds_;
+      std::uint32_t u32PositionMask_;
+      size_t wordsPerSource_;
+      std::vector<std::uint32_t> sourceIndexes_;
+      std::vector<Source> sources_;
+      std::vector<std::uint64_t> bitmaps_;
+      std::vector<std::uint32_t> timestamps_;
+
+      size_t getSource(NEMId src);
+    };
+  }
+}
+
+#include "emane/utils/duplicatedetector.inl"
+
+#endif // EMANEUTILSDUPLICATEDETECTOR_HEADER_
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "emane/configurationexception.h"
+
+#include <algorithm>
+
+inline
+EMANE::Utils::DuplicateDetector::DuplicateDetector(std::uint16_t u16WindowSize,
+                                                   const Microseconds & validity):
+  u16WindowSize_{},
+  u32ValidityMilliseconds_(std::chrono::duration_cast<std::chrono::milliseconds>(validity).count()),
+  u32PositionMask_{},
+  wordsPerSource_{}
+{
+  setWindowSize(u16WindowSize);
+}
+
+inline
+void EMANE::Utils::DuplicateDetector::setWindowSize(std::uint16_t u16WindowSize)
+{
+  if(u16WindowSize < 1 || u16WindowSize > 32768)
+    {
+      throw makeException<ConfigurationException>("duplicate detector window size %hu out of range [1,32768]",
+                                                  u16WindowSize);
+    }
+
+  // window positions are a power of 2 so a position is the low
+  // order bits of the sequence number across wrap
+  std::uint32_t u32Positions{64};
+
+  while(u32Positions < u16WindowSize)
+    {
+      u32Positions <<= 1;
+    }
+
+  u16WindowSize_ = u16WindowSize;
+
+  u32PositionMask_ = u32Positions - 1;
+
+  wordsPerSource_ = u32Positions / 64;
+
+  clear();
+}
+
+inline
+void EMANE::Utils::DuplicateDetector::clear()
+{
+  sourceIndexes_.clear();
+  sources_.clear();
+  bitmaps_.clear();
+  timestamps_.clear();
+}
+
+inline
+size_t EMANE::Utils::DuplicateDetector::getSource(NEMId src)
+{
+  if(src >= sourceIndexes_.size())
+    {
+      sourceIndexes_.resize(src + 1,0);
+    }
+
+  // index 0 is reserved for unknown sources
+  if(!sourceIndexes_[src])
+    {
+      sources_.push_back({});
+
+      bitmaps_.resize(bitmaps_.size() + wordsPerSource_,0);
+
+      timestamps_.resize(timestamps_.size() + u32PositionMask_ + 1,0);
+
+      sourceIndexes_[src] = sources_.size();
+    }
+
+  return sourceIndexes_[src] - 1;
+}
+
+inline
+bool EMANE::Utils::DuplicateDetector::isDuplicate(NEMId src,
+                                                  std::uint16_t u16Sequence,
+                                                  const TimePoint & timePoint)
+{
+  std::uint32_t u32Milliseconds =
+    std::chrono::duration_cast<std::chrono::milliseconds>(timePoint.time_since_epoch()).count();
+
+  size_t index{getSource(src)};
+
+  auto & source = sources_[index];
+
+  auto pBitmap = &bitmaps_[index * wordsPerSource_];
+
+  auto pTimestamps = &timestamps_[index * (u32PositionMask_ + 1)];
+
+  auto mark = [pBitmap,pTimestamps,u32Milliseconds,this](std::uint16_t u16Sequence)
+              {
+                std::uint32_t u32Position{u16Sequence & u32PositionMask_};
+
+                pBitmap[u32Position / 64] |= std::uint64_t{1} << (u32Position % 64);
+
+                pTimestamps[u32Position] = u32Milliseconds;
+              };
+
+  // every entry of a source silent for the validity interval has expired
+  if(!source.bActive_ ||
+     static_cast<std::uint32_t>(u32Milliseconds - source.u32LastMilliseconds_) > u32ValidityMilliseconds_)
+    {
+      std::fill_n(pBitmap,wordsPerSource_,0);
+
+      source.bActive_ = true;
+
+      source.u16Highest_ = u16Sequence;
+
+      source.u32LastMilliseconds_ = u32Milliseconds;
+
+      mark(u16Sequence);
+
+      return false;
+    }
+
+  source.u32LastMilliseconds_ = u32Milliseconds;
+
+  std::uint16_t u16Behind = source.u16Highest_ - u16Sequence;
+
+  // newer than the highest, slide the window
+  if(u16Behind >= 0x8000)
+    {
+      std::uint16_t u16Advance = u16Sequence - source.u16Highest_;
+
+      if(u16Advance > u32PositionMask_)
+        {
+          std::fill_n(pBitmap,wordsPerSource_,0);
+        }
+      else
+        {
+          // clear positions previously held by sequence numbers that
+          // have left the window
+          for(std::uint16_t i = 1; i <= u16Advance; ++i)
+            {
+              std::uint32_t u32Position{static_cast<std::uint16_t>(source.u16Highest_ + i) & u32PositionMask_};
+
+              pBitmap[u32Position / 64] &= ~(std::uint64_t{1} << (u32Position % 64));
+            }
+        }
+
+      source.u16Highest_ = u16Sequence;
+
+      mark(u16Sequence);
+
+      return false;
+    }
+
+  // older than the window
+  if(u16Behind >= u16WindowSize_)
+    {
+      return false;
+    }
+
+  std::uint32_t u32Position{u16Sequence & u32PositionMask_};
+
+  if((pBitmap[u32Position / 64] & (std::uint64_t{1} << (u32Position % 64))) &&
+     static_cast<std::uint32_t>(u32Milliseconds - pTimestamps[u32Position]) <= u32ValidityMilliseconds_)
+    {
+      return true;
+    }
+
+  mark(u16Sequence);
+
+  return false;
+}
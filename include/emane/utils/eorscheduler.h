@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANEUTILSEORSCHEDULER_HEADER_
+#define EMANEUTILSEORSCHEDULER_HEADER_
+
+#include "emane/types.h"
+#include "emane/timerserviceprovider.h"
+#include "emane/spectrumserviceprovider.h"
+
+#include <functional>
+#include <map>
+#include <vector>
+
+namespace EMANE
+{
+  namespace Utils
+  {
+    /**
+     * @class EORScheduler
+     *
+     * @brief Holds pending receptions until their end of reception
+     * (EOR) and delivers them in EOR order.
+     *
+     * A single timer is armed for the earliest pending EOR. When it
+     * fires, all receptions whose EOR has passed are delivered in one
+     * callback and their spectrum window requests are made as a
+     * single batch.
+     *
+     * @tparam Reception Model specific reception state
+     *
+     * @note Not thread safe. Timer callbacks run in the owning NEM
+     * layer processing context, so the scheduler must only be used
+     * from that context, for example from
+     * @ref EMANE::UpstreamPacketProcessor::processUpstreamPacket "processUpstreamPacket".
+     */
+    template<typename Reception>
+    class EORScheduler
+    {
+    public:
+      /**
+       * Reception handler, called with the reception and the result
+       * of its spectrum window request. An exception raised by the
+       * handler propagates to the caller, receptions not yet handled
+       * remain pending.
+       */
+      using Handler = std::function<void(Reception &, const SpectrumWindowResult &)>;
+
+      /**
+       * Creates an instance
+       *
+       * @param timerService Timer service used to arm the EOR timer
+       * @param spectrumService Spectrum service used for spectrum
+       * window requests
+       * @param handler Reception handler
+       */
+      EORScheduler(TimerServiceProvider & timerService,
+                   SpectrumServiceProvider & spectrumService,
+                   Handler handler);
+
+      /**
+       * Cancels the EOR timer. Pending receptions are discarded.
+       */
+      ~EORScheduler();
+
+      /**
+       * Adds a reception. Receptions with an EOR that has already
+       * passed are delivered, along with any other due receptions,
+       * before returning.
+       *
+       * @param eor End of reception time
+       * @param request Spectrum window request for the reception
+       * @param reception Reception state
+       */
+      void schedule(const TimePoint & eor,
+                    const SpectrumWindowRequest & request,
+                    Reception && reception);
+
+      /**
+       * Cancels the EOR timer and discards all pending receptions
+       */
+      void clear();
+
+      /**
+       * Gets the number of pending receptions
+       *
+       * @return pending count
+       */
+      std::size_t getPendingCount() const;
+
+      EORScheduler(const EORScheduler &) = delete;
+
+      EORScheduler & operator=(const EORScheduler &) = delete;
+
+    private:
+      using Pending = std::multimap<TimePoint,std::pair<SpectrumWindowRequest,Reception>>;
+
+      TimerServiceProvider & timerService_;
+      SpectrumServiceProvider & spectrumService_;
+      Handler handler_;
+      Pending pending_;
+      TimerEventId timerId_;
+      TimePoint armedTime_;
+      bool bArmed_;
+      std::uint64_t u64Generation_;
+      bool bDelivering_;
+
+      void deliver(const TimePoint & now);
+
+      void arm();
+
+      void rearm();
+
+      void disarm();
+    };
+  }
+}
+
+#include "emane/utils/eorscheduler.inl"
+
+#endif // EMANEUTILSEORSCHEDULER_HEADER_
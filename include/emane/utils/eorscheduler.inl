@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+template<typename Reception>
+EMANE::Utils::EORScheduler<Reception>::EORScheduler(TimerServiceProvider & timerService,
+                                                    SpectrumServiceProvider & spectrumService,
+                                                    Handler handler):
+  timerService_(timerService),
+  spectrumService_(spectrumService),
+  handler_{std::move(handler)},
+  timerId_{},
+  armedTime_{},
+  bArmed_{},
+  u64Generation_{},
+  bDelivering_{}{}
+
+template<typename Reception>
+EMANE::Utils::EORScheduler<Reception>::~EORScheduler()
+{
+  disarm();
+}
+
+template<typename Reception>
+void EMANE::Utils::EORScheduler<Reception>::schedule(const TimePoint & eor,
+                                                     const SpectrumWindowRequest & request,
+                                                     Reception && reception)
+{
+  // equal EORs are delivered in the order added
+  pending_.emplace_hint(pending_.end(),
+                        std::piecewise_construct,
+                        std::forward_as_tuple(eor),
+                        std::forward_as_tuple(request,std::move(reception)));
+
+  auto now = Clock::now();
+
+  if(eor <= now)
+    {
+      deliver(now);
+    }
+  else if(!bArmed_ || eor < armedTime_)
+    {
+      arm();
+    }
+}
+
+template<typename Reception>
+void EMANE::Utils::EORScheduler<Reception>::clear()
+{
+  disarm();
+
+  pending_.clear();
+}
+
+template<typename Reception>
+std::size_t EMANE::Utils::EORScheduler<Reception>::getPendingCount() const
+{
+  return pending_.size();
+}
+
+template<typename Reception>
+void EMANE::Utils::EORScheduler<Reception>::deliver(const TimePoint & now)
+{
+  // a handler adding a reception with a past EOR is delivered by
+  // the outer call
+  if(bDelivering_)
+    {
+      return;
+    }
+
+  bDelivering_ = true;
+
+  while(!pending_.empty() && pending_.begin()->first <= now)
+    {
+      auto end = pending_.upper_bound(now);
+
+      std::vector<TimePoint> eors{};
+
+      std::vector<SpectrumWindowRequest> requests{};
+
+      std::vector<Reception> receptions{};
+
+      for(auto iter = pending_.begin(); iter != end; ++iter)
+        {
+          eors.push_back(iter->first);
+          requests.push_back(iter->second.first);
+          receptions.push_back(std::move(iter->second.second));
+        }
+
+      pending_.erase(pending_.begin(),end);
+
+      std::vector<SpectrumWindowResult> results{};
+
+      try
+        {
+          results = spectrumService_.request(requests);
+        }
+      catch(...)
+        {
+          // no spectrum monitor, fail each request
+          results.assign(requests.size(),{SpectrumWindow{},std::current_exception()});
+        }
+
+      for(std::size_t i = 0; i < receptions.size(); ++i)
+        {
+          try
+            {
+              handler_(receptions[i],results[i]);
+            }
+          catch(...)
+            {
+              // keep the receptions not yet handled pending and
+              // re-arm so they are delivered by the next timer
+              for(std::size_t j = i + 1; j < receptions.size(); ++j)
+                {
+                  pending_.emplace(std::piecewise_construct,
+                                   std::forward_as_tuple(eors[j]),
+                                   std::forward_as_tuple(requests[j],std::move(receptions[j])));
+                }
+
+              bDelivering_ = false;
+
+              rearm();
+
+              throw;
+            }
+        }
+    }
+
+  bDelivering_ = false;
+
+  rearm();
+}
+
+template<typename Reception>
+void EMANE::Utils::EORScheduler<Reception>::rearm()
+{
+  if(pending_.empty())
+    {
+      disarm();
+    }
+  else if(!bArmed_ || pending_.begin()->first != armedTime_)
+    {
+      arm();
+    }
+}
+
+template<typename Reception>
+void EMANE::Utils::EORScheduler<Reception>::arm()
+{
+  disarm();
+
+  armedTime_ = pending_.begin()->first;
+
+  bArmed_ = true;
+
+  // a cancelled timer that has already fired is ignored using the
+  // generation it was armed with
+  timerId_ =
+    timerService_.schedule([this,u64Generation = u64Generation_](const TimePoint &,
+                                                                 const TimePoint &,
+                                                                 const TimePoint &)
+                           {
+                             if(u64Generation == u64Generation_)
+                               {
+                                 bArmed_ = false;
+
+                                 deliver(Clock::now());
+                               }
+                           },
+                           armedTime_);
+}
+
+template<typename Reception>
+void EMANE::Utils::EORScheduler<Reception>::disarm()
+{
+  if(bArmed_)
+    {
+      timerService_.cancelTimedEvent(timerId_);
+
+      bArmed_ = false;
+    }
+
+  ++u64Generation_;
+}
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANEUTILSLOGLINEARHISTOGRAM_HEADER_
+#define EMANEUTILSLOGLINEARHISTOGRAM_HEADER_
+
+#include <array>
+#include <cstdint>
+#include <algorithm>
+
+namespace EMANE
+{
+  namespace Utils
+  {
+    /**
+     * @class LogLinearHistogram
+     *
+     * @brief Fixed memory histogram of non-negative integer values
+     * with a bounded relative error, used to report tail percentiles.
+     *
+     * Values below 16 are counted exactly. Larger values fall into
+     * one of 16 linear sub-buckets of their power of two range, which
+     * keeps the relative error of a reported percentile below
+     * 6.25%. Values at or above 2^36 are counted in the last bucket.
+     *
+     * @note Not thread safe.
+     */
+    class LogLinearHistogram
+    {
+    public:
+      LogLinearHistogram():
+        buckets_{},
+        u64Count_{},
+        u64Max_{}{}
+
+      /**
+       * Records a value
+       *
+       * @param u64Value Value to record
+       */
+      void record(std::uint64_t u64Value)
+      {
+        ++buckets_[toIndex(u64Value)];
+        ++u64Count_;
+        u64Max_ = std::max(u64Max_,u64Value);
+      }
+
+      /**
+       * Gets the number of recorded values
+       *
+       * @return count
+       */
+      std::uint64_t getCount() const
+      {
+        return u64Count_;
+      }
+
+      /**
+       * Gets the largest recorded value
+       *
+       * @return max value
+       */
+      std::uint64_t getMax() const
+      {
+        return u64Max_;
+      }
+
+      /**
+       * Gets a percentile
+       *
+       * @param dPercentile Percentile in the range [0,100]
+       *
+       * @return Upper bound of the bucket holding the percentile,
+       * limited to the largest recorded value. 0 when empty.
+       */
+      std::uint64_t getPercentile(double dPercentile) const
+      {
+        if(!u64Count_)
+          {
+            return 0;
+          }
+
+        // rank of the value at the requested percentile, 1 based
+        std::uint64_t u64Rank{static_cast<std::uint64_t>(dPercentile / 100.0 * u64Count_ + 0.5)};
+
+        u64Rank = std::min(std::max(u64Rank,std::uint64_t{1}),u64Count_);
+
+        std::uint64_t u64Total{};
+
+        for(std::size_t i = 0; i < buckets_.size(); ++i)
+          {
+            u64Total += buckets_[i];
+
+            if(u64Total >= u64Rank)
+              {
+                return std::min(toUpperBound(i),u64Max_);
+              }
+          }
+
+        return u64Max_;
+      }
+
+      /**
+       * Adds the recorded values of another histogram
+       *
+       * @param other Histogram to add
+       */
+      void merge(const LogLinearHistogram & other)
+      {
+        for(std::size_t i = 0; i < buckets_.size(); ++i)
+          {
+            buckets_[i] += other.buckets_[i];
+          }
+
+        u64Count_ += other.u64Count_;
+        u64Max_ = std::max(u64Max_,other.u64Max_);
+      }
+
+      /**
+       * Clears all recorded values
+       */
+      void clear()
+      {
+        buckets_.fill(0);
+        u64Count_ = 0;
+        u64Max_ = 0;
+      }
+
+    private:
+      static constexpr std::uint32_t SUB_BUCKET_BITS{4};
+      static constexpr std::uint64_t SUB_BUCKET_COUNT{1 << SUB_BUCKET_BITS};
+      static constexpr std::uint32_t MAX_VALUE_BITS{36};
+      static constexpr std::size_t BUCKET_COUNT{SUB_BUCKET_COUNT * (MAX_VALUE_BITS - SUB_BUCKET_BITS + 2)};
+
+      std::array<std::uint64_t,BUCKET_COUNT> buckets_;
+      std::uint64_t u64Count_;
+      std::uint64_t u64Max_;
+
+      static std::size_t toIndex(std::uint64_t u64Value)
+      {
+        if(u64Value < SUB_BUCKET_COUNT)
+          {
+            return u64Value;
+          }
+
+        std::uint32_t u32Exponent = 63 - __builtin_clzll(u64Value) - SUB_BUCKET_BITS;
+
+        std::size_t index{SUB_BUCKET_COUNT +
+            SUB_BUCKET_COUNT * u32Exponent +
+            ((u64Value >> u32Exponent) - SUB_BUCKET_COUNT)};
+
+        return std::min(index,BUCKET_COUNT - 1);
+      }
+
+      static std::uint64_t toUpperBound(std::size_t index)
+      {
+        if(index < SUB_BUCKET_COUNT)
+          {
+            return index;
+          }
+
+        std::uint32_t u32Exponent = (index - SUB_BUCKET_COUNT) / SUB_BUCKET_COUNT;
+
+        std::uint64_t u64Mantissa = SUB_BUCKET_COUNT + (index - SUB_BUCKET_COUNT) % SUB_BUCKET_COUNT;
+
+        return ((u64Mantissa + 1) << u32Exponent) - 1;
+      }
+    };
+  }
+}
+
+#endif // EMANEUTILSLOGLINEARHISTOGRAM_HEADER_
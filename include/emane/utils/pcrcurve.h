@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANEUTILSPCRCURVE_HEADER_
+#define EMANEUTILSPCRCURVE_HEADER_
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace EMANE
+{
+  namespace Utils
+  {
+    /**
+     * @class PCRCurve
+     *
+     * @brief Compiled packet completion rate curve.
+     *
+     * Curve points are linearly interpolated into a fixed-step
+     * array of probability of reception (POR) values indexed by
+     * SINR in hundredths of a dB. Interpolated values are computed
+     * back from the upper point of each segment and curve points
+     * keep their exact POR, matching the TDMA and bentpipe model
+     * curves the table replaces.
+     */
+    class PCRCurve
+    {
+    public:
+      /**
+       * SINR (dB), POR [0,1] pairs in increasing SINR order
+       */
+      using Points = std::vector<std::pair<float,float>>;
+
+      /**
+       * Creates a compiled curve from a set of points
+       *
+       * @param points Curve points
+       *
+       * @throw ConfigurationException when @a points is empty or
+       * not in strictly increasing SINR order
+       */
+      explicit PCRCurve(const Points & points);
+
+      /**
+       * Gets the POR for a given SINR
+       *
+       * @param fSINR SINR in dB
+       *
+       * @return POR, 0 below the curve and 1 above the curve
+       */
+      float getPOR(float fSINR) const;
+
+      /**
+       * Gets the POR for a given SINR raised to a packet length
+       * modifier exponent
+       *
+       * @param fSINR SINR in dB
+       * @param fExponent Packet length modifier exponent
+       *
+       * @return POR, 0 below the curve and 1 above the curve
+       */
+      float getPOR(float fSINR, float fExponent) const;
+
+      /**
+       * Gets the minimum curve SINR in hundredths of a dB
+       */
+      std::int32_t getMinScaledSINR() const;
+
+      /**
+       * Gets the maximum curve SINR in hundredths of a dB
+       */
+      std::int32_t getMaxScaledSINR() const;
+
+      /**
+       * Gets the interpolated POR values starting at the minimum
+       * SINR in hundredths of a dB steps
+       */
+      const std::vector<float> & getPORs() const;
+
+      /**
+       * Gets the memory footprint of the curve in bytes
+       */
+      std::size_t getBytes() const;
+
+    private:
+      std::int32_t i32MinScaledSINR_;
+      std::int32_t i32MaxScaledSINR_;
+      std::vector<float> pors_;
+    };
+
+    /**
+     * @class PCRCurveTable
+     *
+     * @brief Immutable set of compiled curves keyed by a model
+     * specific identifier (data rate, data rate index or curve
+     * index) along with a packet length modifier.
+     */
+    class PCRCurveTable
+    {
+    public:
+      /**
+       * Curve identifier, curve points pairs in definition order
+       */
+      using Curves = std::vector<std::pair<std::uint64_t,PCRCurve::Points>>;
+
+      /**
+       * Creates a curve table
+       *
+       * @param curves Curve points by identifier
+       * @param modifierLengthBytes Packet length used to generate
+       * the curves or 0 to disable the packet length modifier
+       *
+       * @throw ConfigurationException when a curve is invalid
+       */
+      PCRCurveTable(const Curves & curves,
+                    std::size_t modifierLengthBytes);
+
+      /**
+       * Gets the curve for a given identifier
+       *
+       * @param u64Key Curve identifier
+       *
+       * @return curve pointer or nullptr if the identifier is unknown
+       */
+      const PCRCurve * getCurve(std::uint64_t u64Key) const;
+
+      /**
+       * Gets the POR from a curve adjusted for packet length
+       *
+       * @param curve Curve from this table
+       * @param fSINR SINR in dB
+       * @param packetLengthBytes Packet length in bytes
+       *
+       * @return POR
+       */
+      float getPOR(const PCRCurve & curve,
+                   float fSINR,
+                   std::size_t packetLengthBytes) const;
+
+      /**
+       * Gets the packet length modifier
+       */
+      std::size_t getModifierLengthBytes() const;
+
+      /**
+       * Gets the curve identifiers in definition order
+       */
+      const std::vector<std::uint64_t> & getKeys() const;
+
+      /**
+       * Gets the memory footprint of the table in bytes
+       */
+      std::size_t getBytes() const;
+
+    private:
+      std::vector<std::uint64_t> keys_;
+      std::vector<PCRCurve> curves_;
+      std::size_t modifierLengthBytes_;
+    };
+
+    using PCRCurveTablePtr = std::shared_ptr<const PCRCurveTable>;
+
+    /**
+     * Gets a shared compiled curve table from the AssetCache,
+     * invoking @a loader only if the table for the specified format
+     * and file contents is not already held within the process.
+     *
+     * @param sFormat Model specific curve file format name
+     * @param sFileName Curve file name
+     * @param loader Callable that parses the file and returns a table
+     *
+     * @return shared immutable table
+     *
+     * @throw Any exception thrown by @a loader
+     */
+    PCRCurveTablePtr loadPCRCurveTable(const std::string & sFormat,
+                                       const std::string & sFileName,
+                                       const std::function<PCRCurveTable()> & loader);
+  }
+}
+
+#include "emane/utils/pcrcurve.inl"
+
+#endif // EMANEUTILSPCRCURVE_HEADER_
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cmath>
+
+inline float EMANE::Utils::PCRCurve::getPOR(float fSINR) const
+{
+  std::int32_t i32Scaled{static_cast<std::int32_t>(fSINR * 100)};
+
+  if(i32Scaled < i32MinScaledSINR_)
+    {
+      return 0;
+    }
+
+  if(i32Scaled > i32MaxScaledSINR_)
+    {
+      return 1;
+    }
+
+  return pors_[i32Scaled - i32MinScaledSINR_];
+}
+
+inline float EMANE::Utils::PCRCurve::getPOR(float fSINR, float fExponent) const
+{
+  std::int32_t i32Scaled{static_cast<std::int32_t>(fSINR * 100)};
+
+  if(i32Scaled < i32MinScaledSINR_)
+    {
+      return 0;
+    }
+
+  if(i32Scaled > i32MaxScaledSINR_)
+    {
+      return 1;
+    }
+
+  auto index = i32Scaled - i32MinScaledSINR_;
+
+  if(fExponent == 1)
+    {
+      return pors_[index];
+    }
+
+  return powf(pors_[index],fExponent);
+}
+
+inline std::int32_t EMANE::Utils::PCRCurve::getMinScaledSINR() const
+{
+  return i32MinScaledSINR_;
+}
+
+inline std::int32_t EMANE::Utils::PCRCurve::getMaxScaledSINR() const
+{
+  return i32MaxScaledSINR_;
+}
+
+inline const std::vector<float> & EMANE::Utils::PCRCurve::getPORs() const
+{
+  return pors_;
+}
+
+inline const EMANE::Utils::PCRCurve *
+EMANE::Utils::PCRCurveTable::getCurve(std::uint64_t u64Key) const
+{
+  // tables hold a handful of curves, a linear scan of the
+  // contiguous keys beats a tree or hash lookup
+  for(std::size_t i = 0; i < keys_.size(); ++i)
+    {
+      if(keys_[i] == u64Key)
+        {
+          return &curves_[i];
+        }
+    }
+
+  return nullptr;
+}
+
+inline float EMANE::Utils::PCRCurveTable::getPOR(const PCRCurve & curve,
+                                                 float fSINR,
+                                                 std::size_t packetLengthBytes) const
+{
+  if(modifierLengthBytes_)
+    {
+      return curve.getPOR(fSINR,
+                          packetLengthBytes / static_cast<float>(modifierLengthBytes_));
+    }
+
+  return curve.getPOR(fSINR);
+}
+
+inline std::size_t EMANE::Utils::PCRCurveTable::getModifierLengthBytes() const
+{
+  return modifierLengthBytes_;
+}
+
+inline const std::vector<std::uint64_t> & EMANE::Utils::PCRCurveTable::getKeys() const
+{
+  return keys_;
+}
@@ -33,7 +33,9 @@
 #ifndef EMANEUTILPROCESSINGPOOL_HEADER_
 #define EMANEUTILPROCESSINGPOOL_HEADER_
 
+#include "emane/types.h"
 #include "emane/utils/functionwrapper.h"
+#include "emane/utils/threadplacement.h"
 
 #include <deque>
 #include <thread>
@@ -53,7 +55,16 @@ namespace EMANE
 
       ~ProcessingPool();
 
-      void start(std::size_t size);
+      /**
+       * Starts the worker threads
+       *
+       * @param size Number of worker threads
+       * @param id NEM id of the owning NEM or 0
+       * @param threadClass Thread class workers register with
+       */
+      void start(std::size_t size,
+                 NEMId id = 0,
+                 ThreadPlacement::ThreadClass threadClass = ThreadPlacement::ThreadClass::PROCESSINGPOOL);
 
       void stop();
 
@@ -72,7 +83,7 @@ namespace EMANE
       using ProcessingQueue = std::deque<FunctionWrapper>;
       ProcessingQueue queue_;
 
-      void worker();
+      void worker(NEMId id, ThreadPlacement::ThreadClass threadClass);
     };
   }
 }
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANEUTILSTHREADPLACEMENT_HEADER_
+#define EMANEUTILSTHREADPLACEMENT_HEADER_
+
+#include "emane/utils/singleton.h"
+#include "emane/types.h"
+#include "emane/statisticlazytable.h"
+
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+#include <sys/types.h>
+
+namespace EMANE
+{
+  namespace Utils
+  {
+    /**
+     * @class ThreadPlacement
+     *
+     * @brief Process-wide CPU affinity and NUMA placement policy for
+     * emulator threads.
+     *
+     * Threads register on entry using a ThreadPlacement::Scope
+     * instance naming their thread class and, for per NEM threads,
+     * their NEM. The CPU set for a thread is resolved in order from
+     * an explicit CPU list for its class, an explicit CPU list for
+     * its NEM and the automatic NEM packing assignment. Threads with
+     * no resolved CPU set are left unchanged.
+     *
+     * When NUMA local placement is enabled, a thread whose CPU set
+     * lies within a single NUMA node prefers that node for memory
+     * allocation. The memory policy can only be set by the thread
+     * itself, so it applies to threads registering after the policy
+     * is set. Threads started before the policy is set only have
+     * their CPU affinity updated.
+     *
+     * Registered threads, their current CPU affinity, last CPU and
+     * preferred memory node are published in the emulator (build id
+     * 0) ThreadPlacementTable.
+     */
+    class ThreadPlacement : public Singleton<ThreadPlacement>
+    {
+    public:
+      /**
+       * Thread classes
+       */
+      enum class ThreadClass
+      {
+        OTA, /**< OTA manager receive thread */
+        EVENT, /**< Event service receive thread */
+        TIMER, /**< Timer scheduler threads */
+        CONTROL, /**< Control port and statistic snapshot threads */
+        NEM, /**< NEM layer queue and NEM OTA adapter threads */
+        PROCESSINGPOOL, /**< PHY processing pool worker threads */
+        TRANSPORT, /**< Transport device reader threads */
+        STARTUP, /**< Startup NEM configuration pool worker threads, never placed */
+      };
+
+      /**
+       * Automatic NEM packing modes
+       */
+      enum class PackMode
+      {
+        NONE, /**< No automatic placement */
+        CORE, /**< Each NEM is assigned a single CPU */
+        NODE, /**< Each NEM is assigned the CPUs of a single NUMA node */
+      };
+
+      using CPUs = std::set<int>;
+
+      /**
+       * @struct Policy
+       *
+       * @brief Thread placement policy
+       */
+      struct Policy
+      {
+        std::map<ThreadClass,CPUs> classCPUs_; /**< Explicit CPU lists by class */
+        std::map<NEMId,CPUs> nemCPUs_; /**< Explicit CPU lists by NEM */
+        PackMode packMode_; /**< Automatic NEM packing mode */
+        CPUs packCPUs_; /**< CPUs available for packing, empty for all */
+        bool bNUMALocal_; /**< Prefer the local NUMA node for memory */
+      };
+
+      /**
+       * @class Scope
+       *
+       * @brief Registers the calling thread for the lifetime of the
+       * instance and applies the current placement policy.
+       */
+      class Scope
+      {
+      public:
+        /**
+         * Creates an instance
+         *
+         * @param threadClass Thread class
+         * @param id NEM id of the owning NEM or 0
+         */
+        Scope(ThreadClass threadClass, NEMId id = 0);
+
+        ~Scope();
+
+        Scope(const Scope &) = delete;
+
+        Scope & operator=(const Scope &) = delete;
+      };
+
+      /**
+       * Sets the placement policy and applies the CPU affinity of
+       * already registered threads
+       *
+       * @param policy Placement policy
+       */
+      void setPolicy(const Policy & policy);
+
+      /**
+       * Assigns NEMs to packing slots. Must be called before the NEM
+       * threads are started.
+       *
+       * @param nems NEM ids in assignment order
+       */
+      void assign(const std::vector<NEMId> & nems);
+
+      /**
+       * Parses a CPU list such as <tt>0-3,8,10-11</tt>
+       *
+       * @param sCPUs CPU list
+       *
+       * @return CPU set
+       *
+       * @throw ConfigureException when the list is malformed
+       */
+      static CPUs parseCPUList(const std::string & sCPUs);
+
+      /**
+       * Converts a thread class to a string
+       *
+       * @param threadClass Thread class
+       *
+       * @return name
+       */
+      static std::string toString(ThreadClass threadClass);
+
+    protected:
+      ThreadPlacement();
+
+    private:
+      struct Row
+      {
+        ThreadClass threadClass_;
+        NEMId nemId_;
+        int iMemoryNode_;
+      };
+
+      std::mutex mutex_;
+      Policy policy_;
+      std::map<int,CPUs> nodes_;
+      std::map<NEMId,CPUs> packCPUs_;
+      std::map<pid_t,Row> threads_;
+      StatisticLazyTable<std::uint32_t,Row> * pThreadPlacementTable_;
+
+      void enter(ThreadClass threadClass, NEMId id);
+
+      void leave();
+
+      CPUs resolve(ThreadClass threadClass, NEMId id) const;
+
+      int getNode(const CPUs & cpus) const;
+    };
+  }
+}
+
+#endif // EMANEUTILSTHREADPLACEMENT_HEADER_
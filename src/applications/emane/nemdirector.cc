@@ -33,7 +33,26 @@
 
 #include "configurationparser.h"
 #include "nemdirector.h"
+#include "startupprofiler.h"
+#include "emane/utils/parameterconvert.h"
+#include "emane/utils/processingpool.h"
+
 #include <sstream>
+#include <chrono>
+#include <future>
+
+namespace
+{
+  template<typename Function>
+  EMANE::Microseconds timed(Function f)
+  {
+    auto start = std::chrono::steady_clock::now();
+
+    f();
+
+    return std::chrono::duration_cast<EMANE::Microseconds>(std::chrono::steady_clock::now() - start);
+  }
+}
 
 EMANE::Application::NEMDirector::NEMDirector(const std::string &filename,
                                              NEMBuilder &builder):
@@ -51,12 +70,74 @@ std::unique_ptr<EMANE::Application::NEMManager>
 EMANE::Application::NEMDirector::construct(const uuid_t & uuid)
 {
   NEMs nems;
-  
+
+  std::uint16_t u16StartupConcurrency{getStartupConcurrency()};
+
+  Utils::ProcessingPool pool;
+
+  std::vector<std::future<void>> results;
+
+  // workers configure any NEM, so they are not placed with the PHY
+  // processing pool workers
+  if(u16StartupConcurrency > 1)
+    {
+      pool.start(u16StartupConcurrency,0,Utils::ThreadPlacement::ThreadClass::STARTUP);
+    }
+
+  // NEMs are built, registered and initialized serially in
+  // configuration order so build ids are deterministic, the layer
+  // configure step of each NEM is handed to the pool (when enabled)
+  // and overlaps with building the remaining NEMs
   for(const auto & nemConfiguration : configPlatform_.getNEMs())
     {
-      nems.push_back(createNEM(nemConfiguration));
+      NEMId id{nemConfiguration->getNEMId()};
+
+      StartupProfiler::instance()->record(id,
+                                          StartupProfiler::Phase::PARSE,
+                                          nemConfiguration->getParseDuration());
+
+      LayerRequests layerRequests;
+
+      StartupProfiler::instance()->record(id,
+                                          StartupProfiler::Phase::LOAD,
+                                          timed([this,&nems,&nemConfiguration,&layerRequests]()
+                                                {
+                                                  nems.push_back(createNEM(nemConfiguration,
+                                                                           layerRequests));
+                                                }));
+
+      auto configure = [this,id,layerRequests]()
+        {
+          StartupProfiler::instance()->record(id,
+                                              StartupProfiler::Phase::CONFIGURE,
+                                              timed([this,&layerRequests]()
+                                                    {
+                                                      for(const auto & layerRequest : layerRequests)
+                                                        {
+                                                          rNEMBuilder_.configureLayer(*layerRequest.first,
+                                                                                      layerRequest.second);
+                                                        }
+                                                    }));
+        };
+
+      if(pool.isRunning())
+        {
+          results.push_back(pool.submit(configure));
+        }
+      else
+        {
+          configure();
+        }
+    }
+
+  // rethrows the first configure error in configuration order
+  for(auto & result : results)
+    {
+      result.get();
     }
 
+  pool.stop();
+
   /* Construct a platform first (initialized) */
   std::unique_ptr<NEMManager> 
     pPlatform{rNEMBuilder_.buildNEMManager(uuid,
@@ -67,8 +148,31 @@ EMANE::Application::NEMDirector::construct(const uuid_t & uuid)
   return pPlatform;
 }
 
+std::uint16_t EMANE::Application::NEMDirector::getStartupConcurrency()
+{
+  for(const auto & item : configPlatform_.getConfigurationUpdateRequest())
+    {
+      if(item.first == "startupconcurrency" && !item.second.empty())
+        {
+          try
+            {
+              return Utils::ParameterConvert(item.second[0]).toUINT16(1);
+            }
+          catch(Utils::ParameterConvert::ConversionException & exp)
+            {
+              throw makeException<ConfigureException>("NEMDirector: invalid startupconcurrency %s: %s",
+                                                      item.second[0].c_str(),
+                                                      exp.what());
+            }
+        }
+    }
+
+  return 1;
+}
+
 std::unique_ptr<EMANE::Application::NEM>
-EMANE::Application::NEMDirector::createNEM(EMANE::NEMConfiguration *pNEMConfig)
+EMANE::Application::NEMDirector::createNEM(EMANE::NEMConfiguration *pNEMConfig,
+                                           LayerRequests & layerRequests)
 {
   NEMLayers layers;
   if (pNEMConfig->isValid()) 
@@ -83,29 +187,41 @@ EMANE::Application::NEMDirector::createNEM(EMANE::NEMConfiguration *pNEMConfig)
               layers.push_back(rNEMBuilder_.buildPHYLayer(
                                    pNEMConfig->getNEMId(),
                                    (*layerIter)->getLibrary(),
-                                   (*layerIter)->getConfigurationUpdateRequest()));
+                                   (*layerIter)->getConfigurationUpdateRequest(),
+                                   true));
             }
           else if ((*layerIter)->getType() == "mac") 
             {
               layers.push_back(rNEMBuilder_.buildMACLayer(
                                    pNEMConfig->getNEMId(),
                                    (*layerIter)->getLibrary(),
-                                   (*layerIter)->getConfigurationUpdateRequest()));
+                                   (*layerIter)->getConfigurationUpdateRequest(),
+                                   true));
             }
           else if ((*layerIter)->getType() == "shim") 
             {
               layers.push_back(rNEMBuilder_.buildShimLayer(
                                    pNEMConfig->getNEMId(),
                                    (*layerIter)->getLibrary(),
-                                   (*layerIter)->getConfigurationUpdateRequest()));
+                                   (*layerIter)->getConfigurationUpdateRequest(),
+                                   true));
             }
            else if ((*layerIter)->getType() == "transport" && !pNEMConfig->isExternalTransport()) 
             {
               layers.push_back(rNEMBuilder_.buildTransportLayer(
                                    pNEMConfig->getNEMId(),
                                    (*layerIter)->getLibrary(),
-                                   (*layerIter)->getConfigurationUpdateRequest()));
+                                   (*layerIter)->getConfigurationUpdateRequest(),
+                                   true));
             }
+           else
+             {
+               continue;
+             }
+
+          // layer configure is deferred, the NEM retains ownership
+          layerRequests.push_back(std::make_pair(layers.back().get(),
+                                                 (*layerIter)->getConfigurationUpdateRequest()));
         }// end for layers    
     }// end if valid
   else 
@@ -41,6 +41,7 @@
 
 #include <string>
 #include <memory>
+#include <vector>
 #include <uuid.h>
 
 /**
@@ -83,16 +84,37 @@ namespace EMANE
       /**
        * Constructs the platform
        *
+       * NEMs are built and registered in configuration order. When
+       * the platform startupconcurrency parameter is greater than 1,
+       * layer configuration is performed on a bounded thread pool of
+       * that size. The per NEM startup timing breakdown is published
+       * via the platform StartupTimingTable.
+       *
        * @param uuid Application UUID
        */
       std::unique_ptr<NEMManager> construct(const uuid_t & uuid);
 
     private:
+      using LayerRequests =
+        std::vector<std::pair<NEMLayer *,ConfigurationUpdateRequest>>;
+
+      /**
+       * Gets the startup concurrency from the platform configuration
+       *
+       * @return Maximum number of NEMs configured concurrently
+       *
+       * @throw ConfigureException when the value is invalid
+       */
+      std::uint16_t getStartupConcurrency();
+
       /**
        * Uses the passed-in builder to create an NEM object and return
-       * a pointer to it.
+       * a pointer to it. Layers are built without being configured.
        *
        * @param pNEMConfig Pointer to the NEMConfiguration object for this NEM
+       * @param layerRequests Populated with the NEM layers and their
+       * configuration update requests, in stack order, for deferred
+       * configuration
        *
        * @retval a pointer to the newly created NEM object (memory
        *         ownership is trasferred to the caller).
@@ -105,7 +127,8 @@ namespace EMANE
        * @throw ConfigureException when an error occurs during
        * configure.
        */
-      std::unique_ptr<NEM> createNEM(EMANE::NEMConfiguration *pNEMConfig);
+      std::unique_ptr<NEM> createNEM(EMANE::NEMConfiguration *pNEMConfig,
+                                     LayerRequests & layerRequests);
 
       /**
        * Container for configuration data
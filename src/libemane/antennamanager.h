@@ -48,8 +48,8 @@ namespace EMANE
     {
       std::uint64_t u64UpdateSequence_{};
       Antenna antenna_{};
-      AntennaPattern * pPattern_{};
-      AntennaPattern * pBlockage_{};
+      const AntennaPattern * pPattern_{};
+      const AntennaPattern * pBlockage_{};
       PositionNEU placement_{};
 
       AntennaInfo();
@@ -251,3 +251,20 @@ double EMANE::AntennaPattern::getGain(std::int16_t iBearing,std::int16_t iElevat
 
   return dGain;
 }
+
+std::size_t EMANE::AntennaPattern::getBytes() const
+{
+  // estimate assuming a red-black tree node overhead of 4 words
+  const std::size_t nodeOverhead{4 * sizeof(void *)};
+
+  std::size_t bytes{sizeof(*this) +
+      elevationBearingGainMap_.size() * (sizeof(ElevationBearingGainMap::value_type) + nodeOverhead)};
+
+  for(const auto & pBearingGainMap : bearings_)
+    {
+      bytes += sizeof(BearingGainMap) +
+        pBearingGainMap->size() * (sizeof(BearingGainMap::value_type) + nodeOverhead);
+    }
+
+  return bytes;
+}
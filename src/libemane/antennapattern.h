@@ -49,6 +49,8 @@ namespace EMANE
       
       double getGain(std::int16_t iBearing,std::int16_t iElevation) const;
 
+      std::size_t getBytes() const;
+
     private:
       using BearingGainMap = std::map<std::int16_t,double>;
       using ElevationBearingGainMap = std::map<std::int16_t,BearingGainMap *>;
@@ -35,9 +35,28 @@
 #include "antennaprofileexception.h"
 #include "positionneu.h"
 #include "emane/constants.h"
+#include "emane/utils/assetcache.h"
 
 #include <libxml/parser.h>
 
+namespace
+{
+  std::shared_ptr<const EMANE::AntennaPattern>
+  loadAntennaPattern(const std::string & sAntennaPatternURI,
+                     const std::string & sSubRootName,
+                     double dMissingValue)
+  {
+    return EMANE::Utils::AssetCache::instance()->load<EMANE::AntennaPattern>(sSubRootName,
+                                                                           sAntennaPatternURI,
+                                                                           [&](const std::string & sURI)
+                                                                           {
+                                                                             return EMANE::AntennaPattern{sURI,
+                                                                                 sSubRootName,
+                                                                                 dMissingValue};
+                                                                           });
+  }
+}
+
 void EMANE::AntennaProfileManifest::load(const std::string & sAntennaProfileURI)
 {
   xmlParserCtxtPtr pContext{xmlNewParserCtxt()};
@@ -136,16 +155,17 @@ void EMANE::AntennaProfileManifest::load(const std::string & sAntennaProfileURI)
                     }
                 }
 
-              AntennaPattern * pAntennaPattern{};
+              const AntennaPattern * pAntennaPattern{};
 
               auto iter = antennaPatternStore_.find(sAntennaPatternURI);
 
               if(iter == antennaPatternStore_.end())
                 {
-                  pAntennaPattern = new AntennaPattern{sAntennaPatternURI,"antennapattern",DBM_MIN};
-                  
-                  antennaPatternStore_.insert(std::make_pair(sAntennaPatternURI,
-                                                             std::unique_ptr<AntennaPattern>(pAntennaPattern)));
+                  auto pPattern = loadAntennaPattern(sAntennaPatternURI,"antennapattern",DBM_MIN);
+
+                  pAntennaPattern = pPattern.get();
+
+                  antennaPatternStore_.insert(std::make_pair(sAntennaPatternURI,pPattern));
                 }
               else
                 {
@@ -153,7 +173,7 @@ void EMANE::AntennaProfileManifest::load(const std::string & sAntennaProfileURI)
                 }
 
               
-              AntennaPattern * pBlockagePattern{};
+              const AntennaPattern * pBlockagePattern{};
 
               if(!sBlockagePatternURI.empty())
                 {
@@ -161,10 +181,11 @@ void EMANE::AntennaProfileManifest::load(const std::string & sAntennaProfileURI)
 
                   if(iter == antennaPatternStore_.end())
                     {
-                      pBlockagePattern = new AntennaPattern{sBlockagePatternURI,"blockagepattern",0};
-                      
-                      antennaPatternStore_.insert(std::make_pair(sBlockagePatternURI,
-                                                                 std::unique_ptr<AntennaPattern>(pBlockagePattern)));
+                      auto pPattern = loadAntennaPattern(sBlockagePatternURI,"blockagepattern",0);
+
+                      pBlockagePattern = pPattern.get();
+
+                      antennaPatternStore_.insert(std::make_pair(sBlockagePatternURI,pPattern));
                     }
                   else
                     {
@@ -186,7 +207,7 @@ void EMANE::AntennaProfileManifest::load(const std::string & sAntennaProfileURI)
 }
 
 
-std::pair<std::tuple<EMANE::AntennaPattern *,EMANE::AntennaPattern *,EMANE::PositionNEU>,bool>
+std::pair<std::tuple<const EMANE::AntennaPattern *,const EMANE::AntennaPattern *,EMANE::PositionNEU>,bool>
 EMANE::AntennaProfileManifest::getProfileInfo(AntennaProfileId antennaProfileId) const
 {
   const auto iter = profiles_.find(antennaProfileId);
@@ -51,15 +51,15 @@ namespace EMANE
     void load(const std::string & sAntennaProfileURI);
 
     // PositionNEU - Antenna placement in platforms reference frame
-    std::pair<std::tuple<AntennaPattern *,AntennaPattern *,PositionNEU>,bool>
+    std::pair<std::tuple<const AntennaPattern *,const AntennaPattern *,PositionNEU>,bool>
     getProfileInfo(AntennaProfileId antennaProfileId) const;
 
   private:
     using AntennaPatternStore =
-      std::map<std::string,std::unique_ptr<AntennaPattern>>;
+      std::map<std::string,std::shared_ptr<const AntennaPattern>>;
 
     using Profiles = 
-      std::map<AntennaProfileId,std::tuple<AntennaPattern *,AntennaPattern *,PositionNEU>>;
+      std::map<AntennaProfileId,std::tuple<const AntennaPattern *,const AntennaPattern *,PositionNEU>>;
 
     AntennaPatternStore antennaPatternStore_;
     Profiles profiles_;
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "emane/utils/assetcache.h"
+#include "statisticregistrarproxy.h"
+
+#include <fstream>
+#include <climits>
+#include <cstdlib>
+
+namespace
+{
+  // 64-bit FNV-1a hash of the file contents
+  std::uint64_t hashFile(const std::string & sFileName)
+  {
+    std::uint64_t u64Hash{0xcbf29ce484222325ULL};
+
+    std::ifstream ifs{sFileName,std::ios::binary};
+
+    char buf[4096];
+
+    while(ifs.read(buf,sizeof(buf)) || ifs.gcount())
+      {
+        for(std::streamsize i = 0; i < ifs.gcount(); ++i)
+          {
+            u64Hash ^= static_cast<unsigned char>(buf[i]);
+            u64Hash *= 0x100000001b3ULL;
+          }
+      }
+
+    return u64Hash;
+  }
+}
+
+EMANE::Utils::AssetCache::AssetCache()
+{
+  auto statisticRegistrar = StatisticRegistrarProxy{*StatisticServiceSingleton::instance(),0};
+
+  pNumAssetCacheHits_ =
+    statisticRegistrar.registerNumeric<std::uint64_t>("numAssetCacheHits",
+                                                      StatisticProperties::NONE,
+                                                      "Number of asset loads satisfied by a shared instance.");
+
+  pNumAssetCacheMisses_ =
+    statisticRegistrar.registerNumeric<std::uint64_t>("numAssetCacheMisses",
+                                                      StatisticProperties::NONE,
+                                                      "Number of asset loads requiring a file parse.");
+
+  pAssetCacheBytesSaved_ =
+    statisticRegistrar.registerNumeric<std::uint64_t>("assetCacheBytesSaved",
+                                                      StatisticProperties::NONE,
+                                                      "Estimated bytes of asset memory saved by sharing.");
+}
+
+std::pair<std::shared_ptr<EMANE::Utils::AssetCache::Entry>,std::string>
+EMANE::Utils::AssetCache::getEntry(const std::string & sType,
+                                   const std::string & sFileName)
+{
+  std::string sResolvedFileName{sFileName};
+
+  char buf[PATH_MAX];
+
+  if(realpath(sFileName.c_str(),buf))
+    {
+      sResolvedFileName = buf;
+    }
+
+  Key key{sType,sResolvedFileName,hashFile(sResolvedFileName)};
+
+  std::lock_guard<std::mutex> m(mutex_);
+
+  auto & pEntry = cache_[key];
+
+  if(!pEntry)
+    {
+      pEntry = std::make_shared<Entry>();
+    }
+
+  return {pEntry,sResolvedFileName};
+}
+
+void EMANE::Utils::AssetCache::recordHit(std::size_t bytes)
+{
+  ++*pNumAssetCacheHits_;
+
+  *pAssetCacheBytesSaved_ += bytes;
+}
+
+void EMANE::Utils::AssetCache::recordMiss()
+{
+  ++*pNumAssetCacheMisses_;
+}
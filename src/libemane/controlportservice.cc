@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015,2017 - Adjacent Link LLC, Bridgewater, New Jersey
+ * Copyright (c) 2015,2017,2026 - Adjacent Link LLC, Bridgewater, New Jersey
  * All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
@@ -32,20 +32,27 @@
 
 #include "controlportservice.h"
 #include "controlportsession.h"
+#include "errorresponse.h"
 #include "socketexception.h"
+#include "emane/registrarexception.h"
+#include "emane/serializationexception.h"
+#include "emane/utils/threadplacement.h"
 
 #include <cstring>
-#include <map>
 #include <algorithm>
 #include <unistd.h>
 #include <sys/socket.h>
 #include <sys/eventfd.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
 
 
 EMANE::ControlPort::Service::Service():
   iSignalEvent_{},
   iSock_{},
-  thread_{}{}
+  iEpollFd_{},
+  thread_{},
+  u32SubscriptionId_{}{}
 
 void EMANE::ControlPort::Service::open(const INETAddr & endpoint)
 {
@@ -84,6 +91,16 @@ void EMANE::ControlPort::Service::open(const INETAddr & endpoint)
                                            strerror(errno));
     }
 
+  if((iEpollFd_ = epoll_create1(0)) < 0)
+    {
+      throw makeException<SocketException>("epoll_create1: %s",
+                                           strerror(errno));
+    }
+
+  addDescriptor(iSignalEvent_);
+
+  addDescriptor(iSock_);
+
   thread_ = std::thread(&Service::process,this);
 }
 
@@ -101,33 +118,37 @@ void EMANE::ControlPort::Service::close()
   thread_.join();
   ::close(iSock_);
   ::close(iSignalEvent_);
+  ::close(iEpollFd_);
 }
 
-void EMANE::ControlPort::Service::process()
+void EMANE::ControlPort::Service::addDescriptor(int iFd)
 {
-  std::map<int,std::unique_ptr<Session>> sessionMap;
+  epoll_event ev{};
+  ev.events = EPOLLIN;
+  ev.data.fd = iFd;
 
-  while(1)
+  if(epoll_ctl(iEpollFd_,EPOLL_CTL_ADD,iFd,&ev) < 0)
     {
-      int nfds{iSignalEvent_};
+      throw makeException<SocketException>("epoll_ctl: %s",
+                                           strerror(errno));
+    }
+}
 
-      fd_set rfds;
+void EMANE::ControlPort::Service::process()
+{
+  Utils::ThreadPlacement::Scope placement{Utils::ThreadPlacement::ThreadClass::CONTROL};
 
-      FD_ZERO(&rfds);
-      FD_SET(iSignalEvent_,&rfds);
-      FD_SET(iSock_,&rfds);
+  const int MAX_EVENTS{32};
 
-      nfds = std::max(iSock_,nfds);
+  epoll_event events[MAX_EVENTS];
 
-      for(const auto & entry : sessionMap)
-        {
-          FD_SET(entry.first,&rfds);
-          nfds = std::max(entry.first,nfds);
-        }
+  bool bRunning{true};
 
-      auto result = select(nfds+1,&rfds,nullptr,nullptr,nullptr);
+  while(bRunning)
+    {
+      int nfds{epoll_wait(iEpollFd_,events,MAX_EVENTS,-1)};
 
-      if(result == -1)
+      if(nfds == -1)
         {
           if(errno == EINTR)
             {
@@ -139,47 +160,322 @@ void EMANE::ControlPort::Service::process()
             }
         }
 
-      if(FD_ISSET(iSignalEvent_,&rfds))
+      for(int i = 0; i < nfds; ++i)
         {
-          break;
-        }
-
-      if(FD_ISSET(iSock_,&rfds))
-        {
-          int iNewFd{};
+          int iFd{events[i].data.fd};
 
-          if((iNewFd = accept(iSock_,nullptr,nullptr)) > 0)
+          if(iFd == iSignalEvent_)
             {
-              sessionMap.insert(std::make_pair(iNewFd,std::unique_ptr<Session>{new Session{}}));
+              bRunning = false;
+              break;
             }
-        }
-
-      auto iter = sessionMap.begin();
-
-      while(iter !=  sessionMap.end())
-        {
-          if(FD_ISSET(iter->first,&rfds))
+          else if(iFd == iSock_)
             {
-              // process the session data
-              if(iter->second->process(iter->first))
-                {
-                  ::close(iter->first);
-                  sessionMap.erase(iter++);
-                }
-              else
+              int iNewFd{};
+
+              if((iNewFd = accept(iSock_,nullptr,nullptr)) > 0)
                 {
-                  ++iter;
+                  sessionMap_.insert(std::make_pair(iNewFd,
+                                                    std::unique_ptr<Session>{new Session{*this}}));
+                  addDescriptor(iNewFd);
                 }
             }
+          else if(subscriptionMap_.count(iFd))
+            {
+              publish(iFd);
+            }
           else
             {
-              ++iter;
+              auto iter = sessionMap_.find(iFd);
+
+              // a session closed earlier in this batch is skipped
+              if(iter != sessionMap_.end())
+                {
+                  auto & session = *iter->second;
+
+                  int iResult{};
+
+                  // write buffered output before any new responses
+                  if(events[i].events & EPOLLOUT)
+                    {
+                      iResult = session.flush(iFd);
+                    }
+
+                  // process the session data
+                  if(!iResult && (events[i].events & ~EPOLLOUT))
+                    {
+                      iResult = session.process(iFd);
+                    }
+
+                  if(iResult)
+                    {
+                      closeSession(iFd);
+                    }
+                  else
+                    {
+                      updateOutputWait(iFd,session);
+                    }
+                }
             }
         }
     }
 
-  for(const auto & entry : sessionMap)
+  for(const auto & entry : subscriptionMap_)
+    {
+      ::close(entry.first);
+    }
+
+  subscriptionMap_.clear();
+
+  for(const auto & entry : sessionMap_)
     {
       ::close(entry.first);
     }
+
+  sessionMap_.clear();
+
+  outputWaitSessions_.clear();
+}
+
+void EMANE::ControlPort::Service::closeSession(int iSessionFd)
+{
+  auto iter = subscriptionMap_.begin();
+
+  while(iter != subscriptionMap_.end())
+    {
+      if(iter->second.iSessionFd_ == iSessionFd)
+        {
+          ::close(iter->first);
+          subscriptionMap_.erase(iter++);
+        }
+      else
+        {
+          ++iter;
+        }
+    }
+
+  ::close(iSessionFd);
+
+  sessionMap_.erase(iSessionFd);
+
+  outputWaitSessions_.erase(iSessionFd);
+}
+
+void EMANE::ControlPort::Service::updateOutputWait(int iSessionFd, const Session & session)
+{
+  bool bPending{session.hasPendingOutput()};
+
+  if(bPending != static_cast<bool>(outputWaitSessions_.count(iSessionFd)))
+    {
+      epoll_event ev{};
+      ev.events = bPending ? EPOLLIN | EPOLLOUT : EPOLLIN;
+      ev.data.fd = iSessionFd;
+
+      if(epoll_ctl(iEpollFd_,EPOLL_CTL_MOD,iSessionFd,&ev) < 0)
+        {
+          throw makeException<SocketException>("epoll_ctl: %s",
+                                               strerror(errno));
+        }
+
+      if(bPending)
+        {
+          outputWaitSessions_.insert(iSessionFd);
+        }
+      else
+        {
+          outputWaitSessions_.erase(iSessionFd);
+        }
+    }
+}
+
+std::string
+EMANE::ControlPort::Service::processSubscription(int iSessionFd,
+                                                 const EMANERemoteControlPortAPI::Request & request,
+                                                 std::uint32_t u32Sequence)
+{
+  EMANERemoteControlPortAPI::Response response;
+
+  if(request.type() == EMANERemoteControlPortAPI::Request::TYPE_REQUEST_SUBSCRIBE)
+    {
+      if(!request.has_subscribe())
+        {
+          return ErrorResponse::serialize(EMANERemoteControlPortAPI::Response::Error::TYPE_ERROR_MALFORMED,
+                                          "Subscribe request malformed: missing subscribe message",
+                                          u32Sequence,
+                                          request.sequence());
+        }
+
+      const auto & subscribe = request.subscribe();
+
+      if(!subscribe.intervalmilliseconds())
+        {
+          return ErrorResponse::serialize(EMANERemoteControlPortAPI::Response::Error::TYPE_ERROR_PARAMETER,
+                                          "Subscribe request interval must be greater than 0",
+                                          u32Sequence,
+                                          request.sequence());
+        }
+
+      std::unique_ptr<Subscription> pSubscription{};
+
+      try
+        {
+          pSubscription.reset(new Subscription{u32SubscriptionId_ + 1,
+                                               subscribe,
+                                               request.sequence()});
+        }
+      catch(RegistrarException & exp)
+        {
+          return ErrorResponse::serialize(EMANERemoteControlPortAPI::Response::Error::TYPE_ERROR_PARAMETER,
+                                          exp.what(),
+                                          u32Sequence,
+                                          request.sequence());
+        }
+
+      int iTimerFd{timerfd_create(CLOCK_MONOTONIC,0)};
+
+      if(iTimerFd < 0)
+        {
+          throw makeException<SocketException>("timerfd_create: %s",
+                                               strerror(errno));
+        }
+
+      itimerspec spec{};
+
+      spec.it_interval.tv_sec = subscribe.intervalmilliseconds() / 1000;
+      spec.it_interval.tv_nsec = (subscribe.intervalmilliseconds() % 1000) * 1000000;
+
+      // first publication is sent right away
+      spec.it_value.tv_nsec = 1;
+
+      timerfd_settime(iTimerFd,0,&spec,nullptr);
+
+      addDescriptor(iTimerFd);
+
+      subscriptionMap_.insert(std::make_pair(iTimerFd,
+                                             SubscriptionEntry{iSessionFd,
+                                                               std::move(pSubscription)}));
+
+      response.set_type(EMANERemoteControlPortAPI::Response::TYPE_RESPONSE_SUBSCRIBE);
+
+      response.mutable_subscribe()->set_subscriptionid(++u32SubscriptionId_);
+    }
+  else
+    {
+      if(!request.has_unsubscribe())
+        {
+          return ErrorResponse::serialize(EMANERemoteControlPortAPI::Response::Error::TYPE_ERROR_MALFORMED,
+                                          "Unsubscribe request malformed: missing unsubscribe message",
+                                          u32Sequence,
+                                          request.sequence());
+        }
+
+      auto u32SubscriptionId = request.unsubscribe().subscriptionid();
+
+      auto iter = std::find_if(subscriptionMap_.begin(),
+                               subscriptionMap_.end(),
+                               [iSessionFd,u32SubscriptionId](const SubscriptionMap::value_type & entry)
+                               {
+                                 return entry.second.iSessionFd_ == iSessionFd &&
+                                   entry.second.pSubscription_->getId() == u32SubscriptionId;
+                               });
+
+      if(iter == subscriptionMap_.end())
+        {
+          return ErrorResponse::serialize(EMANERemoteControlPortAPI::Response::Error::TYPE_ERROR_PARAMETER,
+                                          "Unknown subscription id",
+                                          u32Sequence,
+                                          request.sequence());
+        }
+
+      ::close(iter->first);
+
+      subscriptionMap_.erase(iter);
+
+      response.set_type(EMANERemoteControlPortAPI::Response::TYPE_RESPONSE_UNSUBSCRIBE);
+
+      response.mutable_unsubscribe()->set_subscriptionid(u32SubscriptionId);
+    }
+
+  response.set_reference(request.sequence());
+
+  response.set_sequence(u32Sequence);
+
+  std::string sSerialization;
+
+  if(!response.SerializeToString(&sSerialization))
+    {
+      throw SerializationException("unable to serialize subscription response");
+    }
+
+  return sSerialization;
+}
+
+void EMANE::ControlPort::Service::publish(int iTimerFd)
+{
+  std::uint64_t u64Expirations{};
+
+  if(read(iTimerFd,&u64Expirations,sizeof(u64Expirations)) != sizeof(u64Expirations))
+    {
+      return;
+    }
+
+  auto iter = subscriptionMap_.find(iTimerFd);
+
+  int iSessionFd{iter->second.iSessionFd_};
+
+  auto & session = *sessionMap_[iSessionFd];
+
+  auto & pSubscription = iter->second.pSubscription_;
+
+  EMANERemoteControlPortAPI::Response response;
+
+  try
+    {
+      if(!pSubscription->publish(response.mutable_publish()))
+        {
+          // nothing changed
+          return;
+        }
+
+      response.set_type(EMANERemoteControlPortAPI::Response::TYPE_RESPONSE_PUBLISH);
+    }
+  catch(RegistrarException & exp)
+    {
+      // the subscription is no longer valid
+      response.Clear();
+
+      response.set_type(EMANERemoteControlPortAPI::Response::TYPE_RESPONSE_ERROR);
+
+      auto pError = response.mutable_error();
+
+      pError->set_type(EMANERemoteControlPortAPI::Response::Error::TYPE_ERROR_PARAMETER);
+
+      pError->set_description(exp.what());
+    }
+
+  response.set_reference(pSubscription->getReference());
+
+  response.set_sequence(session.getNextSequence());
+
+  std::string sSerialization;
+
+  if(!response.SerializeToString(&sSerialization))
+    {
+      throw SerializationException("unable to serialize publish response");
+    }
+
+  // a subscriber unable to keep up is disconnected
+  if(!session.send(iSessionFd,sSerialization))
+    {
+      closeSession(iSessionFd);
+      return;
+    }
+
+  updateOutputWait(iSessionFd,session);
+
+  if(response.type() == EMANERemoteControlPortAPI::Response::TYPE_RESPONSE_ERROR)
+    {
+      ::close(iTimerFd);
+      subscriptionMap_.erase(iter);
+    }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015,2017 - Adjacent Link LLC, Bridgewater, New Jersey
+ * Copyright (c) 2015,2017,2026 - Adjacent Link LLC, Bridgewater, New Jersey
  * All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
@@ -34,12 +34,22 @@
 #define EMANECONTROLPORTSERVICE_HEADER_
 
 #include "emane/inetaddr.h"
+#include "controlportsubscription.h"
+#include "remotecontrolportapi.pb.h"
+
 #include <thread>
+#include <map>
+#include <set>
+#include <memory>
+#include <string>
+#include <cstdint>
 
 namespace EMANE
 {
   namespace ControlPort
   {
+    class Session;
+
     class Service
     {
     public:
@@ -51,12 +61,49 @@ namespace EMANE
 
       void close();
 
+      /**
+       * Processes a subscribe or unsubscribe request received by a
+       * session. Called from the service thread.
+       *
+       * @param iSessionFd Session socket descriptor
+       * @param request Subscription request
+       * @param u32Sequence Response sequence number
+       *
+       * @return serialized response
+       */
+      std::string processSubscription(int iSessionFd,
+                                      const EMANERemoteControlPortAPI::Request & request,
+                                      std::uint32_t u32Sequence);
+
     private:
+      struct SubscriptionEntry
+      {
+        int iSessionFd_;
+        std::unique_ptr<Subscription> pSubscription_;
+      };
+
+      // subscriptions keyed by timer descriptor
+      using SubscriptionMap = std::map<int,SubscriptionEntry>;
+
       int iSignalEvent_;
       int iSock_;
+      int iEpollFd_;
       std::thread thread_;
+      std::uint32_t u32SubscriptionId_;
+      std::map<int,std::unique_ptr<Session>> sessionMap_;
+      SubscriptionMap subscriptionMap_;
+      std::set<int> outputWaitSessions_;
+
       void process();
 
+      void publish(int iTimerFd);
+
+      void closeSession(int iSessionFd);
+
+      // polls a session for output while it has buffered output
+      void updateOutputWait(int iSessionFd, const Session & session);
+
+      void addDescriptor(int iFd);
     };
   }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2016 - Adjacent Link LLC, Bridgewater, New Jersey
+ * Copyright (c) 2013-2016,2026 - Adjacent Link LLC, Bridgewater, New Jersey
  * All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
@@ -31,14 +31,28 @@
  */
 
 #include "controlportsession.h"
+#include "controlportservice.h"
 #include "requestmessagehandler.h"
 #include "remotecontrolportapi.pb.h"
 
 #include <sys/socket.h>
 #include <arpa/inet.h>
 #include <sys/uio.h>
+#include <cerrno>
 
-EMANE::ControlPort::Session::Session():
+namespace
+{
+  // a subscriber that falls this far behind is disconnected
+  const size_t MAX_OUTPUT_BYTES{16777216};
+
+  bool isWouldBlock(int iError)
+  {
+    return iError == EAGAIN || iError == EWOULDBLOCK || iError == EINTR;
+  }
+}
+
+EMANE::ControlPort::Session::Session(Service & service):
+  service_(service),
   u32MessageSizeBytes_{},
   u32Sequence_{}{}
 
@@ -106,18 +120,22 @@ int EMANE::ControlPort::Session::process(int iFd)
               return -1;
             }
 
-          std::string sSerialization{RequestMessageHandler::process(request,
-                                                                    ++u32Sequence_)};
+          std::string sSerialization{};
 
-          std::uint32_t u32MessageFrameLength = htonl(sSerialization.size());
-
-          iovec iov[2] =
+          if(request.type() == EMANERemoteControlPortAPI::Request::TYPE_REQUEST_SUBSCRIBE ||
+             request.type() == EMANERemoteControlPortAPI::Request::TYPE_REQUEST_UNSUBSCRIBE)
+            {
+              sSerialization = service_.processSubscription(iFd,request,++u32Sequence_);
+            }
+          else
             {
-              {reinterpret_cast<char *>(&u32MessageFrameLength),sizeof(u32MessageFrameLength)},
-              {const_cast<char *>(sSerialization.c_str()),sSerialization.size()}
-            };
+              sSerialization = RequestMessageHandler::process(request,++u32Sequence_);
+            }
 
-          writev(iFd,iov,2);
+          if(!send(iFd,sSerialization))
+            {
+              return -1;
+            }
 
           message_.clear();
 
@@ -127,3 +145,92 @@ int EMANE::ControlPort::Session::process(int iFd)
 
   return 0;
 }
+
+bool EMANE::ControlPort::Session::send(int iFd, const std::string & sSerialization)
+{
+  std::uint32_t u32MessageFrameLength = htonl(sSerialization.size());
+
+  size_t total{sizeof(u32MessageFrameLength) + sSerialization.size()};
+
+  size_t written{};
+
+  // nothing may be written ahead of output already waiting
+  if(output_.empty())
+    {
+      iovec iov[2] =
+        {
+          {reinterpret_cast<char *>(&u32MessageFrameLength),sizeof(u32MessageFrameLength)},
+          {const_cast<char *>(sSerialization.c_str()),sSerialization.size()}
+        };
+
+      msghdr msg{};
+      msg.msg_iov = iov;
+      msg.msg_iovlen = 2;
+
+      ssize_t length{sendmsg(iFd,&msg,MSG_DONTWAIT | MSG_NOSIGNAL)};
+
+      if(length < 0)
+        {
+          if(!isWouldBlock(errno))
+            {
+              return false;
+            }
+        }
+      else
+        {
+          written = length;
+        }
+    }
+
+  if(written < total)
+    {
+      if(output_.size() + total - written > MAX_OUTPUT_BYTES)
+        {
+          return false;
+        }
+
+      auto pFrameLength = reinterpret_cast<const char *>(&u32MessageFrameLength);
+
+      if(written < sizeof(u32MessageFrameLength))
+        {
+          output_.insert(output_.end(),
+                         pFrameLength + written,
+                         pFrameLength + sizeof(u32MessageFrameLength));
+
+          written = sizeof(u32MessageFrameLength);
+        }
+
+      output_.insert(output_.end(),
+                     sSerialization.begin() + (written - sizeof(u32MessageFrameLength)),
+                     sSerialization.end());
+    }
+
+  return true;
+}
+
+int EMANE::ControlPort::Session::flush(int iFd)
+{
+  if(!output_.empty())
+    {
+      ssize_t length{::send(iFd,output_.data(),output_.size(),MSG_DONTWAIT | MSG_NOSIGNAL)};
+
+      if(length < 0)
+        {
+          return isWouldBlock(errno) ? 0 : -1;
+        }
+
+      output_.erase(output_.begin(),output_.begin() + length);
+    }
+
+  return 0;
+}
+
+bool EMANE::ControlPort::Session::hasPendingOutput() const
+{
+  return !output_.empty();
+}
+
+std::uint32_t EMANE::ControlPort::Session::getNextSequence()
+{
+  return ++u32Sequence_;
+}
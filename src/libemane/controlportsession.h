@@ -34,23 +34,59 @@
 #define EMANECONTROLPORTSESSION_HEADER_
 
 #include <vector>
+#include <string>
 #include <cstdint>
 
 namespace EMANE
 {
   namespace ControlPort
   {
+    class Service;
+
     class Session
     {
     public:
-      Session();
+      Session(Service & service);
 
       int process(int iFd);
 
+      /**
+       * Sends a length prefix framed message without blocking. Any
+       * portion the socket does not accept is held in the session
+       * output buffer, behind output already waiting.
+       *
+       * @param iFd Session socket descriptor
+       * @param sSerialization Serialized response message
+       *
+       * @return false if the session must be closed due to a write
+       * error or output buffer overflow
+       */
+      bool send(int iFd, const std::string & sSerialization);
+
+      /**
+       * Writes as much buffered output as the socket accepts
+       *
+       * @param iFd Session socket descriptor
+       *
+       * @return 0 on success, -1 if the session must be closed
+       */
+      int flush(int iFd);
+
+      /**
+       * Checks if output is waiting for the socket to become writable
+       *
+       * @return true if output is buffered
+       */
+      bool hasPendingOutput() const;
+
+      std::uint32_t getNextSequence();
+
     private:
+      Service & service_;
       std::uint32_t u32MessageSizeBytes_;
       std::vector<char> message_;
       std::uint32_t u32Sequence_;
+      std::vector<char> output_;
     };
   }
 }
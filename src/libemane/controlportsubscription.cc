@@ -0,0 +1,320 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "controlportsubscription.h"
+#include "statisticservice.h"
+#include "anyutils.h"
+
+#include <algorithm>
+
+namespace
+{
+  bool isEqual(const EMANE::Any & lhs, const EMANE::Any & rhs)
+  {
+    if(lhs.getType() != rhs.getType())
+      {
+        return false;
+      }
+
+    // INETAddr values are not ordered
+    if(lhs.getType() == EMANE::Any::Type::TYPE_INET_ADDR)
+      {
+        return lhs.toString() == rhs.toString();
+      }
+
+    return !(lhs < rhs) && !(rhs < lhs);
+  }
+
+  bool isEqual(const EMANE::StatisticTableValues & lhs,
+               const EMANE::StatisticTableValues & rhs)
+  {
+    return std::equal(lhs.begin(),
+                      lhs.end(),
+                      rhs.begin(),
+                      rhs.end(),
+                      [](const std::vector<EMANE::Any> & lhsRow,
+                         const std::vector<EMANE::Any> & rhsRow)
+                      {
+                        return std::equal(lhsRow.begin(),
+                                          lhsRow.end(),
+                                          rhsRow.begin(),
+                                          rhsRow.end(),
+                                          [](const EMANE::Any & lhsValue,
+                                             const EMANE::Any & rhsValue)
+                                          {
+                                            return isEqual(lhsValue,rhsValue);
+                                          });
+                      });
+  }
+
+  template<typename T>
+  void addNames(std::map<EMANE::BuildId,std::vector<std::string>> & namesMap,
+                const T & query)
+  {
+    std::vector<std::string> names{query.names().begin(),query.names().end()};
+
+    auto iter = namesMap.find(query.buildid());
+
+    if(iter == namesMap.end())
+      {
+        namesMap.insert(std::make_pair(query.buildid(),std::move(names)));
+      }
+    else if(!iter->second.empty())
+      {
+        // no names is all names
+        if(names.empty())
+          {
+            iter->second.clear();
+          }
+        else
+          {
+            iter->second.insert(iter->second.end(),names.begin(),names.end());
+          }
+      }
+  }
+}
+
+EMANE::ControlPort::Subscription::Subscription(std::uint32_t u32Id,
+                                               const EMANERemoteControlPortAPI::Request::Subscribe & subscribe,
+                                               std::uint32_t u32Reference):
+  u32Id_{u32Id},
+  u32Reference_{u32Reference},
+  u32IntervalMilliseconds_{subscribe.intervalmilliseconds()},
+  u32MaxValues_{subscribe.maxvalues()}
+{
+  for(const auto & statistic : subscribe.statistics())
+    {
+      addNames(statisticNames_,statistic);
+    }
+
+  for(const auto & statisticTable : subscribe.statistictables())
+    {
+      addNames(tableNames_,statisticTable);
+    }
+
+  // verify the requested names, the first publication sends everything
+  for(const auto & entry : statisticNames_)
+    {
+      StatisticServiceSingleton::instance()->queryStatistic(entry.first,entry.second);
+    }
+
+  for(const auto & entry : tableNames_)
+    {
+      StatisticServiceSingleton::instance()->queryTable(entry.first,entry.second);
+    }
+}
+
+std::uint32_t EMANE::ControlPort::Subscription::getId() const
+{
+  return u32Id_;
+}
+
+std::uint32_t EMANE::ControlPort::Subscription::getReference() const
+{
+  return u32Reference_;
+}
+
+std::uint32_t EMANE::ControlPort::Subscription::getIntervalMilliseconds() const
+{
+  return u32IntervalMilliseconds_;
+}
+
+bool EMANE::ControlPort::Subscription::publish(EMANERemoteControlPortAPI::Response::Publish * pPublish)
+{
+  std::map<Key,Any> statistics;
+
+  std::map<Key,Table> tables;
+
+  for(const auto & entry : statisticNames_)
+    {
+      for(auto & value : StatisticServiceSingleton::instance()->queryStatistic(entry.first,
+                                                                               entry.second))
+        {
+          statistics.insert(std::make_pair(Key{false,entry.first,value.first},
+                                           std::move(value.second)));
+        }
+    }
+
+  for(const auto & entry : tableNames_)
+    {
+      for(auto & value : StatisticServiceSingleton::instance()->queryTable(entry.first,
+                                                                           entry.second))
+        {
+          tables.insert(std::make_pair(Key{true,entry.first,value.first},
+                                       std::move(value.second)));
+        }
+    }
+
+  // changed keys in key order: statistics then tables
+  std::vector<Key> changed;
+
+  for(const auto & entry : statistics)
+    {
+      auto iter = statisticSnapshot_.find(entry.first);
+
+      if(iter == statisticSnapshot_.end() || !isEqual(iter->second,entry.second))
+        {
+          changed.push_back(entry.first);
+        }
+    }
+
+  for(const auto & entry : tables)
+    {
+      auto iter = tableSnapshot_.find(entry.first);
+
+      if(iter == tableSnapshot_.end() ||
+         iter->second.first != entry.second.first ||
+         !isEqual(iter->second.second,entry.second.second))
+        {
+          changed.push_back(entry.first);
+        }
+    }
+
+  if(changed.empty())
+    {
+      return false;
+    }
+
+  pPublish->set_subscriptionid(u32Id_);
+
+  std::map<BuildId,EMANERemoteControlPortAPI::Response::Query::Statistic *> statisticMessages;
+
+  std::map<BuildId,EMANERemoteControlPortAPI::Response::Query::StatisticTable *> tableMessages;
+
+  // resume where the previous limited publication stopped
+  auto start = std::lower_bound(changed.begin(),changed.end(),cursor_);
+
+  if(start == changed.end())
+    {
+      start = changed.begin();
+    }
+
+  std::rotate(changed.begin(),start,changed.end());
+
+  std::uint32_t u32Values{};
+
+  bool bComplete{true};
+
+  for(const auto & key : changed)
+    {
+      const auto & buildId = std::get<1>(key);
+
+      const auto & sName = std::get<2>(key);
+
+      if(!std::get<0>(key))
+        {
+          if(u32MaxValues_ && u32Values && u32Values + 1 > u32MaxValues_)
+            {
+              cursor_ = key;
+              bComplete = false;
+              break;
+            }
+
+          auto & value = statistics.find(key)->second;
+
+          auto & pStatistic = statisticMessages[buildId];
+
+          if(!pStatistic)
+            {
+              pStatistic = pPublish->add_statistics();
+              pStatistic->set_buildid(buildId);
+            }
+
+          auto pElement = pStatistic->add_elements();
+
+          pElement->set_name(sName);
+
+          convertToAny(pElement->mutable_value(),value);
+
+          ++u32Values;
+
+          statisticSnapshot_.insert_or_assign(key,std::move(value));
+        }
+      else
+        {
+          auto & table = tables.find(key)->second;
+
+          std::uint32_t u32Cost{};
+
+          for(const auto & row : table.second)
+            {
+              u32Cost += row.size();
+            }
+
+          u32Cost = std::max(u32Cost,1U);
+
+          // always send at least one changed item so large tables
+          // are not starved
+          if(u32MaxValues_ && u32Values && u32Values + u32Cost > u32MaxValues_)
+            {
+              cursor_ = key;
+              bComplete = false;
+              break;
+            }
+
+          auto & pStatisticTable = tableMessages[buildId];
+
+          if(!pStatisticTable)
+            {
+              pStatisticTable = pPublish->add_statistictables();
+              pStatisticTable->set_buildid(buildId);
+            }
+
+          auto pTable = pStatisticTable->add_tables();
+
+          pTable->set_name(sName);
+
+          for(const auto & row : table.second)
+            {
+              auto pRow = pTable->add_rows();
+
+              for(const auto & any : row)
+                {
+                  convertToAny(pRow->add_values(),any);
+                }
+            }
+
+          for(const auto & sLabel : table.first)
+            {
+              pTable->add_labels(sLabel);
+            }
+
+          u32Values += u32Cost;
+
+          tableSnapshot_.insert_or_assign(key,std::move(table));
+        }
+    }
+
+  pPublish->set_complete(bComplete);
+
+  return true;
+}
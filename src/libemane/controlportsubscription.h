@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANECONTROLPORTSUBSCRIPTION_HEADER_
+#define EMANECONTROLPORTSUBSCRIPTION_HEADER_
+
+#include "emane/types.h"
+#include "emane/any.h"
+#include "emane/statistictablepublisher.h"
+#include "remotecontrolportapi.pb.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <map>
+#include <tuple>
+
+namespace EMANE
+{
+  namespace ControlPort
+  {
+    /**
+     * @class Subscription
+     *
+     * @brief Periodic statistic and statistic table publication
+     * state for a control port client subscription.
+     *
+     * A subscription keeps the last published value of every
+     * monitored statistic element and table and only serializes
+     * values that changed. A changed table is published in its
+     * entirety. When a value limit is specified, changes that do
+     * not fit are deferred to the next publication, starting where
+     * the previous publication left off.
+     *
+     * @note Change detection requires every monitored statistic and
+     * table to be queried each interval. The value limit bounds the
+     * size of a publication, not the cost of the statistic queries
+     * made against the NEM layers.
+     */
+    class Subscription
+    {
+    public:
+      /**
+       * Creates a subscription
+       *
+       * @param u32Id Subscription id
+       * @param subscribe Subscribe request
+       * @param u32Reference Subscribe request sequence number
+       *
+       * @throw RegistrarException when a requested statistic or
+       * table name is unknown.
+       */
+      Subscription(std::uint32_t u32Id,
+                   const EMANERemoteControlPortAPI::Request::Subscribe & subscribe,
+                   std::uint32_t u32Reference);
+
+      std::uint32_t getId() const;
+
+      std::uint32_t getReference() const;
+
+      std::uint32_t getIntervalMilliseconds() const;
+
+      /**
+       * Populates a publish message with the changed values
+       *
+       * @param pPublish Publish message to populate
+       *
+       * @return @a true if at least one value changed
+       *
+       * @throw RegistrarException when a requested statistic or
+       * table name is no longer known.
+       */
+      bool publish(EMANERemoteControlPortAPI::Response::Publish * pPublish);
+
+    private:
+      using Names = std::vector<std::string>;
+      using Table = std::pair<StatisticTableLabels,StatisticTableValues>;
+      using Key = std::tuple<bool,BuildId,std::string>;
+
+      std::uint32_t u32Id_;
+      std::uint32_t u32Reference_;
+      std::uint32_t u32IntervalMilliseconds_;
+      std::uint32_t u32MaxValues_;
+      std::map<BuildId,Names> statisticNames_;
+      std::map<BuildId,Names> tableNames_;
+      std::map<Key,Any> statisticSnapshot_;
+      std::map<Key,Table> tableSnapshot_;
+      Key cursor_;
+    };
+  }
+}
+
+#endif // EMANECONTROLPORTSUBSCRIPTION_HEADER_
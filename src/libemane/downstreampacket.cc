@@ -56,6 +56,28 @@ public:
     totalLengthBytes_ += size;
   }
 
+  Implementation(const PacketInfo & info, const Utils::VectorIO & vectorIO):
+    pShared_{std::make_shared<Shared>()}
+  {
+    size_t size{};
+
+    for(const auto & iov : vectorIO)
+      {
+        size += iov.iov_len;
+      }
+
+    pShared_->segment_.reserve(size);
+
+    for(const auto & iov : vectorIO)
+      {
+        pShared_->segment_.append(static_cast<const char *>(iov.iov_base),iov.iov_len);
+      }
+
+    pShared_->info_ = info;
+
+    totalLengthBytes_ += size;
+  }
+
   void prepend(const void * buf, size_t size)
   {
     const unsigned char * c = static_cast<const unsigned char *>(buf);
@@ -92,6 +114,16 @@ public:
     return totalLengthBytes_;
   }
 
+  Microseconds stampTrace(const TimePoint & now)
+  {
+    TimePoint previous{traceTime_ == TimePoint{} ?
+        pShared_->info_.getCreationTime() : traceTime_};
+
+    traceTime_ = now;
+
+    return std::chrono::duration_cast<Microseconds>(now - previous);
+  }
+
   const PacketInfo & getPacketInfo() const
   {
     return pShared_->info_;
@@ -142,6 +174,7 @@ private:
   Segments segments_{};
   PacketSegment::size_type totalLengthBytes_{};
   AttachedEvents attachedEvents_{};
+  TimePoint traceTime_{};
   std::shared_ptr<Shared> pShared_;
 };
 
@@ -150,6 +183,10 @@ EMANE::DownstreamPacket::DownstreamPacket(const  EMANE::PacketInfo & info,
                                           size_t size):
   pImpl_{new Implementation{info,buf,size}}{}
 
+EMANE::DownstreamPacket::DownstreamPacket(const  EMANE::PacketInfo & info,
+                                          const Utils::VectorIO & vectorIO):
+  pImpl_{new Implementation{info,vectorIO}}{}
+
 
 EMANE::DownstreamPacket::DownstreamPacket(const DownstreamPacket & pkt):
   pImpl_{new Implementation{*pkt.pImpl_}}{}
@@ -211,3 +248,8 @@ EMANE::DownstreamPacket::getEventSerializations() const
 {
   return pImpl_->getEventSerializations();
 }
+
+EMANE::Microseconds EMANE::DownstreamPacket::stampTrace(const TimePoint & now)
+{
+  return pImpl_->stampTrace(now);
+}
@@ -38,19 +38,54 @@
 #include "logservice.h"
 #include "eventservice.h"
 #include "socketexception.h"
+#include "otamanager.h"
 
+#include "emane/serializationexception.h"
+#include "emane/events/antennaprofileevent.h"
+#include "emane/events/fadingselectionevent.h"
+#include "emane/events/locationevent.h"
+#include "emane/events/pathlossevent.h"
 #include "emane/utils/vectorio.h"
 #include "emane/utils/threadutils.h"
+#include "emane/utils/threadplacement.h"
 #include "emane/net.h"
 
+#include <google/protobuf/arena.h>
+
 #include <sstream>
+#include <array>
+#include <vector>
+
+namespace
+{
+  // maximum number of event datagrams drained per receive
+  const unsigned int MAX_EVENT_BATCH{16};
+
+  const size_t MAX_EVENT_DATAGRAM_SIZE{65536};
+
+  // batches parsing beyond the initial arena block allocate
+  // additional blocks that are released on arena reset
+  const size_t EVENT_ARENA_BLOCK_SIZE{262144};
+}
 
 EMANE::EventService::EventService():
+  bEventCoalescingEnable_{},
   bOpen_{false},
   eventStatisticPublisher_{"EventChannel"},
   u64SequenceNumber_{}
 {
   uuid_clear(uuid_);
+
+  // events delivered to every PHY on the platform are decoded once
+  registerEventDecoder<Events::AntennaProfileEvent>();
+  registerEventDecoder<Events::FadingSelectionEvent>();
+  registerEventDecoder<Events::LocationEvent>();
+  registerEventDecoder<Events::PathlossEvent>();
+
+  // idempotent state events that may be coalesced while queued
+  registerEventCoalescer(&Events::AntennaProfileEvent::getAntennaProfiles);
+  registerEventCoalescer(&Events::LocationEvent::getLocations);
+  registerEventCoalescer(&Events::PathlossEvent::getPathlosses);
 }
 
 
@@ -82,6 +117,41 @@ void EMANE::EventService::registerEvent(BuildId buildId, EventId eventId)
     }
 }
 
+void EMANE::EventService::registerEventDecoder(EventId eventId, EventDecoder decoder)
+{
+  eventDecoderMap_[eventId] = std::move(decoder);
+}
+
+void EMANE::EventService::registerEventCoalescer(EventId eventId, EventCoalescer coalescer)
+{
+  eventCoalescerMap_[eventId] = std::move(coalescer);
+}
+
+void EMANE::EventService::setEventCoalescingEnable(bool bEnable)
+{
+  bEventCoalescingEnable_ = bEnable;
+}
+
+bool EMANE::EventService::isEventCoalescable(EventId eventId) const
+{
+  return bEventCoalescingEnable_ && eventCoalescerMap_.count(eventId);
+}
+
+std::shared_ptr<const EMANE::Event>
+EMANE::EventService::coalesceEvent(EventId eventId,
+                                   const Event & older,
+                                   const Event & newer) const
+{
+  auto iter = eventCoalescerMap_.find(eventId);
+
+  if(iter != eventCoalescerMap_.end())
+    {
+      return iter->second(older,newer);
+    }
+
+  return {};
+}
+
 void EMANE::EventService::registerEventServiceUser(BuildId buildId,
                                                    EventServiceUser * pEventServiceUser,
                                                    NEMId nemId)
@@ -162,10 +232,18 @@ void EMANE::EventService::sendEvent(BuildId buildId,
                                     EventId eventId,
                                     const Serialization & serialization) const
 {
+  // locally published events are captured along with those received
+  // on the event channel, which skips events sourced by this instance
+  OTAManagerSingleton::instance()->captureEvent(Clock::now(),
+                                                nemId,
+                                                eventId,
+                                                serialization);
 
   // determine if there are any locally registered users for this event
   const auto ret = eventRegistrationMap_.equal_range(eventId);
 
+  DecodedEvent decodedEvent{};
+
   // for each local event service user registered for this event
   // determine based on the nemId target whether they should
   // receive the event. The source (base on buildId) will never
@@ -186,7 +264,7 @@ void EMANE::EventService::sendEvent(BuildId buildId,
         {
           if(!nemId || registeredNEMId == nemId)
             {
-              pEventServiceUser->processEvent(eventId,serialization);
+              dispatch(pEventServiceUser,eventId,serialization,decodedEvent);
             }
         }
       else
@@ -278,6 +356,8 @@ void EMANE::EventService::processEventMessage(NEMId nemId,
 {
   const auto ret = eventRegistrationMap_.equal_range(eventId);
 
+  DecodedEvent decodedEvent{};
+
   for(EventRegistrationMap::const_iterator iter = ret.first;
       iter != ret.second;
       ++iter)
@@ -292,7 +372,7 @@ void EMANE::EventService::processEventMessage(NEMId nemId,
         {
           if(!nemId || registeredNEMId == nemId)
             {
-              pEventServiceUser->processEvent(eventId,serialization);
+              dispatch(pEventServiceUser,eventId,serialization,decodedEvent);
             }
         }
       else
@@ -308,6 +388,49 @@ void EMANE::EventService::processEventMessage(NEMId nemId,
     }
 }
 
+void EMANE::EventService::dispatch(EventServiceUser * pEventServiceUser,
+                                   EventId eventId,
+                                   const Serialization & serialization,
+                                   DecodedEvent & decodedEvent) const
+{
+  // decode on first use, so that an event with no local recipients
+  // is never decoded and one with many is decoded once
+  if(!decodedEvent.first)
+    {
+      decodedEvent.first = true;
+
+      auto iter = eventDecoderMap_.find(eventId);
+
+      if(iter != eventDecoderMap_.end())
+        {
+          try
+            {
+              decodedEvent.second = iter->second(serialization);
+            }
+          catch(SerializationException & exp)
+            {
+              // fall back to raw delivery, each user will handle the error
+              LOGGER_STANDARD_LOGGING(*LogServiceSingleton::instance(),
+                                      ERROR_LEVEL,
+                                      "EventService unable to decode event id:%hu %s",
+                                      eventId,
+                                      exp.what());
+            }
+        }
+    }
+
+  if(decodedEvent.second)
+    {
+      pEventServiceUser->processDecodedEvent(eventId,
+                                             decodedEvent.second,
+                                             serialization);
+    }
+  else
+    {
+      pEventServiceUser->processEvent(eventId,serialization);
+    }
+}
+
 void EMANE::EventService::setStatEventCountRowLimit(size_t rows)
 {
   eventStatisticPublisher_.setRowLimit(rows);
@@ -315,8 +438,27 @@ void EMANE::EventService::setStatEventCountRowLimit(size_t rows)
 
 void  EMANE::EventService::process()
 {
-  std::uint8_t buf[65536];
-  ssize_t len = 0;
+  Utils::ThreadPlacement::Scope placement{Utils::ThreadPlacement::ThreadClass::EVENT};
+
+  // each batch slot holds one complete event datagram
+  std::vector<std::uint8_t> buffers(MAX_EVENT_BATCH * MAX_EVENT_DATAGRAM_SIZE);
+  std::array<iovec,MAX_EVENT_BATCH> iovecs{};
+  std::array<mmsghdr,MAX_EVENT_BATCH> msgs{};
+
+  for(size_t i = 0; i < MAX_EVENT_BATCH; ++i)
+    {
+      iovecs[i].iov_base = &buffers[i * MAX_EVENT_DATAGRAM_SIZE];
+      iovecs[i].iov_len = MAX_EVENT_DATAGRAM_SIZE;
+      msgs[i].msg_hdr.msg_iov = &iovecs[i];
+      msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+  // event messages of a batch are parsed into the arena, which is
+  // reset once the batch is processed
+  std::vector<char> arenaBlock(EVENT_ARENA_BLOCK_SIZE);
+  google::protobuf::Arena arena{arenaBlock.data(),arenaBlock.size()};
+
+  int iMessages{};
 
   LOGGER_STANDARD_LOGGING(*LogServiceSingleton::instance(),
                           DEBUG_LEVEL,
@@ -324,73 +466,108 @@ void  EMANE::EventService::process()
 
   while(1)
     {
-      if((len = mcast_.recv(buf,sizeof(buf),0)) > 0)
+      // block for the first datagram and drain any others already queued
+      if((iMessages = mcast_.recvmmsg(msgs.data(),MAX_EVENT_BATCH,MSG_WAITFORONE)) > 0)
+        {
+          for(int i = 0; i < iMessages; ++i)
+            {
+              handleEventMessage(static_cast<std::uint8_t *>(iovecs[i].iov_base),
+                                 msgs[i].msg_len,
+                                 arena);
+            }
+
+          arena.Reset();
+        }
+      else
         {
           LOGGER_STANDARD_LOGGING(*LogServiceSingleton::instance(),
-                                  DEBUG_LEVEL,
-                                  "EventService packet received len: %zd",
-                                  len);
+                                  ERROR_LEVEL,
+                                  "EventService Packet Receive error");
+          break;
+        }
+    }
+}
+
+void EMANE::EventService::handleEventMessage(std::uint8_t * buf,
+                                             size_t len,
+                                             google::protobuf::Arena & arena)
+{
+  LOGGER_STANDARD_LOGGING(*LogServiceSingleton::instance(),
+                          DEBUG_LEVEL,
+                          "EventService packet received len: %zu",
+                          len);
+
+  if(len < sizeof(std::uint16_t))
+    {
+      LOGGER_STANDARD_LOGGING(*LogServiceSingleton::instance(),
+                              ERROR_LEVEL,
+                              "EventService unable to deserialize event");
+      return;
+    }
+
+  std::uint16_t * pu16Length{reinterpret_cast<std::uint16_t *>(buf)};
+
+  *pu16Length = NTOHS(*pu16Length);
 
-          std::uint16_t * pu16Length{reinterpret_cast<std::uint16_t *>(buf)};
+  len -= sizeof(std::uint16_t);
 
-          *pu16Length = NTOHS(*pu16Length);
+  auto pMsg = google::protobuf::Arena::CreateMessage<EMANEMessage::Event>(&arena);
 
-          len -= sizeof(std::uint16_t);
+  if(len == *pu16Length &&
+     pMsg->ParseFromArray(&buf[2], *pu16Length))
+    {
+      uuid_t remoteUUID;
+      uuid_copy(remoteUUID,reinterpret_cast<const unsigned char *>(pMsg->uuid().data()));
 
-          EMANEMessage::Event msg;
+      // only process multicast events that were not sourced locally
+      if(uuid_compare(uuid_,remoteUUID))
+        {
+          auto now = Clock::now();
 
-          if(static_cast<size_t>(len) == *pu16Length &&
-             msg.ParseFromArray(&buf[2], *pu16Length))
+          for(const auto & serialization : pMsg->data().serializations())
             {
-              uuid_t remoteUUID;
-              uuid_copy(remoteUUID,reinterpret_cast<const unsigned char *>(msg.uuid().data()));
+              NEMId nemId{static_cast<NEMId>(serialization.nemid())};
+
+              EventId eventId{static_cast<EventId>(serialization.eventid())};
+
+              OTAManagerSingleton::instance()->captureEvent(now,
+                                                            nemId,
+                                                            eventId,
+                                                            serialization.data());
 
-              // only process multicast events that were not sourced locally
-              if(uuid_compare(uuid_,remoteUUID))
+              const auto ret = eventRegistrationMap_.equal_range(eventId);
+
+              DecodedEvent decodedEvent{};
+
+              for(EventRegistrationMap::const_iterator iter = ret.first;
+                  iter != ret.second;
+                  ++iter)
                 {
-                  for(const auto & serialization : msg.data().serializations())
+                  BuildId registeredBuildId{};
+                  NEMId registeredNEMId{};
+                  EventServiceUser * pEventServiceUser{};
+
+                  std::tie(registeredBuildId,registeredNEMId,pEventServiceUser) = iter->second;
+
+                  if(!nemId || !registeredNEMId || registeredNEMId == nemId)
                     {
-                      NEMId nemId{static_cast<NEMId>(serialization.nemid())};
-
-                      const auto ret = eventRegistrationMap_.equal_range(static_cast<EventId>(serialization.eventid()));
-
-                      for(EventRegistrationMap::const_iterator iter = ret.first;
-                          iter != ret.second;
-                          ++iter)
-                        {
-                          BuildId registeredBuildId{};
-                          NEMId registeredNEMId{};
-                          EventServiceUser * pEventServiceUser{};
-
-                          std::tie(registeredBuildId,registeredNEMId,pEventServiceUser) = iter->second;
-
-                          if(!nemId || !registeredNEMId || registeredNEMId == nemId)
-                            {
-                              pEventServiceUser->processEvent(static_cast<EventId>(serialization.eventid()),
-                                                              serialization.data());
-                            }
-                        }
-
-                      eventStatisticPublisher_.update(EventStatisticPublisher::Type::TYPE_RX,
-                                                      remoteUUID,
-                                                      serialization.eventid());
+                      dispatch(pEventServiceUser,
+                               eventId,
+                               serialization.data(),
+                               decodedEvent);
                     }
                 }
-            }
-          else
-            {
-              LOGGER_STANDARD_LOGGING(*LogServiceSingleton::instance(),
-                                      ERROR_LEVEL,
-                                      "EventService unable to deserialize event");
+
+              eventStatisticPublisher_.update(EventStatisticPublisher::Type::TYPE_RX,
+                                              remoteUUID,
+                                              serialization.eventid());
             }
         }
-      else
-        {
-          LOGGER_STANDARD_LOGGING(*LogServiceSingleton::instance(),
-                                  ERROR_LEVEL,
-                                  "EventService Packet Receive error");
-          break;
-        }
     }
-
+  else
+    {
+      LOGGER_STANDARD_LOGGING(*LogServiceSingleton::instance(),
+                              ERROR_LEVEL,
+                              "EventService unable to deserialize event");
+    }
 }
@@ -46,12 +46,23 @@
 #include "eventstatisticpublisher.h"
 
 #include <map>
+#include <set>
 #include <tuple>
+#include <memory>
+#include <functional>
 #include <atomic>
 #include <thread>
 #include <uuid.h>
 
 
+namespace google
+{
+  namespace protobuf
+  {
+    class Arena;
+  }
+}
+
 namespace EMANE
 {
   class EventService : public Utils::Singleton<EventService>
@@ -73,6 +84,29 @@ namespace EMANE
 
     void registerEvent(BuildId buildId,EventId eventId);
 
+    using EventDecoder = std::function<std::shared_ptr<const Event>(const Serialization &)>;
+
+    void registerEventDecoder(EventId eventId, EventDecoder decoder);
+
+    template<typename T>
+    void registerEventDecoder();
+
+    using EventCoalescer =
+      std::function<std::shared_ptr<const Event>(const Event & older,const Event & newer)>;
+
+    void registerEventCoalescer(EventId eventId, EventCoalescer coalescer);
+
+    template<typename T, typename Entries>
+    void registerEventCoalescer(const Entries & (T::*getEntries)() const);
+
+    void setEventCoalescingEnable(bool bEnable);
+
+    bool isEventCoalescable(EventId eventId) const;
+
+    std::shared_ptr<const Event> coalesceEvent(EventId eventId,
+                                               const Event & older,
+                                               const Event & newer) const;
+
 
     void sendEvent(BuildId buildId,
                    NEMId nemId,
@@ -103,6 +137,18 @@ namespace EMANE
 
     EventServiceUserMap eventServiceUserMap_;
 
+    using EventDecoderMap = std::map<EventId,EventDecoder>;
+
+    EventDecoderMap eventDecoderMap_;
+
+    using DecodedEvent = std::pair<bool,std::shared_ptr<const Event>>;
+
+    using EventCoalescerMap = std::map<EventId,EventCoalescer>;
+
+    EventCoalescerMap eventCoalescerMap_;
+
+    bool bEventCoalescingEnable_;
+
     MulticastSocket mcast_;
     std::thread thread_;
 
@@ -115,9 +161,20 @@ namespace EMANE
 
     void process();
 
+    void handleEventMessage(std::uint8_t * buf,
+                            size_t len,
+                            google::protobuf::Arena & arena);
+
+    void dispatch(EventServiceUser * pEventServiceUser,
+                  EventId eventId,
+                  const Serialization & serialization,
+                  DecodedEvent & decodedEvent) const;
+
   };
 
   using EventServiceSingleton = EventService;
 }
 
+#include "eventservice.inl"
+
 #endif //EMANEEVENTSERVICE_HEADER_
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+template<typename T>
+void EMANE::EventService::registerEventDecoder()
+{
+  registerEventDecoder(T::IDENTIFIER,
+                       [](const Serialization & serialization)
+                       {
+                         return std::make_shared<const T>(serialization);
+                       });
+}
+
+template<typename T, typename Entries>
+void EMANE::EventService::registerEventCoalescer(const Entries & (T::*getEntries)() const)
+{
+  // entries of the newer event replace those of the older event
+  // reported for the same NEM
+  registerEventCoalescer(T::IDENTIFIER,
+                         [getEntries](const Event & older, const Event & newer)
+                         {
+                           const auto & newerEntries = (static_cast<const T &>(newer).*getEntries)();
+
+                           std::set<NEMId> nems{};
+
+                           for(const auto & entry : newerEntries)
+                             {
+                               nems.insert(entry.getNEMId());
+                             }
+
+                           Entries entries{};
+
+                           for(const auto & entry : (static_cast<const T &>(older).*getEntries)())
+                             {
+                               if(!nems.count(entry.getNEMId()))
+                                 {
+                                   entries.push_back(entry);
+                                 }
+                             }
+
+                           entries.insert(entries.end(),newerEntries.begin(),newerEntries.end());
+
+                           return std::make_shared<const T>(entries);
+                         });
+}
@@ -798,7 +798,7 @@ void EMANE::FrameworkPHY::start()
 
   if(u16ProccssingPoolSize_)
     {
-      processingPool_.start(u16ProccssingPoolSize_);
+      processingPool_.start(u16ProccssingPoolSize_,id_);
     }
 }
 
@@ -2161,69 +2161,113 @@ void EMANE::FrameworkPHY::processEvent(const EventId & eventId,
   switch(eventId)
     {
     case Events::AntennaProfileEvent::IDENTIFIER:
-      {
-        Events::AntennaProfileEvent antennaProfile{serialization};
-        antennaManager_.update(antennaProfile.getAntennaProfiles());
-        eventTablePublisher_.update(antennaProfile.getAntennaProfiles());
-
-        LOGGER_STANDARD_LOGGING_FN_VARGS(pPlatformService_->logService(),
-                                         DEBUG_LEVEL,
-                                         Events::AntennaProfileEventFormatter(antennaProfile),
-                                         "PHYI %03hu FrameworkPHY::%s antenna profile event: ",
-                                         id_,
-                                         __func__);
-
-      }
+      handleEvent(Events::AntennaProfileEvent{serialization});
       break;
 
     case Events::FadingSelectionEvent::IDENTIFIER:
-      {
-        Events::FadingSelectionEvent fadingSelection{serialization};
-        fadingManager_.update(fadingSelection.getFadingSelections());
-        eventTablePublisher_.update(fadingSelection.getFadingSelections());
-
-        LOGGER_STANDARD_LOGGING_FN_VARGS(pPlatformService_->logService(),
-                                         DEBUG_LEVEL,
-                                         Events::FadingSelectionEventFormatter(fadingSelection),
-                                         "PHYI %03hu FrameworkPHY::%s fading selection event: ",
-                                         id_,
-                                         __func__);
-      }
+      handleEvent(Events::FadingSelectionEvent{serialization});
       break;
 
     case Events::LocationEvent::IDENTIFIER:
-      {
-        Events::LocationEvent locationEvent{serialization};
-        locationManager_.update(locationEvent.getLocations());
-        eventTablePublisher_.update(locationEvent.getLocations());
-
-        LOGGER_STANDARD_LOGGING_FN_VARGS(pPlatformService_->logService(),
-                                         DEBUG_LEVEL,
-                                         Events::LocationEventFormatter(locationEvent),
-                                         "PHYI %03hu FrameworkPHY::%s location event: ",
-                                         id_,
-                                         __func__);
-      }
+      handleEvent(Events::LocationEvent{serialization});
       break;
 
     case Events::PathlossEvent::IDENTIFIER:
-      {
-        Events::PathlossEvent pathlossEvent{serialization};
-        pPropagationModelAlgorithm_->update(pathlossEvent.getPathlosses());
-        eventTablePublisher_.update(pathlossEvent.getPathlosses());
-
-        LOGGER_STANDARD_LOGGING_FN_VARGS(pPlatformService_->logService(),
-                                         DEBUG_LEVEL,
-                                         Events::PathlossEventFormatter(pathlossEvent),
-                                         "PHYI %03hu FrameworkPHY::%s pathloss event: ",
-                                         id_,
-                                         __func__);
-      }
+      handleEvent(Events::PathlossEvent{serialization});
       break;
     }
 }
 /** [eventservice-processevent-snippet] */
 
+void EMANE::FrameworkPHY::processDecodedEvent(const EventId & eventId,
+                                              const std::shared_ptr<const Event> & pEvent,
+                                              const Serialization & serialization)
+{
+  LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                          DEBUG_LEVEL,
+                          "PHYI %03hu FrameworkPHY::%s event id: %hu",
+                          id_,
+                          __func__,
+                          eventId);
+
+  // the event service decoder registered for an event id
+  // determines the decoded event type
+  switch(eventId)
+    {
+    case Events::AntennaProfileEvent::IDENTIFIER:
+      handleEvent(static_cast<const Events::AntennaProfileEvent &>(*pEvent));
+      break;
+
+    case Events::FadingSelectionEvent::IDENTIFIER:
+      handleEvent(static_cast<const Events::FadingSelectionEvent &>(*pEvent));
+      break;
+
+    case Events::LocationEvent::IDENTIFIER:
+      handleEvent(static_cast<const Events::LocationEvent &>(*pEvent));
+      break;
+
+    case Events::PathlossEvent::IDENTIFIER:
+      handleEvent(static_cast<const Events::PathlossEvent &>(*pEvent));
+      break;
+
+    default:
+      processEvent(eventId,serialization);
+      break;
+    }
+}
+
+void EMANE::FrameworkPHY::handleEvent(const Events::AntennaProfileEvent & antennaProfile)
+{
+  antennaManager_.update(antennaProfile.getAntennaProfiles());
+  eventTablePublisher_.update(antennaProfile.getAntennaProfiles());
+
+  LOGGER_STANDARD_LOGGING_FN_VARGS(pPlatformService_->logService(),
+                                   DEBUG_LEVEL,
+                                   Events::AntennaProfileEventFormatter(antennaProfile),
+                                   "PHYI %03hu FrameworkPHY::%s antenna profile event: ",
+                                   id_,
+                                   __func__);
+}
+
+void EMANE::FrameworkPHY::handleEvent(const Events::FadingSelectionEvent & fadingSelection)
+{
+  fadingManager_.update(fadingSelection.getFadingSelections());
+  eventTablePublisher_.update(fadingSelection.getFadingSelections());
+
+  LOGGER_STANDARD_LOGGING_FN_VARGS(pPlatformService_->logService(),
+                                   DEBUG_LEVEL,
+                                   Events::FadingSelectionEventFormatter(fadingSelection),
+                                   "PHYI %03hu FrameworkPHY::%s fading selection event: ",
+                                   id_,
+                                   __func__);
+}
+
+void EMANE::FrameworkPHY::handleEvent(const Events::LocationEvent & locationEvent)
+{
+  locationManager_.update(locationEvent.getLocations());
+  eventTablePublisher_.update(locationEvent.getLocations());
+
+  LOGGER_STANDARD_LOGGING_FN_VARGS(pPlatformService_->logService(),
+                                   DEBUG_LEVEL,
+                                   Events::LocationEventFormatter(locationEvent),
+                                   "PHYI %03hu FrameworkPHY::%s location event: ",
+                                   id_,
+                                   __func__);
+}
+
+void EMANE::FrameworkPHY::handleEvent(const Events::PathlossEvent & pathlossEvent)
+{
+  pPropagationModelAlgorithm_->update(pathlossEvent.getPathlosses());
+  eventTablePublisher_.update(pathlossEvent.getPathlosses());
+
+  LOGGER_STANDARD_LOGGING_FN_VARGS(pPlatformService_->logService(),
+                                   DEBUG_LEVEL,
+                                   Events::PathlossEventFormatter(pathlossEvent),
+                                   "PHYI %03hu FrameworkPHY::%s pathloss event: ",
+                                   id_,
+                                   __func__);
+}
+
 void EMANE::FrameworkPHY::createDefaultAntennaIfNeeded()
 {
   if(receiveProcessors_.empty())
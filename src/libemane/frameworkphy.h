@@ -38,6 +38,10 @@
 #include "emane/phytypes.h"
 #include "emane/utils/commonlayerstatistics.h"
 #include "emane/utils/processingpool.h"
+#include "emane/events/antennaprofileevent.h"
+#include "emane/events/fadingselectionevent.h"
+#include "emane/events/locationevent.h"
+#include "emane/events/pathlossevent.h"
 
 #include "locationmanager.h"
 #include "spectrumservice.h"
@@ -100,6 +104,9 @@ namespace EMANE
     void processEvent(const EventId & eventId,
                       const Serialization & serialization) override;
 
+    void processDecodedEvent(const EventId & eventId,
+                             const std::shared_ptr<const Event> & pEvent,
+                             const Serialization & serialization) override;
 
     SpectrumMonitor & getSpectrumMonitor();
 
@@ -151,6 +158,14 @@ namespace EMANE
     SpectralMaskIndex spectralMaskIndex_;
 
     void createDefaultAntennaIfNeeded();
+
+    void handleEvent(const Events::AntennaProfileEvent & antennaProfile);
+
+    void handleEvent(const Events::FadingSelectionEvent & fadingSelection);
+
+    void handleEvent(const Events::LocationEvent & locationEvent);
+
+    void handleEvent(const Events::PathlossEvent & pathlossEvent);
   };
 }
 
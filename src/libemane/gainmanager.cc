@@ -44,8 +44,8 @@ EMANE::GainManager::AntennaPatternInfo::AntennaPatternInfo():
   pBlockage_{},
   placement_{}{}
 
-EMANE::GainManager::AntennaPatternInfo::AntennaPatternInfo(AntennaPattern * pPattern,
-                                                           AntennaPattern * pBlockage,
+EMANE::GainManager::AntennaPatternInfo::AntennaPatternInfo(const AntennaPattern * pPattern,
+                                                           const AntennaPattern * pBlockage,
                                                            const PositionNEU & placement):
   pPattern_{pPattern},
   pBlockage_{pBlockage},
@@ -76,14 +76,14 @@ namespace EMANE
 
     struct AntennaPatternInfo
     {
-      AntennaPattern * pPattern_;
-      AntennaPattern * pBlockage_;
+      const AntennaPattern * pPattern_;
+      const AntennaPattern * pBlockage_;
       PositionNEU placement_;
 
       AntennaPatternInfo();
 
-      AntennaPatternInfo(AntennaPattern * pPattern,
-                         AntennaPattern * pBlockage,
+      AntennaPatternInfo(const AntennaPattern * pPattern,
+                         const AntennaPattern * pBlockage,
                          const PositionNEU & placement);
     };
 
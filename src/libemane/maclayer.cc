@@ -127,6 +127,13 @@ void EMANE::MACLayer::doProcessEvent(const EventId & eventId,
   pImplementor_->processEvent(eventId,serialization);
 }
 
+void EMANE::MACLayer::doProcessDecodedEvent(const EventId & eventId,
+                                            const std::shared_ptr<const Event> & pEvent,
+                                            const Serialization & serialization)
+{
+  pImplementor_->processDecodedEvent(eventId,pEvent,serialization);
+}
+
 
 void EMANE::MACLayer::doProcessTimedEvent(TimerEventId eventId,
                                           const TimePoint & requestExpireTime,
@@ -271,3 +271,10 @@ ssize_t EMANE::MulticastSocket::recv(void * buf,
 {
   return ::recv(iSock_,buf,len,flags);
 }
+
+int EMANE::MulticastSocket::recvmmsg(mmsghdr * msgs,
+                                     unsigned int vlen,
+                                     int flags)
+{
+  return ::recvmmsg(iSock_,msgs,vlen,flags,nullptr);
+}
@@ -39,6 +39,7 @@
 #include <string>
 #include <cstdint>
 #include <sys/uio.h>
+#include <sys/socket.h>
 
 namespace EMANE
 {
@@ -67,6 +68,10 @@ namespace EMANE
                  size_t len,
                  int flags=0);
 
+    int recvmmsg(mmsghdr * msgs,
+                 unsigned int vlen,
+                 int flags=0);
+
 
   private:
     INETAddr addr_;
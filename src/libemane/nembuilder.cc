@@ -301,6 +301,13 @@ EMANE::Application::NEMBuilder::buildShimLayer(NEMId id,
   return std::unique_ptr<EMANE::NEMLayer>(pNEMLayer.release());
 }
 
+void EMANE::Application::NEMBuilder::configureLayer(NEMLayer & layer,
+                                                    const ConfigurationUpdateRequest & request)
+{
+  layer.configure(ConfigurationServiceSingleton::instance()->buildUpdates(layer.getBuildId(),
+                                                                          request));
+}
+
 
 std::unique_ptr<EMANE::Application::NEM>
 EMANE::Application::NEMBuilder::buildNEM(NEMId id,
@@ -396,6 +403,19 @@ EMANE::Application::NEMBuilder::buildTransportLayer(NEMId id,
   Transport * pImpl =
     transportLayerFactory.createTransport(id, pPlatformService);
 
+  return buildTransportLayer_i(pImpl,pPlatformService,id,sLibraryFile,request,bSkipConfigure);
+}
+
+std::unique_ptr<EMANE::NEMLayer>
+EMANE::Application::NEMBuilder::buildTransportLayer_i(Transport * pImpl,
+                                                      PlatformServiceProvider * pProvider,
+                                                      NEMId id,
+                                                      const std::string & sLibraryFile,
+                                                      const ConfigurationUpdateRequest & request,
+                                                      bool bSkipConfigure)
+{
+  EMANE::NEMPlatformService * pPlatformService{dynamic_cast<EMANE::NEMPlatformService*>(pProvider)};
+
   std::unique_ptr<NEMQueuedLayer> pNEMLayer{new TransportLayer{id,
                                                                new NEMStatefulLayer{id,
                                                                                     pImpl,
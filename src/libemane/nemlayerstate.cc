@@ -172,6 +172,19 @@ void EMANE::NEMLayerState::processEvent(NEMStatefulLayer *,
                           getStateName().c_str()); 
 }
 
+void EMANE::NEMLayerState::processDecodedEvent(NEMStatefulLayer *,
+                                               NEMLayer *,
+                                               const EventId &,
+                                               const std::shared_ptr<const Event> &,
+                                               const Serialization &)
+{
+  LOGGER_STANDARD_LOGGING(*LogServiceSingleton::instance(),
+                          ERROR_LEVEL,
+                          "NEMLayer %s not valid in %s state",
+                          "processDecodedEvent",
+                          getStateName().c_str());
+}
+
 
 void EMANE::NEMLayerState::processTimedEvent(NEMStatefulLayer *,
                                              NEMLayer *,
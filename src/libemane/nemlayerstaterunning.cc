@@ -99,6 +99,15 @@ void EMANE::NEMLayerStateRunning::processEvent(NEMStatefulLayer *,
   pLayer->processEvent(id,serialization);
 }
 
+void EMANE::NEMLayerStateRunning::processDecodedEvent(NEMStatefulLayer *,
+                                                      NEMLayer * pLayer,
+                                                      const EventId & id,
+                                                      const std::shared_ptr<const Event> & pEvent,
+                                                      const Serialization & serialization)
+{
+  pLayer->processDecodedEvent(id,pEvent,serialization);
+}
+
 
 void EMANE::NEMLayerStateRunning::processTimedEvent(NEMStatefulLayer *,
                                                     NEMLayer * pLayer,
@@ -160,6 +160,23 @@ namespace EMANE
                       const EventId & id, 
                       const Serialization & serialization);
 
+    /**
+     *  Process decoded event
+     *
+     * @param pStatefulLayer Reference to the stateful layer
+     * @param pLayer Reference to the wrapped layer
+     * @param id Event Id
+     * @param pEvent Shared decoded event
+     * @param serialization Event object serialization
+     *
+     * Layer processing of decoded event
+     */
+    void processDecodedEvent(NEMStatefulLayer * pStatefulLayer,
+                             NEMLayer * pLayer,
+                             const EventId & id,
+                             const std::shared_ptr<const Event> & pEvent,
+                             const Serialization & serialization);
+
     /**
      *  Process timed event
      *
@@ -44,9 +44,30 @@
 #include "otaexception.h"
 #include "antennaprofilemanifest.h"
 #include "spectralmaskmanager.h"
+#include "startupprofiler.h"
+#include "statisticservice.h"
+#include "emane/utils/parameterconvert.h"
+
+#include <chrono>
+#include <limits>
+#include <vector>
+
+namespace
+{
+  template<typename Function>
+  EMANE::Microseconds timed(Function f)
+  {
+    auto start = std::chrono::steady_clock::now();
+
+    f();
+
+    return std::chrono::duration_cast<EMANE::Microseconds>(std::chrono::steady_clock::now() - start);
+  }
+}
 
 EMANE::Application::NEMManagerImpl::NEMManagerImpl(const uuid_t & uuid):
-  NEMManager{uuid}{}
+  NEMManager{uuid},
+  threadPlacementPolicy_{{},{},Utils::ThreadPlacement::PackMode::NONE,{},true}{}
 
 EMANE::Application::NEMManagerImpl::~NEMManagerImpl(){}
 
@@ -79,6 +100,14 @@ void EMANE::Application::NEMManagerImpl::initialize(Registrar & registrar)
                                                 {1},
                                                 "Device to associate with the Event Service channel multicast endpoint.");
 
+  configRegistrar.registerNumeric<bool>("eventservicecoalesceenable",
+                                        ConfigurationProperties::DEFAULT,
+                                        {false},
+                                        "Enable coalescing of location, pathloss and antenna profile"
+                                        " events waiting in a NEM layer processing queue. Entries of a"
+                                        " newer event replace the entries for the same NEMs in the"
+                                        " queued event, instead of both events being processed.");
+
   configRegistrar.registerNonNumeric<INETAddr>("otamanagergroup",
                                                ConfigurationProperties::NONE,
                                                {},
@@ -121,6 +150,14 @@ void EMANE::Application::NEMManagerImpl::initialize(Registrar & registrar)
                                         {true},
                                         "Enable OTA channel multicast communication.");
 
+  configRegistrar.registerNonNumeric<std::string>("otamanagercapturefile",
+                                                  ConfigurationProperties::NONE,
+                                                  {},
+                                                  "File to record all received OTA messages, including"
+                                                  " those sent between NEMs on this platform, and event"
+                                                  " channel events to for offline replay. See"
+                                                  " otacaptureformat.h for the file layout.");
+
 
   configRegistrar.registerNonNumeric<INETAddr>("controlportendpoint",
                                                ConfigurationProperties::REQUIRED,
@@ -155,6 +192,27 @@ void EMANE::Application::NEMManagerImpl::initialize(Registrar & registrar)
                                                  {0},
                                                  "Event channel max event count table rows.");
 
+  configRegistrar.registerNumeric<bool>("stats.packetlatency.enable",
+                                        ConfigurationProperties::DEFAULT,
+                                        {false},
+                                        "Enable per packet latency tracing. Each NEM layer stamps"
+                                        " packets when it starts processing them and publishes"
+                                        " latency percentiles in its PacketLatencyTable.");
+
+  configRegistrar.registerNonNumeric<std::string>("stats.snapshot.file",
+                                                  ConfigurationProperties::NONE,
+                                                  {},
+                                                  "Memory-mapped file to publish all numeric statistics"
+                                                  " to. External tools can read the file without using the"
+                                                  " control port. See emane/statisticsnapshotformat.h for the"
+                                                  " file layout.");
+
+  configRegistrar.registerNumeric<double>("stats.snapshot.interval",
+                                          ConfigurationProperties::DEFAULT,
+                                          {0.1},
+                                          "Statistic snapshot file update interval in seconds.",
+                                          0.001);
+
   configRegistrar.registerNonNumeric<std::string>("spectralmaskmanifesturi",
                                                   EMANE::ConfigurationProperties::NONE,
                                                   {},
@@ -166,7 +224,75 @@ void EMANE::Application::NEMManagerImpl::initialize(Registrar & registrar)
                                                   " any NEM participating in the emulation is using spectral"
                                                   " masks, even in the case where the local NEM is not.");
 
+  configRegistrar.registerNumeric<std::uint16_t>("startupconcurrency",
+                                                 ConfigurationProperties::DEFAULT,
+                                                 {1},
+                                                 "Maximum number of NEM stacks configured concurrently during"
+                                                 " emulator startup. Build ids are always registered in"
+                                                 " platform configuration order. A value of 1 builds and"
+                                                 " configures NEMs serially.",
+                                                 1);
+
+  const std::string sCPUListPattern{"^\\d+(-\\d+){0,1}(,\\d+(-\\d+){0,1})*$"};
+
+  for(const auto & entry : std::vector<std::pair<std::string,std::string>>{{"ota","OTA manager receive"},
+                                                                          {"event","event service receive"},
+                                                                          {"timer","timer scheduler"},
+                                                                          {"control","control port and statistic snapshot"},
+                                                                          {"nem","NEM layer queue and NEM OTA adapter"},
+                                                                          {"processingpool","PHY processing pool worker"},
+                                                                          {"transport","transport device reader"}})
+    {
+      configRegistrar.registerNonNumeric<std::string>("affinity.cpus." + entry.first,
+                                                      ConfigurationProperties::NONE,
+                                                      {},
+                                                      "CPU list, for example 0-3,8, that " + entry.second +
+                                                      " threads are pinned to. Takes precedence over"
+                                                      " affinity.nem and affinity.pack.",
+                                                      1,
+                                                      1,
+                                                      sCPUListPattern);
+    }
+
+  configRegistrar.registerNonNumeric<std::string>("affinity.nem",
+                                                  ConfigurationProperties::NONE,
+                                                  {},
+                                                  "Per NEM CPU list that all threads of an NEM are pinned to"
+                                                  " with the following format: <NEM id>:<CPU list>. Takes"
+                                                  " precedence over affinity.pack.",
+                                                  1,
+                                                  std::numeric_limits<std::uint16_t>::max(),
+                                                  "^\\d+:\\d+(-\\d+){0,1}(,\\d+(-\\d+){0,1})*$");
+
+  configRegistrar.registerNonNumeric<std::string>("affinity.pack",
+                                                  ConfigurationProperties::DEFAULT,
+                                                  {"none"},
+                                                  "Automatic NEM thread placement. none leaves NEM threads"
+                                                  " unpinned, core pins all threads of an NEM to a single CPU"
+                                                  " and node pins all threads of an NEM to the CPUs of a single"
+                                                  " NUMA node. NEMs are spread over the available CPUs or nodes"
+                                                  " in NEM id order.",
+                                                  1,
+                                                  1,
+                                                  "^(none|core|node)$");
+
+  configRegistrar.registerNonNumeric<std::string>("affinity.pack.cpus",
+                                                  ConfigurationProperties::NONE,
+                                                  {},
+                                                  "CPU list available for automatic NEM thread placement."
+                                                  " Defaults to the emulator process CPU affinity.",
+                                                  1,
+                                                  1,
+                                                  sCPUListPattern);
 
+  configRegistrar.registerNumeric<bool>("affinity.numalocal",
+                                        ConfigurationProperties::DEFAULT,
+                                        {true},
+                                        "Prefer the local NUMA node for memory allocated by threads"
+                                        " pinned to CPUs of a single node.");
+
+  // registers the platform StartupTimingTable
+  StartupProfiler::instance();
 }
 
 void EMANE::Application::NEMManagerImpl::configure(const ConfigurationUpdate & update)
@@ -255,6 +381,16 @@ void EMANE::Application::NEMManagerImpl::configure(const ConfigurationUpdate & u
                                   item.first.c_str(),
                                   bOTAManagerChannelEnable_ ? "on" : "off");
         }
+      else if(item.first == "otamanagercapturefile")
+        {
+          sOTAManagerCaptureFile_ = item.second[0].asString();
+
+          LOGGER_STANDARD_LOGGING(*LogServiceSingleton::instance(),
+                                  INFO_LEVEL,
+                                  "NEMManagerImpl::configure %s: %s",
+                                  item.first.c_str(),
+                                  sOTAManagerCaptureFile_.c_str());
+        }
       else if(item.first == "eventservicegroup")
         {
           eventServiceGroupAddr_ = item.second[0].asINETAddr();
@@ -287,6 +423,19 @@ void EMANE::Application::NEMManagerImpl::configure(const ConfigurationUpdate & u
                                   item.first.c_str(),
                                   u8EventServiceTTL_);
         }
+      else if(item.first == "eventservicecoalesceenable")
+        {
+          bool bEventCoalescingEnable{item.second[0].asBool()};
+
+          LOGGER_STANDARD_LOGGING(*LogServiceSingleton::instance(),
+                                  INFO_LEVEL,
+                                  "NEMManagerImpl::configure %s: %s",
+                                  item.first.c_str(),
+                                  bEventCoalescingEnable ? "on" : "off");
+
+          EventServiceSingleton::instance()->
+            setEventCoalescingEnable(bEventCoalescingEnable);
+        }
       else if(item.first == "controlportendpoint")
         {
           controlPortAddr_ = item.second[0].asINETAddr();
@@ -348,6 +497,40 @@ void EMANE::Application::NEMManagerImpl::configure(const ConfigurationUpdate & u
           EventServiceSingleton::instance()->
             setStatEventCountRowLimit(u32EventMaxEventCountRows);
         }
+      else if(item.first == "stats.packetlatency.enable")
+        {
+          bool bPacketLatencyTraceEnable{item.second[0].asBool()};
+
+          LOGGER_STANDARD_LOGGING(*LogServiceSingleton::instance(),
+                                  INFO_LEVEL,
+                                  "NEMManagerImpl::configure %s: %s",
+                                  item.first.c_str(),
+                                  bPacketLatencyTraceEnable ? "on" : "off");
+
+          StatisticServiceSingleton::instance()->
+            setPacketLatencyTraceEnable(bPacketLatencyTraceEnable);
+        }
+      else if(item.first == "stats.snapshot.file")
+        {
+          sStatisticSnapshotFile_ = item.second[0].asString();
+
+          LOGGER_STANDARD_LOGGING(*LogServiceSingleton::instance(),
+                                  INFO_LEVEL,
+                                  "NEMManagerImpl::configure %s: %s",
+                                  item.first.c_str(),
+                                  sStatisticSnapshotFile_.c_str());
+        }
+      else if(item.first == "stats.snapshot.interval")
+        {
+          statisticSnapshotInterval_ =
+            std::chrono::duration_cast<Microseconds>(DoubleSeconds{item.second[0].asDouble()});
+
+          LOGGER_STANDARD_LOGGING(*LogServiceSingleton::instance(),
+                                  INFO_LEVEL,
+                                  "NEMManagerImpl::configure %s: %lf",
+                                  item.first.c_str(),
+                                  item.second[0].asDouble());
+        }
       else if(item.first == "spectralmaskmanifesturi")
         {
           sSpectralMaskManifestURI_ = item.second[0].asString();
@@ -359,6 +542,108 @@ void EMANE::Application::NEMManagerImpl::configure(const ConfigurationUpdate & u
                                   sSpectralMaskManifestURI_.c_str());
 
         }
+      else if(item.first.compare(0,14,"affinity.cpus.") == 0)
+        {
+          const std::map<std::string,Utils::ThreadPlacement::ThreadClass> classes =
+            {{"ota",Utils::ThreadPlacement::ThreadClass::OTA},
+             {"event",Utils::ThreadPlacement::ThreadClass::EVENT},
+             {"timer",Utils::ThreadPlacement::ThreadClass::TIMER},
+             {"control",Utils::ThreadPlacement::ThreadClass::CONTROL},
+             {"nem",Utils::ThreadPlacement::ThreadClass::NEM},
+             {"processingpool",Utils::ThreadPlacement::ThreadClass::PROCESSINGPOOL},
+             {"transport",Utils::ThreadPlacement::ThreadClass::TRANSPORT}};
+
+          auto iter = classes.find(item.first.substr(14));
+
+          if(iter == classes.end())
+            {
+              throw makeException<ConfigureException>("NEMManagerImpl: "
+                                                      "Unexpected configuration item %s",
+                                                      item.first.c_str());
+            }
+
+          threadPlacementPolicy_.classCPUs_[iter->second] =
+            Utils::ThreadPlacement::parseCPUList(item.second[0].asString());
+
+          LOGGER_STANDARD_LOGGING(*LogServiceSingleton::instance(),
+                                  INFO_LEVEL,
+                                  "NEMManagerImpl::configure %s: %s",
+                                  item.first.c_str(),
+                                  item.second[0].asString().c_str());
+        }
+      else if(item.first == "affinity.nem")
+        {
+          for(const auto & any : item.second)
+            {
+              std::string sValue{any.asString()};
+
+              auto pos = sValue.find(':');
+
+              NEMId id{Utils::ParameterConvert{sValue.substr(0,pos)}.toUINT16(1)};
+
+              threadPlacementPolicy_.nemCPUs_[id] =
+                Utils::ThreadPlacement::parseCPUList(sValue.substr(pos + 1));
+
+              LOGGER_STANDARD_LOGGING(*LogServiceSingleton::instance(),
+                                      INFO_LEVEL,
+                                      "NEMManagerImpl::configure %s: %s",
+                                      item.first.c_str(),
+                                      sValue.c_str());
+            }
+        }
+      else if(item.first == "affinity.pack")
+        {
+          std::string sMode{item.second[0].asString()};
+
+          if(sMode == "core")
+            {
+              threadPlacementPolicy_.packMode_ = Utils::ThreadPlacement::PackMode::CORE;
+            }
+          else if(sMode == "node")
+            {
+              threadPlacementPolicy_.packMode_ = Utils::ThreadPlacement::PackMode::NODE;
+            }
+          else
+            {
+              threadPlacementPolicy_.packMode_ = Utils::ThreadPlacement::PackMode::NONE;
+            }
+
+          LOGGER_STANDARD_LOGGING(*LogServiceSingleton::instance(),
+                                  INFO_LEVEL,
+                                  "NEMManagerImpl::configure %s: %s",
+                                  item.first.c_str(),
+                                  sMode.c_str());
+        }
+      else if(item.first == "affinity.pack.cpus")
+        {
+          threadPlacementPolicy_.packCPUs_ =
+            Utils::ThreadPlacement::parseCPUList(item.second[0].asString());
+
+          LOGGER_STANDARD_LOGGING(*LogServiceSingleton::instance(),
+                                  INFO_LEVEL,
+                                  "NEMManagerImpl::configure %s: %s",
+                                  item.first.c_str(),
+                                  item.second[0].asString().c_str());
+        }
+      else if(item.first == "affinity.numalocal")
+        {
+          threadPlacementPolicy_.bNUMALocal_ = item.second[0].asBool();
+
+          LOGGER_STANDARD_LOGGING(*LogServiceSingleton::instance(),
+                                  INFO_LEVEL,
+                                  "NEMManagerImpl::configure %s: %s",
+                                  item.first.c_str(),
+                                  threadPlacementPolicy_.bNUMALocal_ ? "on" : "off");
+        }
+      else if(item.first == "startupconcurrency")
+        {
+          // consumed by the NEM director prior to NEM construction
+          LOGGER_STANDARD_LOGGING(*LogServiceSingleton::instance(),
+                                  INFO_LEVEL,
+                                  "NEMManagerImpl::configure %s: %hu",
+                                  item.first.c_str(),
+                                  item.second[0].asUINT16());
+        }
       else
         {
           throw makeException<ConfigureException>("NEMManagerImpl: "
@@ -378,10 +663,35 @@ void EMANE::Application::NEMManagerImpl::configure(const ConfigurationUpdate & u
     {
       SpectralMaskManager::instance()->load(sSpectralMaskManifestURI_);
     }
+
+  // threads started before now, such as the timer, are re-pinned
+  Utils::ThreadPlacement::instance()->setPolicy(threadPlacementPolicy_);
 }
 
 void EMANE::Application::NEMManagerImpl::start()
 {
+  std::vector<NEMId> nems{};
+
+  for(const auto & entry : platformNEMMap_)
+    {
+      nems.push_back(entry.first);
+    }
+
+  // NEM threads are started below and placed on entry
+  Utils::ThreadPlacement::instance()->assign(nems);
+
+  if(!sOTAManagerCaptureFile_.empty())
+    {
+      try
+        {
+          OTAManagerSingleton::instance()->openCapture(sOTAManagerCaptureFile_,uuid_);
+        }
+      catch(OTAException & exp)
+        {
+          throw StartException(exp.what());
+        }
+    }
+
   if(bOTAManagerChannelEnable_)
     {
       try
@@ -416,26 +726,41 @@ void EMANE::Application::NEMManagerImpl::start()
 
   controlPortService_.open(controlPortAddr_);
 
-  std::for_each(platformNEMMap_.begin(),
-                platformNEMMap_.end(),
-                std::bind(&Component::start,
-                          std::bind(&PlatformNEMMap::value_type::second,
-                                    std::placeholders::_1)));
+  for(auto & entry : platformNEMMap_)
+    {
+      StartupProfiler::instance()->record(entry.first,
+                                          StartupProfiler::Phase::START,
+                                          timed([&entry](){entry.second->start();}));
+    }
+
+  // all NEM statistics are registered by now
+  if(!sStatisticSnapshotFile_.empty())
+    {
+      StatisticServiceSingleton::instance()->openSnapshot(sStatisticSnapshotFile_,
+                                                         statisticSnapshotInterval_);
+    }
 }
 
 void EMANE::Application::NEMManagerImpl::postStart()
 {
-  std::for_each(platformNEMMap_.begin(),
-                platformNEMMap_.end(),
-                std::bind(&Component::postStart,
-                          std::bind(&PlatformNEMMap::value_type::second,
-                                    std::placeholders::_1)));
+  for(auto & entry : platformNEMMap_)
+    {
+      StartupProfiler::instance()->record(entry.first,
+                                          StartupProfiler::Phase::START,
+                                          timed([&entry](){entry.second->postStart();}));
+    }
+
+  StartupProfiler::instance()->report();
 }
 
 void EMANE::Application::NEMManagerImpl::stop()
 {
   controlPortService_.close();
 
+  StatisticServiceSingleton::instance()->closeSnapshot();
+
+  OTAManagerSingleton::instance()->closeCapture();
+
   std::for_each(platformNEMMap_.begin(),
                 platformNEMMap_.end(),
                 std::bind(&Component::stop,
@@ -37,6 +37,7 @@
 
 #include "emane/application/nemmanager.h"
 #include "emane/inetaddr.h"
+#include "emane/utils/threadplacement.h"
 #include "controlportservice.h"
 
 #include <map>
@@ -87,6 +88,7 @@ namespace EMANE
       std::uint32_t u32OTAManagerMTU_;
       bool bOTAManagerChannelLoopback_;
       bool bOTAManagerChannelEnable_;
+      std::string sOTAManagerCaptureFile_;
       Seconds OTAManagerPartCheckThreshold_;
       Seconds OTAManagerPartTimeoutThreshold_;
 
@@ -96,6 +98,9 @@ namespace EMANE
       INETAddr controlPortAddr_;
       std::string sAntennaProfileManifestURI_;
       std::string sSpectralMaskManifestURI_;
+      std::string sStatisticSnapshotFile_;
+      Microseconds statisticSnapshotInterval_;
+      Utils::ThreadPlacement::Policy threadPlacementPolicy_;
     };
   }
 }
@@ -37,6 +37,7 @@
 #include "logservice.h"
 
 #include "emane/utils/threadutils.h"
+#include "emane/utils/threadplacement.h"
 #include "emane/upstreamtransport.h"
 
 EMANE::NEMOTAAdapter::NEMOTAAdapter(NEMId id):
@@ -109,6 +110,8 @@ void EMANE::NEMOTAAdapter::processDownstreamPacket(DownstreamPacket & pkt,
 
 void EMANE::NEMOTAAdapter::processPacketQueue()
 {
+  Utils::ThreadPlacement::Scope placement{Utils::ThreadPlacement::ThreadClass::NEM,id_};
+
   while(1)
     {
       std::unique_lock<std::mutex> lock(mutex_);
@@ -34,9 +34,14 @@
 
 #include "nemqueuedlayer.h"
 #include "logservice.h"
+#include "eventservice.h"
+#include "statisticservice.h"
+
+#include "emane/utils/threadplacement.h"
 
 #include <exception>
 #include <mutex>
+#include <iterator>
 
 #include <sys/eventfd.h>
 #include <sys/epoll.h>
@@ -46,6 +51,25 @@
 namespace
 {
   const uint64_t one{1};
+
+  // packet latency table stages, indexes into the layer histograms
+  enum PacketLatencyStage : std::size_t
+    {
+      DOWNSTREAM_STAGE,
+      DOWNSTREAM_TOTAL_STAGE,
+      UPSTREAM_STAGE,
+      UPSTREAM_TOTAL_STAGE,
+      QUEUE_WAIT_STAGE,
+    };
+
+  const char * PacketLatencyStageNames[] =
+    {
+      "Downstream",
+      "Downstream Total",
+      "Upstream",
+      "Upstream Total",
+      "Queue Wait",
+    };
 }
 
 EMANE::NEMQueuedLayer::NEMQueuedLayer(NEMId id, PlatformServiceProvider *pPlatformService):
@@ -62,7 +86,9 @@ EMANE::NEMQueuedLayer::NEMQueuedLayer(NEMId id, PlatformServiceProvider *pPlatfo
   pProcessedUpstreamControl_{},
   pProcessedEvent_{},
   pProcessedTimedEvent_{},
-  pProcessedConfiguration_{}
+  pProcessedConfiguration_{},
+  pCoalescedEvent_{},
+  packetLatencyHistograms_{}
 {
   iFd_ = eventfd(0,0);
 
@@ -142,6 +168,12 @@ void  EMANE::NEMQueuedLayer::initialize(Registrar & registrar)
     statisticRegistrar.registerNumeric<std::uint64_t>("processedTimedEvents",
                                                       StatisticProperties::CLEARABLE,
                                                       "The number of processed timed events.");
+  pCoalescedEvent_ =
+    statisticRegistrar.registerNumeric<std::uint64_t>("numEventsCoalesced",
+                                                      StatisticProperties::CLEARABLE,
+                                                      "The number of queued events coalesced into an"
+                                                      " older queued event of the same type before"
+                                                      " processing.");
 
   pStatisticHistogramTable_.reset(new Utils::StatisticHistogramTable<EventId>{
       statisticRegistrar,
@@ -149,6 +181,63 @@ void  EMANE::NEMQueuedLayer::initialize(Registrar & registrar)
           {"Event","Total Rx"},
         "Received event counts"});
 
+  // rows only name a stage, the layer histograms are read when the
+  // table is queried
+  auto pPacketLatencyTable =
+    statisticRegistrar.registerLazyTable<std::string,std::size_t>("PacketLatencyTable",
+                                                                  {"Stage",
+                                                                   "Count",
+                                                                   "p50",
+                                                                   "p99",
+                                                                   "p99.9",
+                                                                   "Max"},
+                                                                  [this](const std::string & sStage,
+                                                                         const std::size_t & stage)
+                                                                  {
+                                                                    Utils::LogLinearHistogram histogram{};
+
+                                                                    {
+                                                                      std::lock_guard<std::mutex> m(packetLatencyMutex_);
+
+                                                                      histogram = packetLatencyHistograms_[stage];
+                                                                    }
+
+                                                                    return std::vector<Any>{
+                                                                      Any{sStage},
+                                                                      Any{histogram.getCount()},
+                                                                      Any{histogram.getPercentile(50)},
+                                                                      Any{histogram.getPercentile(99)},
+                                                                      Any{histogram.getPercentile(99.9)},
+                                                                      Any{histogram.getMax()}};
+                                                                  },
+                                                                  [this](StatisticTablePublisher *)
+                                                                  {
+                                                                    std::lock_guard<std::mutex> m(packetLatencyMutex_);
+
+                                                                    for(auto & histogram : packetLatencyHistograms_)
+                                                                      {
+                                                                        histogram.clear();
+                                                                      }
+                                                                  },
+                                                                  "Packet latency percentiles in microseconds when"
+                                                                  " packet latency tracing is enabled. Downstream and"
+                                                                  " Upstream are the latency since the packet left the"
+                                                                  " previous layer boundary, which for the first stamped"
+                                                                  " layer is the packet creation time. Downstream Total"
+                                                                  " and Upstream Total are the latency since packet"
+                                                                  " creation. Upstream Total at the transport layer is"
+                                                                  " the end-to-end latency. Queue Wait is the time packets"
+                                                                  " spent in this layer's processing queue.");
+
+  static_assert(std::size(PacketLatencyStageNames) ==
+                std::tuple_size<decltype(packetLatencyHistograms_)>::value,
+                "packet latency stage count mismatch");
+
+  for(std::size_t stage = 0; stage < packetLatencyHistograms_.size(); ++stage)
+    {
+      pPacketLatencyTable->setRow(PacketLatencyStageNames[stage],stage);
+    }
+
   avgQueueWait_.registerStatistic
     (statisticRegistrar.registerNumeric<double>("avgProcessAPIQueueWait",
                                                 StatisticProperties::CLEARABLE,
@@ -261,6 +350,56 @@ void EMANE::NEMQueuedLayer::processEvent(const EventId & eventId,
 
 }
 
+void EMANE::NEMQueuedLayer::processDecodedEvent(const EventId & eventId,
+                                                const std::shared_ptr<const Event> & pEvent,
+                                                const Serialization & serialization)
+{
+  if(EventServiceSingleton::instance()->isEventCoalescable(eventId))
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+
+      auto iter = pendingEventMap_.find(eventId);
+
+      if(iter != pendingEventMap_.end())
+        {
+          // newer state replaces the stale state of the queued event,
+          // which keeps its place in the queue
+          auto & pPendingEvent = iter->second;
+
+          pPendingEvent->pEvent_ =
+            EventServiceSingleton::instance()->coalesceEvent(eventId,
+                                                             *pPendingEvent->pEvent_,
+                                                             *pEvent);
+
+          pPendingEvent->bCoalesced_ = true;
+
+          ++*pCoalescedEvent_;
+
+          return;
+        }
+
+      auto pPendingEvent = std::make_shared<PendingEvent>(PendingEvent{pEvent,serialization,false});
+
+      pendingEventMap_.emplace(eventId,pPendingEvent);
+
+      lock.unlock();
+
+      enqueue_i(std::bind(&NEMQueuedLayer::handleProcessPendingEvent,
+                          this,
+                          Clock::now(),
+                          eventId,
+                          pPendingEvent));
+      return;
+    }
+
+  enqueue_i(std::bind(&NEMQueuedLayer::handleProcessDecodedEvent,
+                      this,
+                      Clock::now(),
+                      eventId,
+                      pEvent,
+                      serialization));
+}
+
 void EMANE::NEMQueuedLayer::processTimedEvent(TimerEventId eventId,
                                               const TimePoint & expireTime,
                                               const TimePoint & scheduleTime,
@@ -279,6 +418,8 @@ void EMANE::NEMQueuedLayer::processTimedEvent(TimerEventId eventId,
 
 void EMANE::NEMQueuedLayer::processWorkQueue()
 {
+  Utils::ThreadPlacement::Scope placement{Utils::ThreadPlacement::ThreadClass::NEM,id_};
+
   std::uint64_t u64Expired{};
 #define MAX_EVENTS 32
   struct epoll_event events[MAX_EVENTS];
@@ -420,6 +561,17 @@ void EMANE::NEMQueuedLayer::handleProcessDownstreamPacket(TimePoint enqueueTime,
 
   ++*pProcessedDownstreamPacket_;
 
+  if(StatisticServiceSingleton::instance()->isPacketLatencyTraceEnabled())
+    {
+      auto now = Clock::now();
+
+      tracePacketLatency(DOWNSTREAM_STAGE,
+                         DOWNSTREAM_TOTAL_STAGE,
+                         pkt.stampTrace(now),
+                         std::chrono::duration_cast<Microseconds>(now - pkt.getPacketInfo().getCreationTime()),
+                         std::chrono::duration_cast<Microseconds>(now - enqueueTime));
+    }
+
   doProcessDownstreamPacket(pkt,msgs);
 
   std::for_each(msgs.begin(),msgs.end(),[](const ControlMessage * p){delete p;});
@@ -433,11 +585,41 @@ void EMANE::NEMQueuedLayer::handleProcessUpstreamPacket(TimePoint enqueueTime,
 
   ++*pProcessedUpstreamPacket_;
 
+  if(StatisticServiceSingleton::instance()->isPacketLatencyTraceEnabled())
+    {
+      auto now = Clock::now();
+
+      tracePacketLatency(UPSTREAM_STAGE,
+                         UPSTREAM_TOTAL_STAGE,
+                         pkt.stampTrace(now),
+                         std::chrono::duration_cast<Microseconds>(now - pkt.getPacketInfo().getCreationTime()),
+                         std::chrono::duration_cast<Microseconds>(now - enqueueTime));
+    }
+
   doProcessUpstreamPacket(pkt,msgs);
 
   std::for_each(msgs.begin(),msgs.end(),[](const ControlMessage * p){delete p;});
 }
 
+void EMANE::NEMQueuedLayer::tracePacketLatency(std::size_t stage,
+                                                std::size_t totalStage,
+                                                const Microseconds & stageLatency,
+                                                const Microseconds & totalLatency,
+                                                const Microseconds & queueWait)
+{
+  std::lock_guard<std::mutex> m(packetLatencyMutex_);
+
+  // clock differences between emulator instances may produce
+  // negative latencies, which are counted as 0
+  packetLatencyHistograms_[stage].record(std::max(stageLatency.count(),
+                                                  Microseconds::rep{}));
+
+  packetLatencyHistograms_[totalStage].record(std::max(totalLatency.count(),
+                                                       Microseconds::rep{}));
+
+  packetLatencyHistograms_[QUEUE_WAIT_STAGE].record(queueWait.count());
+}
+
 void EMANE::NEMQueuedLayer::handleProcessUpstreamControl(TimePoint enqueueTime,
                                                          const ControlMessages msgs)
 {
@@ -463,6 +645,42 @@ void EMANE::NEMQueuedLayer::handleProcessEvent(TimePoint enqueueTime,
   doProcessEvent(eventId,serialization);
 }
 
+void EMANE::NEMQueuedLayer::handleProcessDecodedEvent(TimePoint enqueueTime,
+                                                      const EventId eventId,
+                                                      const std::shared_ptr<const Event> pEvent,
+                                                      const Serialization serialization)
+{
+  avgQueueWait_.update(std::chrono::duration_cast<Microseconds>(Clock::now() - enqueueTime).count());
+
+  pStatisticHistogramTable_->increment(eventId);
+
+  ++*pProcessedEvent_;
+
+  doProcessDecodedEvent(eventId,pEvent,serialization);
+}
+
+void EMANE::NEMQueuedLayer::handleProcessPendingEvent(TimePoint enqueueTime,
+                                                      const EventId eventId,
+                                                      std::shared_ptr<PendingEvent> pPendingEvent)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  pendingEventMap_.erase(eventId);
+
+  lock.unlock();
+
+  // a coalesced event no longer matches the original serialization
+  if(pPendingEvent->bCoalesced_)
+    {
+      pPendingEvent->serialization_ = pPendingEvent->pEvent_->serialize();
+    }
+
+  handleProcessDecodedEvent(enqueueTime,
+                            eventId,
+                            pPendingEvent->pEvent_,
+                            pPendingEvent->serialization_);
+}
+
 
 void EMANE::NEMQueuedLayer::updateTimerStats(TimePoint enqueueTime,
                                              const TimePoint & expireTime,
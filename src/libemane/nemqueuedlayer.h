@@ -39,13 +39,17 @@
 #include "emane/filedescriptorserviceprovider.h"
 #include "emane/utils/runningaverage.h"
 #include "emane/utils/statistichistogramtable.h"
+#include "emane/utils/loglinearhistogram.h"
+#include "emane/statisticlazytable.h"
 #include "emane/timerserviceprovider.h"
 
+#include <array>
 #include <deque>
 #include <functional>
 #include <thread>
 #include <mutex>
 #include <unordered_map>
+#include <map>
 
 namespace EMANE
 {
@@ -84,6 +88,10 @@ namespace EMANE
 
     void processEvent(const EventId &eventId, const Serialization &serialization) override;
 
+    void processDecodedEvent(const EventId & eventId,
+                             const std::shared_ptr<const Event> & pEvent,
+                             const Serialization & serialization) override;
+
     void processTimedEvent(TimerEventId eventId,
                            const TimePoint & expireTime,
                            const TimePoint & scheduleTime,
@@ -112,6 +120,10 @@ namespace EMANE
 
     virtual void doProcessEvent(const EventId &, const Serialization &) = 0;
 
+    virtual void doProcessDecodedEvent(const EventId &,
+                                       const std::shared_ptr<const Event> &,
+                                       const Serialization &) = 0;
+
     virtual void doProcessTimedEvent(TimerEventId eventId,
                                      const TimePoint & expireTime,
                                      const TimePoint & scheduleTime,
@@ -143,6 +155,19 @@ namespace EMANE
     StatisticNumeric<std::uint64_t> * pProcessedEvent_;
     StatisticNumeric<std::uint64_t> * pProcessedTimedEvent_;
     StatisticNumeric<std::uint64_t> * pProcessedConfiguration_;
+    StatisticNumeric<std::uint64_t> * pCoalescedEvent_;
+
+    // decoded event awaiting processing that newer events of the
+    // same id coalesce into, guarded by mutex_
+    struct PendingEvent
+    {
+      std::shared_ptr<const Event> pEvent_;
+      Serialization serialization_;
+      bool bCoalesced_;
+    };
+
+    using PendingEventMap = std::map<EventId,std::shared_ptr<PendingEvent>>;
+    PendingEventMap pendingEventMap_;
 
     Utils::RunningAverage<double> avgQueueWait_;
     Utils::RunningAverage<double> avgQueueDepth_;
@@ -151,6 +176,18 @@ namespace EMANE
 
     std::unique_ptr<Utils::StatisticHistogramTable<EventId>> pStatisticHistogramTable_;
 
+    // per stage packet latency in microseconds, only updated when
+    // packet latency tracing is enabled and read when the packet
+    // latency table is queried
+    std::array<Utils::LogLinearHistogram,5> packetLatencyHistograms_;
+    std::mutex packetLatencyMutex_;
+
+    void tracePacketLatency(std::size_t stage,
+                            std::size_t totalStage,
+                            const Microseconds & stageLatency,
+                            const Microseconds & totalLatency,
+                            const Microseconds & queueWait);
+
     NEMQueuedLayer(const NEMQueuedLayer &);
 
     void processWorkQueue();
@@ -176,6 +213,15 @@ namespace EMANE
                             const EventId,
                             const Serialization);
 
+    void handleProcessDecodedEvent(TimePoint enqueueTime,
+                                   const EventId,
+                                   const std::shared_ptr<const Event>,
+                                   const Serialization);
+
+    void handleProcessPendingEvent(TimePoint enqueueTime,
+                                   const EventId,
+                                   std::shared_ptr<PendingEvent>);
+
     void handleProcessTimedEvent(TimePoint enqueueTime,
                                  TimerEventId eventId,
                                  const TimePoint & expireTime,
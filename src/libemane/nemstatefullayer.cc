@@ -108,6 +108,13 @@ void EMANE::NEMStatefulLayer::processEvent(const EventId & id,
   pState_->processEvent(this,pLayer_.get(),id,serialization);
 }
 
+void EMANE::NEMStatefulLayer::processDecodedEvent(const EventId & id,
+                                                  const std::shared_ptr<const Event> & pEvent,
+                                                  const Serialization & serialization)
+{
+  pState_->processDecodedEvent(this,pLayer_.get(),id,pEvent,serialization);
+}
+
 void EMANE::NEMStatefulLayer::setUpstreamTransport(UpstreamTransport * pUpstreamTransport)
 {
   pLayer_->setUpstreamTransport(pUpstreamTransport);
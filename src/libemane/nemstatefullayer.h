@@ -102,6 +102,10 @@ namespace EMANE
     void processEvent(const EventId & eventId,
                       const Serialization & serialization) override;
 
+    void processDecodedEvent(const EventId & eventId,
+                             const std::shared_ptr<const Event> & pEvent,
+                             const Serialization & serialization) override;
+
     void processTimedEvent(TimerEventId eventId,
                            const TimePoint & expireTime,
                            const TimePoint & scheduleTime,
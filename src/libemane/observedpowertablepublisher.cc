@@ -56,16 +56,28 @@ void EMANE::ObservedPowerTablePublisher::registerStatistics(StatisticRegistrar &
 {
 
   pObservedPowerTable_ =
-    statisticRegistrar.registerTable<ObservedPowerTableKey>("ObservedPowerTable",
-                                                            {"NEM",
-                                                             "Rx Antenna",
-                                                             "Tx Antenna",
-                                                             "Frequency",
-                                                             "Spectral Mask",
-                                                             "Rx Power",
-                                                             "Last Packet Time"},
-                                                            StatisticProperties::NONE,
-                                                            "Shows the calculated observed power for the last received segment.");
+    statisticRegistrar.registerLazyTable<ObservedPowerTableKey,ObservedPowerTableRow>("ObservedPowerTable",
+                                                                                      {"NEM",
+                                                                                       "Rx Antenna",
+                                                                                       "Tx Antenna",
+                                                                                       "Frequency",
+                                                                                       "Spectral Mask",
+                                                                                       "Rx Power",
+                                                                                       "Last Packet Time"},
+                                                                                      [](const ObservedPowerTableKey & key,
+                                                                                         const ObservedPowerTableRow & row)
+                                                                                      {
+                                                                                        return std::vector<Any>{
+                                                                                          Any{std::get<0>(key)},
+                                                                                          Any{std::get<1>(key)},
+                                                                                          Any{std::get<2>(key)},
+                                                                                          Any{std::get<3>(key)},
+                                                                                          Any{row.spectralMaskIndex},
+                                                                                          Any{row.dObservedPowerdBm},
+                                                                                          Any{std::chrono::duration_cast<DoubleSeconds>(row.rxTime.time_since_epoch()).count()}};
+                                                                                      },
+                                                                                      StatisticProperties::NONE,
+                                                                                      "Shows the calculated observed power for the last received segment.");
 }
 
 void EMANE::ObservedPowerTablePublisher::update(NEMId nemId,
@@ -76,32 +88,8 @@ void EMANE::ObservedPowerTablePublisher::update(NEMId nemId,
                                                 double dObservedPowerdBm,
                                                 const TimePoint & rxTime)
 {
-  auto key = ObservedPowerTableKey{nemId,rxAntennaIndex,txAntennaIndex,u64Frequency};
-
-  if(observedPowerTableSet_.count(key))
-    {
-      pObservedPowerTable_->setRow(key,
-                                   {
-                                     Any{nemId},
-                                     Any{rxAntennaIndex},
-                                     Any{txAntennaIndex},
-                                     Any{u64Frequency},
-                                     Any{spectralMaskIndex},
-                                     Any{dObservedPowerdBm},
-                                     Any{std::chrono::duration_cast<DoubleSeconds>(rxTime.time_since_epoch()).count()}});
-    }
-  else
-    {
-      pObservedPowerTable_->addRow(key,
-                                   {
-                                     Any{nemId},
-                                     Any{rxAntennaIndex},
-                                     Any{txAntennaIndex},
-                                     Any{u64Frequency},
-                                     Any{spectralMaskIndex},
-                                     Any{dObservedPowerdBm},
-                                     Any{std::chrono::duration_cast<DoubleSeconds>(rxTime.time_since_epoch()).count()}});
-
-      observedPowerTableSet_.insert(key);
-    }
+  pObservedPowerTable_->setRow(ObservedPowerTableKey{nemId,rxAntennaIndex,txAntennaIndex,u64Frequency},
+                               ObservedPowerTableRow{spectralMaskIndex,
+                                                     dObservedPowerdBm,
+                                                     rxTime});
 }
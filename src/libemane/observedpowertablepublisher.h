@@ -34,10 +34,9 @@
 #define EMANEOBSERVEDPOWERTABLEPUBLISHER_HEADER_
 
 #include "emane/types.h"
-#include "emane/statistictable.h"
+#include "emane/statisticlazytable.h"
 #include "emane/statisticregistrar.h"
 
-#include <set>
 #include <tuple>
 
 namespace EMANE
@@ -58,9 +57,14 @@ namespace EMANE
     using ObservedPowerTableKey = std::tuple<NEMId,AntennaIndex,AntennaIndex,std::uint64_t>;
 
   private:
-    StatisticTable<ObservedPowerTableKey> * pObservedPowerTable_;
-    using ObservedPowerTableSet = std::set<ObservedPowerTableKey>;
-    ObservedPowerTableSet observedPowerTableSet_;
+    struct ObservedPowerTableRow
+    {
+      SpectralMaskIndex spectralMaskIndex;
+      double dObservedPowerdBm;
+      TimePoint rxTime;
+    };
+
+    StatisticLazyTable<ObservedPowerTableKey,ObservedPowerTableRow> * pObservedPowerTable_;
   };
 }
 
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "otacapture.h"
+#include "otaexception.h"
+#include "logservice.h"
+
+#include <cstring>
+
+namespace
+{
+  const size_t CAPTURE_BUFFER_SIZE{1048576};
+}
+
+EMANE::OTACapture::OTACapture():
+  bOpen_{},
+  pFile_{}{}
+
+EMANE::OTACapture::~OTACapture()
+{
+  close();
+}
+
+void EMANE::OTACapture::open(const std::string & sPath, const uuid_t & uuid)
+{
+  std::lock_guard<std::mutex> m(mutex_);
+
+  if(pFile_)
+    {
+      return;
+    }
+
+  if(!(pFile_ = fopen(sPath.c_str(),"wb")))
+    {
+      throw makeException<OTAException>("unable to open OTA capture %s: %s",
+                                        sPath.c_str(),
+                                        strerror(errno));
+    }
+
+  setvbuf(pFile_,nullptr,_IOFBF,CAPTURE_BUFFER_SIZE);
+
+  OTACaptureFormat::FileHeader header{};
+  header.u64Magic = OTACaptureFormat::MAGIC;
+  header.u32Version = OTACaptureFormat::FORMAT_VERSION;
+  memcpy(header.uuid,uuid,sizeof(header.uuid));
+
+  if(fwrite(&header,sizeof(header),1,pFile_) != 1)
+    {
+      int iErrno{errno};
+
+      fclose(pFile_);
+
+      pFile_ = nullptr;
+
+      throw makeException<OTAException>("unable to write OTA capture %s: %s",
+                                        sPath.c_str(),
+                                        strerror(iErrno));
+    }
+
+  sPath_ = sPath;
+
+  bOpen_ = true;
+}
+
+void EMANE::OTACapture::close()
+{
+  std::lock_guard<std::mutex> m(mutex_);
+
+  if(pFile_)
+    {
+      bOpen_ = false;
+
+      if(fclose(pFile_))
+        {
+          LOGGER_STANDARD_LOGGING(*LogServiceSingleton::instance(),
+                                  ERROR_LEVEL,
+                                  "OTACapture unable to close %s: %s",
+                                  sPath_.c_str(),
+                                  strerror(errno));
+        }
+
+      pFile_ = nullptr;
+    }
+}
+
+void EMANE::OTACapture::recordOTA(const TimePoint & timestamp,
+                                  NEMId source,
+                                  NEMId destination,
+                                  const uuid_t & remoteUUID,
+                                  size_t eventsSize,
+                                  size_t controlsSize,
+                                  size_t dataSize,
+                                  const Utils::VectorIO & vectorIO)
+{
+  OTACaptureFormat::OTARecord record{};
+  record.u16Source = source;
+  record.u16Destination = destination;
+  record.u32EventsSize = eventsSize;
+  record.u32ControlsSize = controlsSize;
+  record.u32DataSize = dataSize;
+  memcpy(record.uuid,remoteUUID,sizeof(record.uuid));
+
+  size_t length{sizeof(record)};
+
+  for(const auto & entry : vectorIO)
+    {
+      length += entry.iov_len;
+    }
+
+  std::lock_guard<std::mutex> m(mutex_);
+
+  if(pFile_)
+    {
+      bool bWritten{writeRecordHeader(timestamp,
+                                      OTACaptureFormat::RecordType::OTA,
+                                      length) &&
+                    write(&record,sizeof(record))};
+
+      for(auto iter = vectorIO.begin(); bWritten && iter != vectorIO.end(); ++iter)
+        {
+          bWritten = write(iter->iov_base,iter->iov_len);
+        }
+
+      if(!bWritten)
+        {
+          abandon();
+        }
+    }
+}
+
+void EMANE::OTACapture::recordEvent(const TimePoint & timestamp,
+                                    NEMId nemId,
+                                    EventId eventId,
+                                    const Serialization & serialization)
+{
+  OTACaptureFormat::EventRecord record{};
+  record.u16NEMId = nemId;
+  record.u16EventId = eventId;
+
+  std::lock_guard<std::mutex> m(mutex_);
+
+  if(pFile_)
+    {
+      if(!writeRecordHeader(timestamp,
+                            OTACaptureFormat::RecordType::EVENT,
+                            sizeof(record) + serialization.size()) ||
+         !write(&record,sizeof(record)) ||
+         !write(serialization.data(),serialization.size()))
+        {
+          abandon();
+        }
+    }
+}
+
+bool EMANE::OTACapture::writeRecordHeader(const TimePoint & timestamp,
+                                          OTACaptureFormat::RecordType type,
+                                          size_t length)
+{
+  OTACaptureFormat::RecordHeader header{};
+  header.u64TimestampMicroseconds =
+    std::chrono::duration_cast<Microseconds>(timestamp.time_since_epoch()).count();
+  header.u32Length = length;
+  header.type = type;
+
+  return write(&header,sizeof(header));
+}
+
+bool EMANE::OTACapture::write(const void * pData, size_t length)
+{
+  return !length || fwrite(pData,length,1,pFile_) == 1;
+}
+
+void EMANE::OTACapture::abandon()
+{
+  // a partial record leaves the remainder of the file unreadable, so
+  // stop capturing on the first failure
+  LOGGER_STANDARD_LOGGING(*LogServiceSingleton::instance(),
+                          ERROR_LEVEL,
+                          "OTACapture unable to write %s, capture stopped: %s",
+                          sPath_.c_str(),
+                          strerror(errno));
+
+  bOpen_ = false;
+
+  fclose(pFile_);
+
+  pFile_ = nullptr;
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANEOTACAPTURE_HEADER_
+#define EMANEOTACAPTURE_HEADER_
+
+#include "emane/types.h"
+#include "emane/serializable.h"
+#include "emane/utils/vectorio.h"
+#include "otacaptureformat.h"
+
+#include <string>
+#include <mutex>
+#include <atomic>
+#include <cstdio>
+#include <uuid.h>
+
+namespace EMANE
+{
+  /**
+   * @class OTACapture
+   *
+   * @brief Records received OTA messages and event channel events to
+   * a capture file for offline replay.
+   *
+   * Records are written through a large stdio buffer so the receive
+   * threads only pay for a copy while capturing. Both OTA and event
+   * channel receive threads may record concurrently. A write failure
+   * is logged once and closes the capture.
+   *
+   * @see otacaptureformat.h for the file layout.
+   */
+  class OTACapture
+  {
+  public:
+    OTACapture();
+
+    ~OTACapture();
+
+    /**
+     * Creates the capture file and writes the file header
+     *
+     * @param sPath Capture file path
+     * @param uuid Emulator instance UUID
+     *
+     * @throw OTAException when the file cannot be created
+     */
+    void open(const std::string & sPath, const uuid_t & uuid);
+
+    void close();
+
+    bool isOpen() const
+    {
+      return bOpen_.load(std::memory_order_relaxed);
+    }
+
+    void recordOTA(const TimePoint & timestamp,
+                   NEMId source,
+                   NEMId destination,
+                   const uuid_t & remoteUUID,
+                   size_t eventsSize,
+                   size_t controlsSize,
+                   size_t dataSize,
+                   const Utils::VectorIO & vectorIO);
+
+    void recordEvent(const TimePoint & timestamp,
+                     NEMId nemId,
+                     EventId eventId,
+                     const Serialization & serialization);
+
+  private:
+    std::mutex mutex_;
+    std::atomic<bool> bOpen_;
+    FILE * pFile_;
+    std::string sPath_;
+
+    bool writeRecordHeader(const TimePoint & timestamp,
+                           OTACaptureFormat::RecordType type,
+                           size_t length);
+
+    bool write(const void * pData, size_t length);
+
+    void abandon();
+  };
+}
+
+#endif // EMANEOTACAPTURE_HEADER_
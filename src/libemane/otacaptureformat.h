@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANEOTACAPTUREFORMAT_HEADER_
+#define EMANEOTACAPTUREFORMAT_HEADER_
+
+#include <cstdint>
+
+/**
+ * @file otacaptureformat.h
+ *
+ * Layout of the OTA capture file written by the OTA manager when the
+ * @a otamanagercapturefile platform parameter is set.
+ *
+ * The file starts with a FileHeader followed by a sequence of
+ * records. Each record is a RecordHeader followed by
+ * RecordHeader::u32Length bytes:
+ *
+ * - RecordType::OTA: an OTARecord followed by the reassembled OTA
+ *   message payload (events, controls and data, in that order). OTA
+ *   messages sent between NEMs on the same platform are recorded
+ *   with the uuid of the recording emulator instance.
+ * - RecordType::EVENT: an EventRecord followed by the event
+ *   serialization of an event received on the event channel.
+ *
+ * Events received as part of an OTA message are only present in the
+ * OTA record. All values are native byte order.
+ */
+
+namespace EMANE
+{
+  namespace OTACaptureFormat
+  {
+    /** 'EOTACAPT' */
+    constexpr std::uint64_t MAGIC{0x454f544143415054};
+
+    constexpr std::uint32_t FORMAT_VERSION{1};
+
+    enum class RecordType : std::uint8_t
+      {
+        OTA = 1,
+        EVENT = 2,
+      };
+
+    struct FileHeader
+    {
+      std::uint64_t u64Magic;
+      std::uint32_t u32Version;
+      std::uint32_t u32Reserved;
+      std::uint8_t uuid[16]; /**< emulator instance uuid */
+    };
+
+    struct RecordHeader
+    {
+      std::uint64_t u64TimestampMicroseconds; /**< receive time since epoch */
+      std::uint32_t u32Length; /**< bytes following this header */
+      RecordType type;
+      std::uint8_t u8Reserved[3];
+    };
+
+    struct OTARecord
+    {
+      std::uint16_t u16Source;
+      std::uint16_t u16Destination;
+      std::uint32_t u32EventsSize;
+      std::uint32_t u32ControlsSize;
+      std::uint32_t u32DataSize;
+      std::uint8_t uuid[16]; /**< sending emulator instance uuid */
+    };
+
+    struct EventRecord
+    {
+      std::uint16_t u16NEMId;
+      std::uint16_t u16EventId;
+      std::uint32_t u32Reserved;
+    };
+
+    static_assert(sizeof(FileHeader) == 32,"unexpected capture file header size");
+    static_assert(sizeof(RecordHeader) == 16,"unexpected capture record header size");
+    static_assert(sizeof(OTARecord) == 32,"unexpected capture OTA record size");
+    static_assert(sizeof(EventRecord) == 8,"unexpected capture event record size");
+  }
+}
+
+#endif // EMANEOTACAPTUREFORMAT_HEADER_
@@ -42,16 +42,40 @@
 #include "socketexception.h"
 
 #include "emane/net.h"
+#include "emane/commonphyheader.h"
 #include "emane/utils/threadutils.h"
+#include "emane/utils/threadplacement.h"
 #include "emane/controls/otatransmittercontrolmessage.h"
 #include "emane/controls/serializedcontrolmessage.h"
 
+#include <google/protobuf/arena.h>
+
 #include <sstream>
 #include <algorithm>
 #include <uuid.h>
 
 namespace
 {
+  /*
+   * Decodes the common PHY header once and attaches it to the shared
+   * packet data so that each local NEM receiving a copy of the packet
+   * can skip the decode. On failure the packet is left as is and each
+   * NEM will decode (and report) the header itself.
+   */
+  void attachCommonPHYHeader(EMANE::UpstreamPacket & pkt)
+  {
+    EMANE::UpstreamPacket decodePacket{pkt};
+
+    try
+      {
+        auto pCommonPHYHeader = std::make_shared<const EMANE::CommonPHYHeader>(decodePacket);
+
+        pkt.attachCommonPHYHeader(pCommonPHYHeader,pkt.length() - decodePacket.length());
+      }
+    catch(EMANE::SerializationException &)
+      {}
+  }
+
   struct PartInfo
   {
     std::uint8_t u8More_; /**< More parts to follow*/
@@ -133,6 +157,27 @@ void EMANE::OTAManager::setStatEventCountRowLimit(size_t rows)
   eventStatisticPublisher_.setRowLimit(rows);
 }
 
+void EMANE::OTAManager::openCapture(const std::string & sPath, const uuid_t & uuid)
+{
+  capture_.open(sPath,uuid);
+}
+
+void EMANE::OTAManager::closeCapture()
+{
+  capture_.close();
+}
+
+void EMANE::OTAManager::captureEvent(const TimePoint & timestamp,
+                                     NEMId nemId,
+                                     EventId eventId,
+                                     const Serialization & serialization)
+{
+  if(capture_.isOpen())
+    {
+      capture_.recordEvent(timestamp,nemId,eventId,serialization);
+    }
+}
+
 void EMANE::OTAManager::sendOTAPacket(NEMId id,
                                       const DownstreamPacket & pkt,
                                       const ControlMessages & msgs) const
@@ -165,7 +210,7 @@ void EMANE::OTAManager::sendOTAPacket(NEMId id,
                                                                  serialization,
                                                                  id);
 
-          if(bOpen_)
+          if(bOpen_ || capture_.isOpen())
             {
               auto pSerialization = data.add_serializations();
 
@@ -207,6 +252,16 @@ void EMANE::OTAManager::sendOTAPacket(NEMId id,
             uuid_},
         pkt.getVectorIO());
 
+      if(std::count_if(nemUserMap_.begin(),
+                       nemUserMap_.end(),
+                       [id,&otaTransmitters](const NEMUserMap::value_type & entry)
+                       {
+                         return entry.first != id && !otaTransmitters.count(entry.first);
+                       }) > 1)
+        {
+          attachCommonPHYHeader(upstreamPacket);
+        }
+
       // bounce a copy of the pkt back up to our local NEM stack(s)
       for(NEMUserMap::const_iterator iter = nemUserMap_.begin(), end = nemUserMap_.end();
           iter != end;
@@ -225,6 +280,45 @@ void EMANE::OTAManager::sendOTAPacket(NEMId id,
               iter->second->processOTAPacket(upstreamPacket,ControlMessages());
             }
         }
+
+      // copies sent to other emulator instances are recorded on
+      // receipt, the copy bounced to local NEM stack(s) is recorded
+      // here
+      if(capture_.isOpen())
+        {
+          std::string sEventSerialization{};
+
+          if(!eventSerializations.empty())
+            {
+              data.SerializeToString(&sEventSerialization);
+            }
+
+          ControlMessageSerializer controlMessageSerializer{msgs};
+
+          Utils::VectorIO captureVectorIO{};
+
+          if(!sEventSerialization.empty())
+            {
+              captureVectorIO.push_back({const_cast<char *>(sEventSerialization.c_str()),sEventSerialization.size()});
+            }
+
+          const auto & controlMessageIO = controlMessageSerializer.getVectorIO();
+
+          captureVectorIO.insert(captureVectorIO.end(),controlMessageIO.begin(),controlMessageIO.end());
+
+          const auto & packetIO = pkt.getVectorIO();
+
+          captureVectorIO.insert(captureVectorIO.end(),packetIO.begin(),packetIO.end());
+
+          capture_.recordOTA(now,
+                             pktInfo.getSource(),
+                             pktInfo.getDestination(),
+                             uuid_,
+                             sEventSerialization.size(),
+                             controlMessageSerializer.getLength(),
+                             pkt.length(),
+                             captureVectorIO);
+        }
     }
 
   // send the packet to additional OTAManagers using OTA multicast transport
@@ -471,10 +565,17 @@ void EMANE::OTAManager::open(const INETAddr & otaGroupAddress,
 
 void EMANE::OTAManager::processOTAMessage()
 {
+  Utils::ThreadPlacement::Scope placement{Utils::ThreadPlacement::ThreadClass::OTA};
+
   unsigned char buf[65536];
 
   ssize_t len = 0;
 
+  // OTA headers are parsed into the arena, which is reset after each
+  // message is processed
+  char arenaBlock[4096];
+  google::protobuf::Arena arena{arenaBlock,sizeof(arenaBlock)};
+
   while(1)
     {
       if((len = mcast_.recv(buf,sizeof(buf),0)) > 0)
@@ -490,7 +591,8 @@ void EMANE::OTAManager::processOTAMessage()
 
               len -= sizeof(std::uint16_t);
 
-              EMANEMessage::OTAHeader otaHeader;
+              auto & otaHeader =
+                *google::protobuf::Arena::CreateMessage<EMANEMessage::OTAHeader>(&arena);
 
               size_t payloadIndex{2 + *pu16OTAHeaderLength + sizeof(PartInfo)};
 
@@ -651,6 +753,8 @@ void EMANE::OTAManager::processOTAMessage()
                                       "OTAManager message missing header missing prefix length encoding");
             }
 
+          arena.Reset();
+
           // check to see if there are part assemblies to abandon
           if(lastPartCheckTime_ + partCheckThreshold_ <= now)
             {
@@ -707,6 +811,18 @@ void  EMANE::OTAManager::handleOTAMessage(NEMId source,
                                           size_t dataSize,
                                           const Utils::VectorIO & vectorIO)
 {
+  if(capture_.isOpen())
+    {
+      capture_.recordOTA(now,
+                         source,
+                         destination,
+                         remoteUUID,
+                         eventsSize,
+                         controlsSize,
+                         dataSize,
+                         vectorIO);
+    }
+
   size_t index{};
   size_t offset{};
 
@@ -801,6 +917,16 @@ void  EMANE::OTAManager::handleOTAMessage(NEMId source,
                                     remoteUUID,
                                     pktInfo.getSource());
 
+      if(std::count_if(nemUserMap_.begin(),
+                       nemUserMap_.end(),
+                       [&otaTransmitters](const NEMUserMap::value_type & entry)
+                       {
+                         return !otaTransmitters.count(entry.first);
+                       }) > 1)
+        {
+          attachCommonPHYHeader(pkt);
+        }
+
       // for each local NEM stack
       for(NEMUserMap::const_iterator iter = nemUserMap_.begin(), end = nemUserMap_.end();
           iter != end; ++iter)
@@ -39,6 +39,7 @@
 #include "multicastsocket.h"
 #include "otastatisticpublisher.h"
 #include "eventstatisticpublisher.h"
+#include "otacapture.h"
 
 #include "emane/utils/singleton.h"
 
@@ -107,6 +108,29 @@ namespace EMANE
 
     void setStatEventCountRowLimit(size_t rows);
 
+    /**
+     * Starts recording received OTA messages, OTA messages sent
+     * between local NEMs and event channel events for offline
+     * replay
+     *
+     * @param sPath Capture file path
+     * @param uuid Emulator instance UUID
+     *
+     * @throw OTAException when the capture file cannot be created
+     */
+    void openCapture(const std::string & sPath, const uuid_t & uuid);
+
+    void closeCapture();
+
+    /**
+     * Records an event published locally or received on the event
+     * channel if a capture is open
+     */
+    void captureEvent(const TimePoint & timestamp,
+                      NEMId nemId,
+                      EventId eventId,
+                      const Serialization & serialization);
+
   private:
     typedef std::map<NEMId,OTAUser *> NEMUserMap;
     std::thread thread_;
@@ -122,6 +146,7 @@ namespace EMANE
     mutable OTAStatisticPublisher otaStatisticPublisher_;
     mutable EventStatisticPublisher eventStatisticPublisher_;
     mutable std::atomic<std::uint64_t> u64SequenceNumber_;
+    mutable OTACapture capture_;
 
     using PartKey = std::tuple<NEMId, // source NEM
                                std::uint64_t>; // sequence number
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "emane/utils/pcrcurve.h"
+#include "emane/utils/assetcache.h"
+#include "emane/configurationexception.h"
+
+namespace
+{
+  std::int32_t scaleSINR(float fSINR)
+  {
+    return static_cast<std::int32_t>(std::lround(fSINR * 100));
+  }
+}
+
+EMANE::Utils::PCRCurve::PCRCurve(const Points & points):
+  i32MinScaledSINR_{},
+  i32MaxScaledSINR_{}
+{
+  if(points.empty())
+    {
+      throw makeException<ConfigurationException>("need at least 1 point to define a pcr curve");
+    }
+
+  i32MinScaledSINR_ = scaleSINR(points.front().first);
+  i32MaxScaledSINR_ = scaleSINR(points.back().first);
+
+  if(i32MaxScaledSINR_ < i32MinScaledSINR_)
+    {
+      throw makeException<ConfigurationException>("pcr curve sinr values must be in increasing order");
+    }
+
+  pors_.reserve(i32MaxScaledSINR_ - i32MinScaledSINR_ + 1);
+
+  for(std::size_t i = 0; i + 1 < points.size(); ++i)
+    {
+      auto x0 = scaleSINR(points[i].first);
+      auto y0 = points[i].second;
+      auto x1 = scaleSINR(points[i+1].first);
+      auto y1 = points[i+1].second;
+
+      if(x1 <= x0)
+        {
+          throw makeException<ConfigurationException>("pcr curve sinr values must be in increasing order: %3.2f",
+                                                      points[i+1].first);
+        }
+
+      auto slope = (y1 - y0) / (x1 - x0);
+
+      pors_.push_back(y0);
+
+      for(auto x = x0 + 1; x < x1; ++x)
+        {
+          pors_.push_back(y1 - (x1 - x) * slope);
+        }
+    }
+
+  pors_.push_back(points.back().second);
+}
+
+EMANE::Utils::PCRCurveTable::PCRCurveTable(const Curves & curves,
+                                           std::size_t modifierLengthBytes):
+  modifierLengthBytes_{modifierLengthBytes}
+{
+  keys_.reserve(curves.size());
+  curves_.reserve(curves.size());
+
+  for(const auto & entry : curves)
+    {
+      keys_.push_back(entry.first);
+      curves_.emplace_back(entry.second);
+    }
+}
+
+std::size_t EMANE::Utils::PCRCurve::getBytes() const
+{
+  return sizeof(*this) + pors_.capacity() * sizeof(float);
+}
+
+std::size_t EMANE::Utils::PCRCurveTable::getBytes() const
+{
+  std::size_t bytes{sizeof(*this) + keys_.capacity() * sizeof(std::uint64_t)};
+
+  for(const auto & curve : curves_)
+    {
+      bytes += curve.getBytes();
+    }
+
+  return bytes;
+}
+
+EMANE::Utils::PCRCurveTablePtr
+EMANE::Utils::loadPCRCurveTable(const std::string & sFormat,
+                                const std::string & sFileName,
+                                const std::function<PCRCurveTable()> & loader)
+{
+  return AssetCache::instance()->load<PCRCurveTable>(sFormat,
+                                                     sFileName,
+                                                     [&loader](const std::string &)
+                                                     {
+                                                       return loader();
+                                                     });
+}
@@ -135,6 +135,13 @@ void EMANE::PHYLayer::doProcessEvent(const EventId & eventId,
   pImplementor_->processEvent(eventId,serialization);
 }
 
+void EMANE::PHYLayer::doProcessDecodedEvent(const EventId & eventId,
+                                            const std::shared_ptr<const Event> & pEvent,
+                                            const Serialization & serialization)
+{
+  pImplementor_->processDecodedEvent(eventId,pEvent,serialization);
+}
+
 
 
 void EMANE::PHYLayer::doProcessTimedEvent(TimerEventId eventId,
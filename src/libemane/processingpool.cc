@@ -31,6 +31,7 @@
  */
 
 #include "emane/utils/processingpool.h"
+#include "emane/utils/threadplacement.h"
 
 EMANE::Utils::ProcessingPool::ProcessingPool():
   bCancel_{}{}
@@ -41,13 +42,15 @@ EMANE::Utils::ProcessingPool::~ProcessingPool()
   stop();
 }
 
-void EMANE::Utils::ProcessingPool::start(std::size_t size)
+void EMANE::Utils::ProcessingPool::start(std::size_t size,
+                                         NEMId id,
+                                         ThreadPlacement::ThreadClass threadClass)
 {
   if(threads_.empty())
     {
       for(std::size_t i = 0; i < size; ++i)
         {
-          threads_.push_back(std::thread{&ProcessingPool::worker,this});
+          threads_.push_back(std::thread{&ProcessingPool::worker,this,id,threadClass});
         }
     }
 }
@@ -78,8 +81,10 @@ bool EMANE::Utils::ProcessingPool::isRunning() const
   return !threads_.empty();
 }
 
-void EMANE::Utils::ProcessingPool::worker()
+void EMANE::Utils::ProcessingPool::worker(NEMId id, ThreadPlacement::ThreadClass threadClass)
 {
+  ThreadPlacement::Scope placement{threadClass,id};
+
   FunctionWrapper f;
 
   while(!bCancel_)
@@ -56,20 +56,36 @@ void EMANE::ReceivePowerTablePublisher::registerStatistics(StatisticRegistrar &
 {
 
   pReceivePowerTable_ =
-    statisticRegistrar.registerTable<ReceivePowerTableKey>("ReceivePowerTable",
-                                                           {"NEM",
-                                                            "Rx Antenna",
-                                                            "Tx Antenna",
-                                                            "Frequency",
-                                                            "Rx Power",
-                                                            "Tx Gain",
-                                                            "Rx Gain",
-                                                            "Tx Power",
-                                                            "Pathloss",
-                                                            "Doppler",
-                                                            "Last Packet Time"},
-                                                           StatisticProperties::NONE,
-                                                           "Shows the calculated receive power for the last received segment.");
+    statisticRegistrar.registerLazyTable<ReceivePowerTableKey,ReceivePowerTableRow>("ReceivePowerTable",
+                                                                                    {"NEM",
+                                                                                     "Rx Antenna",
+                                                                                     "Tx Antenna",
+                                                                                     "Frequency",
+                                                                                     "Rx Power",
+                                                                                     "Tx Gain",
+                                                                                     "Rx Gain",
+                                                                                     "Tx Power",
+                                                                                     "Pathloss",
+                                                                                     "Doppler",
+                                                                                     "Last Packet Time"},
+                                                                                    [](const ReceivePowerTableKey & key,
+                                                                                       const ReceivePowerTableRow & row)
+                                                                                    {
+                                                                                      return std::vector<Any>{
+                                                                                        Any{std::get<0>(key)},
+                                                                                        Any{std::get<1>(key)},
+                                                                                        Any{std::get<2>(key)},
+                                                                                        Any{std::get<3>(key)},
+                                                                                        Any{row.dReceivePowerdBm},
+                                                                                        Any{row.dTxGaindBi},
+                                                                                        Any{row.dRxGaindBi},
+                                                                                        Any{row.dTransmitPowerdBm},
+                                                                                        Any{row.dPathlossdB},
+                                                                                        Any{row.dDopplerShiftHz},
+                                                                                        Any{std::chrono::duration_cast<DoubleSeconds>(row.rxTime.time_since_epoch()).count()}};
+                                                                                    },
+                                                                                    StatisticProperties::NONE,
+                                                                                    "Shows the calculated receive power for the last received segment.");
 }
 
 void EMANE::ReceivePowerTablePublisher::update(NEMId nemId,
@@ -84,40 +100,12 @@ void EMANE::ReceivePowerTablePublisher::update(NEMId nemId,
                                                double dDopplerShiftHz,
                                                const TimePoint & rxTime)
 {
-  auto key = ReceivePowerTableKey{nemId,rxAntennaIndex,txAntennaIndex,u64Frequency};
-
-  if(receivePowerTableSet_.count(key))
-    {
-      pReceivePowerTable_->setRow(key,
-                                  {
-                                    Any{nemId},
-                                    Any{rxAntennaIndex},
-                                    Any{txAntennaIndex},
-                                    Any{u64Frequency},
-                                    Any{dReceivePowerdBm},
-                                    Any{dTxGaindBi},
-                                    Any{dRxGaindBi},
-                                    Any{dTransmitPowerdBm},
-                                    Any{dPathlossdB},
-                                    Any{dDopplerShiftHz},
-                                    Any{std::chrono::duration_cast<DoubleSeconds>(rxTime.time_since_epoch()).count()}});
-    }
-  else
-    {
-      pReceivePowerTable_->addRow(key,
-                                  {
-                                    Any{nemId},
-                                    Any{rxAntennaIndex},
-                                    Any{txAntennaIndex},
-                                    Any{u64Frequency},
-                                    Any{dReceivePowerdBm},
-                                    Any{dTxGaindBi},
-                                    Any{dRxGaindBi},
-                                    Any{dTransmitPowerdBm},
-                                    Any{dPathlossdB},
-                                    Any{dDopplerShiftHz},
-                                    Any{std::chrono::duration_cast<DoubleSeconds>(rxTime.time_since_epoch()).count()}});
-
-      receivePowerTableSet_.insert(key);
-    }
+  pReceivePowerTable_->setRow(ReceivePowerTableKey{nemId,rxAntennaIndex,txAntennaIndex,u64Frequency},
+                              ReceivePowerTableRow{dReceivePowerdBm,
+                                                   dTxGaindBi,
+                                                   dRxGaindBi,
+                                                   dTransmitPowerdBm,
+                                                   dPathlossdB,
+                                                   dDopplerShiftHz,
+                                                   rxTime});
 }
@@ -34,10 +34,9 @@
 #define EMANERECEIVEPOWERTABLEPUBLISHER_HEADER_
 
 #include "emane/types.h"
-#include "emane/statistictable.h"
+#include "emane/statisticlazytable.h"
 #include "emane/statisticregistrar.h"
 
-#include <set>
 #include <tuple>
 
 namespace EMANE
@@ -62,9 +61,18 @@ namespace EMANE
     using ReceivePowerTableKey = std::tuple<NEMId,AntennaIndex,AntennaIndex,std::uint64_t>;
 
   private:
-    StatisticTable<ReceivePowerTableKey> * pReceivePowerTable_;
-    using ReceivePowerTableSet = std::set<ReceivePowerTableKey>;
-    ReceivePowerTableSet receivePowerTableSet_;
+    struct ReceivePowerTableRow
+    {
+      double dReceivePowerdBm;
+      double dTxGaindBi;
+      double dRxGaindBi;
+      double dTransmitPowerdBm;
+      double dPathlossdB;
+      double dDopplerShiftHz;
+      TimePoint rxTime;
+    };
+
+    StatisticLazyTable<ReceivePowerTableKey,ReceivePowerTableRow> * pReceivePowerTable_;
   };
 }
 
@@ -140,6 +140,13 @@ void EMANE::ShimLayer::doProcessEvent(const EventId & eventId,
   pImplementor_->processEvent(eventId,serialization);
 }
 
+void EMANE::ShimLayer::doProcessDecodedEvent(const EventId & eventId,
+                                             const std::shared_ptr<const Event> & pEvent,
+                                             const Serialization & serialization)
+{
+  pImplementor_->processDecodedEvent(eventId,pEvent,serialization);
+}
+
 
 void EMANE::ShimLayer::doProcessTimedEvent(TimerEventId eventId,
                                            const TimePoint & expireTime,
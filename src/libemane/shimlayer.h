@@ -92,6 +92,10 @@ namespace EMANE
 
     void doProcessEvent(const EventId & , const Serialization &) override;
 
+    void doProcessDecodedEvent(const EventId &,
+                               const std::shared_ptr<const Event> &,
+                               const Serialization &) override;
+
     void doProcessTimedEvent(TimerEventId eventId,
                              const TimePoint & expireTime,
                              const TimePoint & scheduleTime,
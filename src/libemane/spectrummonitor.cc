@@ -564,6 +564,44 @@ EMANE::SpectrumMonitor::request_i(const TimePoint & now,
 {
   std::lock_guard<std::mutex> m(mutex_);
 
+  return requestLocked(now,u64FrequencyHz,duration,timepoint);
+}
+
+std::vector<EMANE::SpectrumWindowResult>
+EMANE::SpectrumMonitor::request_i(const TimePoint & now,
+                                  const std::vector<SpectrumWindowRequest> & requests) const
+{
+  std::vector<SpectrumWindowResult> results{};
+
+  results.reserve(requests.size());
+
+  std::lock_guard<std::mutex> m(mutex_);
+
+  for(const auto & request : requests)
+    {
+      try
+        {
+          results.emplace_back(requestLocked(now,
+                                             request.u64FrequencyHz_,
+                                             request.duration_,
+                                             request.startTime_),
+                               nullptr);
+        }
+      catch(SpectrumServiceException &)
+        {
+          results.emplace_back(SpectrumWindow{},std::current_exception());
+        }
+    }
+
+  return results;
+}
+
+EMANE::SpectrumWindow
+EMANE::SpectrumMonitor::requestLocked(const TimePoint & now,
+                                      std::uint64_t u64FrequencyHz,
+                                      const Microseconds & duration,
+                                      const TimePoint & timepoint) const
+{
   auto validDuration = duration;
 
   if(validDuration > maxDuration_)
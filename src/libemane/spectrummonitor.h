@@ -102,6 +102,10 @@ namespace EMANE
                            const Microseconds & duration = Microseconds::zero(),
                            const TimePoint & timepoint = TimePoint::min()) const;
 
+    std::vector<SpectrumWindowResult>
+    request_i(const TimePoint & now,
+              const std::vector<SpectrumWindowRequest> & requests) const;
+
     void initializeFilter(FilterIndex filterIndex,
                           std::uint64_t u64FrequencyHz,
                           std::uint64_t u64BandwidthHz,
@@ -159,6 +163,11 @@ namespace EMANE
     mutable std::mutex mutex_;
     FrequencySet foi_;
 
+    SpectrumWindow requestLocked(const TimePoint & now,
+                                 std::uint64_t u64FrequencyHz,
+                                 const Microseconds & duration,
+                                 const TimePoint & timepoint) const;
+
     using FilterRecord = std::tuple<NoiseRecorder *, // noise recorder
                                     SpectralMaskManager::MaskOverlap, // overlap
                                     std::uint64_t, // tx freq
@@ -230,6 +230,22 @@ EMANE::SpectrumService::requestAntenna(AntennaIndex antennaIndex,
                                                 antennaIndex);
 }
 
+std::vector<EMANE::SpectrumWindowResult>
+EMANE::SpectrumService::request(const std::vector<SpectrumWindowRequest> & requests) const
+{
+  std::lock_guard<std::mutex> m(mutex_);
+
+  const auto iter = spectrumMonitorMap_.find(DEFAULT_ANTENNA_INDEX);
+
+  if(iter != spectrumMonitorMap_.end())
+    {
+      return iter->second->request_i(Clock::now(),requests);
+    }
+
+  throw makeException<SpectrumServiceException>("unknown antenna index: %hu",
+                                                DEFAULT_ANTENNA_INDEX);
+}
+
 // test harness access
 EMANE::SpectrumWindow
 EMANE::SpectrumService::request_i(const TimePoint & now,
@@ -87,6 +87,9 @@ namespace EMANE
                            const Microseconds & duration = Microseconds::zero(),
                            const TimePoint & timepoint = TimePoint::min()) const override;
 
+    std::vector<SpectrumWindowResult>
+    request(const std::vector<SpectrumWindowRequest> & requests) const override;
+
     SpectrumWindow requestAntenna(AntennaIndex antennaIndex,
                                   std::uint64_t u64FrequencyHz,
                                   const Microseconds & duration = Microseconds::zero(),
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "startupprofiler.h"
+#include "statisticregistrarproxy.h"
+#include "logservice.h"
+
+namespace
+{
+  const EMANE::StatisticTableLabels StartupTimingLabels =
+    {
+      "NEM",
+      "Parse",
+      "Load",
+      "Configure",
+      "Start",
+      "Total",
+    };
+}
+
+EMANE::StartupProfiler::StartupProfiler()
+{
+  auto statisticRegistrar = StatisticRegistrarProxy{*StatisticServiceSingleton::instance(),0};
+
+  pStartupTimingTable_ =
+    statisticRegistrar.registerTable<NEMId>("StartupTimingTable",
+                                            StartupTimingLabels,
+                                            StatisticProperties::NONE,
+                                            "Per NEM startup timing breakdown in microseconds.");
+}
+
+void EMANE::StartupProfiler::record(NEMId id,
+                                    Phase phase,
+                                    const Microseconds & duration)
+{
+  std::lock_guard<std::mutex> m(mutex_);
+
+  timings_[id][static_cast<std::size_t>(phase)] += duration;
+}
+
+void EMANE::StartupProfiler::report()
+{
+  std::lock_guard<std::mutex> m(mutex_);
+
+  Timings totals{};
+
+  for(const auto & entry : timings_)
+    {
+      const auto & timings = entry.second;
+
+      Microseconds total{};
+
+      for(std::size_t i = 0; i < timings.size(); ++i)
+        {
+          total += timings[i];
+          totals[i] += timings[i];
+        }
+
+      LOGGER_STANDARD_LOGGING(*LogServiceSingleton::instance(),
+                              INFO_LEVEL,
+                              "NEM %03hu startup parse: %ju us load: %ju us"
+                              " configure: %ju us start: %ju us total: %ju us",
+                              entry.first,
+                              static_cast<std::uintmax_t>(timings[0].count()),
+                              static_cast<std::uintmax_t>(timings[1].count()),
+                              static_cast<std::uintmax_t>(timings[2].count()),
+                              static_cast<std::uintmax_t>(timings[3].count()),
+                              static_cast<std::uintmax_t>(total.count()));
+
+      std::vector<Any> row{Any{entry.first}};
+
+      for(const auto & timing : timings)
+        {
+          row.push_back(Any{static_cast<std::uint64_t>(timing.count())});
+        }
+
+      row.push_back(Any{static_cast<std::uint64_t>(total.count())});
+
+      pStartupTimingTable_->deleteRow(entry.first);
+
+      pStartupTimingTable_->addRow(entry.first,std::move(row));
+    }
+
+  LOGGER_STANDARD_LOGGING(*LogServiceSingleton::instance(),
+                          INFO_LEVEL,
+                          "startup %zu NEMs cumulative parse: %ju us load: %ju us"
+                          " configure: %ju us start: %ju us",
+                          timings_.size(),
+                          static_cast<std::uintmax_t>(totals[0].count()),
+                          static_cast<std::uintmax_t>(totals[1].count()),
+                          static_cast<std::uintmax_t>(totals[2].count()),
+                          static_cast<std::uintmax_t>(totals[3].count()));
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANESTARTUPPROFILER_HEADER_
+#define EMANESTARTUPPROFILER_HEADER_
+
+#include "emane/types.h"
+#include "emane/statistictable.h"
+#include "emane/utils/singleton.h"
+
+#include <array>
+#include <map>
+#include <mutex>
+
+namespace EMANE
+{
+  /**
+   * @class StartupProfiler
+   *
+   * @brief Collects the per NEM startup timing breakdown (parse,
+   * load, configure and start) and publishes it to the log and the
+   * platform StartupTimingTable.
+   *
+   * @note Phases may be recorded from multiple threads.
+   */
+  class StartupProfiler : public Utils::Singleton<StartupProfiler>
+  {
+  public:
+    enum class Phase
+      {
+        PARSE,
+        LOAD,
+        CONFIGURE,
+        START,
+      };
+
+    /**
+     * Records the duration of a startup phase for an NEM
+     *
+     * @param id NEM id
+     * @param phase Startup phase
+     * @param duration Time spent in the phase
+     */
+    void record(NEMId id, Phase phase, const Microseconds & duration);
+
+    /**
+     * Logs the per NEM startup timing breakdown and updates the
+     * StartupTimingTable
+     */
+    void report();
+
+  protected:
+    StartupProfiler();
+
+  private:
+    using Timings = std::array<Microseconds,4>;
+
+    std::mutex mutex_;
+    std::map<NEMId,Timings> timings_;
+    StatisticTable<NEMId> * pStartupTimingTable_;
+  };
+}
+
+#endif // EMANESTARTUPPROFILER_HEADER_
@@ -387,3 +387,37 @@ EMANE::StatisticService::clearTable(BuildId buildId,
 
     }
 }
+
+void EMANE::StatisticService::openSnapshot(const std::string & sPath,
+                                           const Microseconds & interval)
+{
+  std::vector<StatisticSnapshot::Entry> entries;
+
+  for(const auto & store : buildIdStatisticStore_)
+    {
+      for(const auto & entry : store.second)
+        {
+          entries.push_back({store.first,
+                             entry.first,
+                             entry.second.second.getType(),
+                             entry.second.first.get()});
+        }
+    }
+
+  snapshot_.open(sPath,interval,entries);
+}
+
+void EMANE::StatisticService::closeSnapshot()
+{
+  snapshot_.close();
+}
+
+void EMANE::StatisticService::setPacketLatencyTraceEnable(bool bEnable)
+{
+  bPacketLatencyTraceEnable_ = bEnable;
+}
+
+bool EMANE::StatisticService::isPacketLatencyTraceEnabled() const
+{
+  return bPacketLatencyTraceEnable_;
+}
@@ -40,11 +40,13 @@
 #include "emane/statistictableinfo.h"
 #include "emane/statisticproperties.h"
 #include "emane/utils/singleton.h"
+#include "statisticsnapshot.h"
 
 #include <string>
 #include <map>
 #include <vector>
 #include <memory>
+#include <atomic>
 
 
 namespace EMANE
@@ -112,6 +114,31 @@ namespace EMANE
 
     StatisticTableManifest getTableManifest(BuildId id ) const;
 
+    /**
+     * Starts publishing all numeric statistics registered so far
+     * to a memory-mapped snapshot file
+     *
+     * @param sPath Snapshot file path
+     * @param interval Snapshot update interval
+     *
+     * @throw StartException when the snapshot cannot be created
+     *
+     * @see statisticsnapshotformat.h
+     */
+    void openSnapshot(const std::string & sPath, const Microseconds & interval);
+
+    void closeSnapshot();
+
+    /**
+     * Enables or disables per packet latency tracing in the NEM
+     * layers
+     *
+     * @param bEnable Enable flag
+     */
+    void setPacketLatencyTraceEnable(bool bEnable);
+
+    bool isPacketLatencyTraceEnabled() const;
+
 
   protected:
     StatisticService() = default;
@@ -130,6 +157,10 @@ namespace EMANE
 
     using BuildIdTableStore = std::map<BuildId,TableStore>;
     BuildIdTableStore buildIdTableStore_;
+
+    StatisticSnapshot snapshot_;
+
+    std::atomic<bool> bPacketLatencyTraceEnable_{};
   };
 
   using StatisticServiceSingleton = StatisticService;
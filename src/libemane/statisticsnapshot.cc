@@ -0,0 +1,363 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "statisticsnapshot.h"
+#include "emane/startexception.h"
+#include "emane/utils/threadplacement.h"
+
+#include <map>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+namespace
+{
+  bool toValueType(EMANE::Any::Type type,
+                   EMANE::StatisticSnapshotFormat::ValueType & valueType)
+  {
+    using EMANE::StatisticSnapshotFormat::ValueType;
+
+    switch(type)
+      {
+      case EMANE::Any::Type::TYPE_INT64:
+      case EMANE::Any::Type::TYPE_INT32:
+      case EMANE::Any::Type::TYPE_INT16:
+      case EMANE::Any::Type::TYPE_INT8:
+        valueType = ValueType::INT64;
+        return true;
+
+      case EMANE::Any::Type::TYPE_UINT64:
+      case EMANE::Any::Type::TYPE_UINT32:
+      case EMANE::Any::Type::TYPE_UINT16:
+      case EMANE::Any::Type::TYPE_UINT8:
+        valueType = ValueType::UINT64;
+        return true;
+
+      case EMANE::Any::Type::TYPE_FLOAT:
+      case EMANE::Any::Type::TYPE_DOUBLE:
+        valueType = ValueType::DOUBLE;
+        return true;
+
+      case EMANE::Any::Type::TYPE_BOOL:
+        valueType = ValueType::BOOL;
+        return true;
+
+      default:
+        return false;
+      }
+  }
+
+  std::uint64_t toRaw(const EMANE::Any & any)
+  {
+    switch(any.getType())
+      {
+      case EMANE::Any::Type::TYPE_INT64:
+        return static_cast<std::uint64_t>(any.asINT64());
+
+      case EMANE::Any::Type::TYPE_INT32:
+        return static_cast<std::uint64_t>(static_cast<std::int64_t>(any.asINT32()));
+
+      case EMANE::Any::Type::TYPE_INT16:
+        return static_cast<std::uint64_t>(static_cast<std::int64_t>(any.asINT16()));
+
+      case EMANE::Any::Type::TYPE_INT8:
+        return static_cast<std::uint64_t>(static_cast<std::int64_t>(any.asINT8()));
+
+      case EMANE::Any::Type::TYPE_UINT64:
+        return any.asUINT64();
+
+      case EMANE::Any::Type::TYPE_UINT32:
+        return any.asUINT32();
+
+      case EMANE::Any::Type::TYPE_UINT16:
+        return any.asUINT16();
+
+      case EMANE::Any::Type::TYPE_UINT8:
+        return any.asUINT8();
+
+      case EMANE::Any::Type::TYPE_FLOAT:
+      case EMANE::Any::Type::TYPE_DOUBLE:
+        {
+          double dValue{any.getType() == EMANE::Any::Type::TYPE_FLOAT ?
+              any.asFloat() : any.asDouble()};
+          std::uint64_t u64Value{};
+          std::memcpy(&u64Value,&dValue,sizeof(u64Value));
+          return u64Value;
+        }
+
+      case EMANE::Any::Type::TYPE_BOOL:
+        return any.asBool();
+
+      default:
+        return 0;
+      }
+  }
+
+  // blocks start on a cache line
+  std::uint64_t alignBlock(std::uint64_t u64Offset)
+  {
+    return (u64Offset + 63) & ~static_cast<std::uint64_t>(63);
+  }
+}
+
+EMANE::StatisticSnapshot::StatisticSnapshot():
+  iFd_{-1},
+  pBase_{},
+  size_{},
+  interval_{},
+  bRunning_{}{}
+
+EMANE::StatisticSnapshot::~StatisticSnapshot()
+{
+  close();
+}
+
+void EMANE::StatisticSnapshot::open(const std::string & sPath,
+                                    const Microseconds & interval,
+                                    const std::vector<Entry> & entries)
+{
+  using namespace StatisticSnapshotFormat;
+
+  // group numeric statistics by build id, one block each
+  std::map<BuildId,std::vector<std::pair<const Entry *,ValueType>>> blockEntries;
+
+  std::uint32_t u32EntryCount{};
+
+  for(const auto & entry : entries)
+    {
+      ValueType valueType{};
+
+      if(toValueType(entry.type_,valueType))
+        {
+          blockEntries[entry.buildId_].push_back(std::make_pair(&entry,valueType));
+          ++u32EntryCount;
+        }
+    }
+
+  std::uint64_t u64IndexOffset{sizeof(Header)};
+
+  std::uint64_t u64BlockOffset{alignBlock(u64IndexOffset + u32EntryCount * sizeof(IndexEntry))};
+
+  std::uint64_t u64Size{u64BlockOffset};
+
+  for(const auto & entry : blockEntries)
+    {
+      u64Size = alignBlock(u64Size + sizeof(BlockHeader) + entry.second.size() * sizeof(std::uint64_t));
+    }
+
+  // releases anything acquired so far
+  auto fail = [this,&sPath](const char * pzWhat)
+    {
+      int iError{errno};
+
+      close();
+
+      return makeException<StartException>("unable to %s statistic snapshot %s: %s",
+                                           pzWhat,
+                                           sPath.c_str(),
+                                           strerror(iError));
+    };
+
+  // an existing snapshot is replaced by a new file instead of being
+  // truncated, readers still mapping the old file keep a valid mapping
+  if(unlink(sPath.c_str()) < 0 && errno != ENOENT)
+    {
+      throw fail("remove");
+    }
+
+  if((iFd_ = ::open(sPath.c_str(),O_RDWR | O_CREAT | O_EXCL,0644)) < 0)
+    {
+      throw fail("open");
+    }
+
+  if(ftruncate(iFd_,u64Size) < 0)
+    {
+      throw fail("size");
+    }
+
+  void * pBase{mmap(nullptr,u64Size,PROT_READ | PROT_WRITE,MAP_SHARED,iFd_,0)};
+
+  if(pBase == MAP_FAILED)
+    {
+      throw fail("map");
+    }
+
+  pBase_ = static_cast<std::uint8_t *>(pBase);
+
+  size_ = u64Size;
+
+  interval_ = interval;
+
+  auto pIndex = reinterpret_cast<IndexEntry *>(pBase_ + u64IndexOffset);
+
+  std::uint64_t u64Offset{u64BlockOffset};
+
+  for(const auto & entry : blockEntries)
+    {
+      auto pBlock = reinterpret_cast<BlockHeader *>(pBase_ + u64Offset);
+
+      pBlock->u32BuildId = entry.first;
+
+      pBlock->u32Count = entry.second.size();
+
+      Block block{u64Offset,{},std::vector<std::uint64_t>(entry.second.size())};
+
+      std::uint64_t u64ValueOffset{u64Offset + sizeof(BlockHeader)};
+
+      for(const auto & statistic : entry.second)
+        {
+          std::strncpy(pIndex->name,
+                       statistic.first->sName_.c_str(),
+                       sizeof(pIndex->name) - 1);
+
+          pIndex->u64BlockOffset = u64Offset;
+          pIndex->u64ValueOffset = u64ValueOffset;
+          pIndex->u32BuildId = entry.first;
+          pIndex->type = statistic.second;
+
+          block.statistics_.push_back(std::make_pair(statistic.first->pStatistic_,
+                                                     statistic.second));
+
+          u64ValueOffset += sizeof(std::uint64_t);
+
+          ++pIndex;
+        }
+
+      blocks_.push_back(std::move(block));
+
+      u64Offset = alignBlock(u64ValueOffset);
+    }
+
+  update();
+
+  auto pHeader = reinterpret_cast<Header *>(pBase_);
+
+  pHeader->u32Version = FORMAT_VERSION;
+  pHeader->u32EntryCount = u32EntryCount;
+  pHeader->u32BlockCount = blocks_.size();
+  pHeader->u64IndexOffset = u64IndexOffset;
+  pHeader->u64BlockOffset = u64BlockOffset;
+  pHeader->u64IntervalMicroseconds = interval.count();
+  pHeader->u64Size = u64Size;
+
+  // magic is written last, readers may use it to detect a complete index
+  __atomic_store_n(&pHeader->u64Magic,MAGIC,__ATOMIC_RELEASE);
+
+  bRunning_ = true;
+
+  thread_ = std::thread{&StatisticSnapshot::process,this};
+}
+
+void EMANE::StatisticSnapshot::close()
+{
+  if(thread_.joinable())
+    {
+      {
+        std::lock_guard<std::mutex> m(mutex_);
+        bRunning_ = false;
+      }
+
+      cond_.notify_one();
+
+      thread_.join();
+
+      // leave the final values in the file
+      update();
+    }
+
+  if(pBase_)
+    {
+      munmap(pBase_,size_);
+      pBase_ = nullptr;
+    }
+
+  if(iFd_ >= 0)
+    {
+      ::close(iFd_);
+      iFd_ = -1;
+    }
+
+  blocks_.clear();
+}
+
+void EMANE::StatisticSnapshot::process()
+{
+  Utils::ThreadPlacement::Scope placement{Utils::ThreadPlacement::ThreadClass::CONTROL};
+
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  while(!cond_.wait_for(lock,interval_,[this]{return !bRunning_;}))
+    {
+      lock.unlock();
+
+      update();
+
+      lock.lock();
+    }
+}
+
+void EMANE::StatisticSnapshot::update()
+{
+  using namespace StatisticSnapshotFormat;
+
+  for(auto & block : blocks_)
+    {
+      auto pBlock = reinterpret_cast<BlockHeader *>(pBase_ + block.u64Offset_);
+
+      auto pValues = reinterpret_cast<std::uint64_t *>(pBlock + 1);
+
+      // read values before entering the write section to keep it short
+      for(size_t i = 0; i < block.statistics_.size(); ++i)
+        {
+          block.values_[i] = toRaw(block.statistics_[i].first->asAny());
+        }
+
+      auto u64Sequence = pBlock->u64Sequence;
+
+      __atomic_store_n(&pBlock->u64Sequence,u64Sequence + 1,__ATOMIC_RELAXED);
+
+      std::atomic_thread_fence(std::memory_order_release);
+
+      for(size_t i = 0; i < block.statistics_.size(); ++i)
+        {
+          __atomic_store_n(&pValues[i],block.values_[i],__ATOMIC_RELAXED);
+        }
+
+      __atomic_store_n(&pBlock->u64TimestampMicroseconds,
+                       std::chrono::duration_cast<Microseconds>(Clock::now().time_since_epoch()).count(),
+                       __ATOMIC_RELAXED);
+
+      __atomic_store_n(&pBlock->u64Sequence,u64Sequence + 2,__ATOMIC_RELEASE);
+    }
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANESTATISTICSNAPSHOT_HEADER_
+#define EMANESTATISTICSNAPSHOT_HEADER_
+
+#include "emane/types.h"
+#include "emane/any.h"
+#include "emane/statistic.h"
+#include "emane/statisticsnapshotformat.h"
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace EMANE
+{
+  /**
+   * @class StatisticSnapshot
+   *
+   * @brief Periodically copies numeric statistic values into a
+   * memory-mapped file so external tools can read them without
+   * using the control port.
+   *
+   * The name index is written once when the snapshot is opened,
+   * statistics registered afterwards are not included.
+   *
+   * @see statisticsnapshotformat.h for the file layout.
+   */
+  class StatisticSnapshot
+  {
+  public:
+    struct Entry
+    {
+      BuildId buildId_;
+      std::string sName_;
+      Any::Type type_;
+      const Statistic * pStatistic_;
+    };
+
+    StatisticSnapshot();
+
+    ~StatisticSnapshot();
+
+    /**
+     * Creates the snapshot file, writes the name index and starts
+     * the update thread. An existing file is unlinked and replaced,
+     * so readers should reopen the path to follow a new snapshot.
+     *
+     * @param sPath Snapshot file path
+     * @param interval Update interval
+     * @param entries Statistics to publish, non-numeric
+     * statistics are ignored
+     *
+     * @throw StartException when the file cannot be created
+     */
+    void open(const std::string & sPath,
+              const Microseconds & interval,
+              const std::vector<Entry> & entries);
+
+    void close();
+
+  private:
+    struct Block
+    {
+      std::uint64_t u64Offset_;
+      std::vector<std::pair<const Statistic *,StatisticSnapshotFormat::ValueType>> statistics_;
+      std::vector<std::uint64_t> values_;
+    };
+
+    int iFd_;
+    std::uint8_t * pBase_;
+    size_t size_;
+    Microseconds interval_;
+    std::vector<Block> blocks_;
+    std::thread thread_;
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    bool bRunning_;
+
+    void process();
+
+    void update();
+  };
+}
+
+#endif // EMANESTATISTICSNAPSHOT_HEADER_
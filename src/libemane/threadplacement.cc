@@ -0,0 +1,493 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "emane/utils/threadplacement.h"
+#include "emane/configureexception.h"
+#include "statisticregistrarproxy.h"
+#include "logservice.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <cstring>
+#include <dirent.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/mempolicy.h>
+
+namespace
+{
+  pid_t getThreadId()
+  {
+    return syscall(SYS_gettid);
+  }
+
+  std::string toCPUList(const EMANE::Utils::ThreadPlacement::CPUs & cpus)
+  {
+    std::stringstream ss;
+
+    auto iter = cpus.begin();
+
+    while(iter != cpus.end())
+      {
+        int iFirst{*iter};
+        int iLast{iFirst};
+
+        while(++iter != cpus.end() && *iter == iLast + 1)
+          {
+            iLast = *iter;
+          }
+
+        if(ss.tellp())
+          {
+            ss<<",";
+          }
+
+        ss<<iFirst;
+
+        if(iLast != iFirst)
+          {
+            ss<<"-"<<iLast;
+          }
+      }
+
+    return ss.str();
+  }
+
+  EMANE::Utils::ThreadPlacement::CPUs getAffinity(pid_t tid)
+  {
+    EMANE::Utils::ThreadPlacement::CPUs cpus{};
+
+    cpu_set_t cpuSet;
+
+    CPU_ZERO(&cpuSet);
+
+    if(!sched_getaffinity(tid,sizeof(cpuSet),&cpuSet))
+      {
+        for(int i = 0; i < CPU_SETSIZE; ++i)
+          {
+            if(CPU_ISSET(i,&cpuSet))
+              {
+                cpus.insert(i);
+              }
+          }
+      }
+
+    return cpus;
+  }
+
+  bool setAffinity(pid_t tid, const EMANE::Utils::ThreadPlacement::CPUs & cpus)
+  {
+    cpu_set_t cpuSet;
+
+    CPU_ZERO(&cpuSet);
+
+    for(auto iCPU : cpus)
+      {
+        CPU_SET(iCPU,&cpuSet);
+      }
+
+    return !sched_setaffinity(tid,sizeof(cpuSet),&cpuSet);
+  }
+
+  // processor last run on, field 39 of /proc/self/task/<tid>/stat
+  int getLastCPU(pid_t tid)
+  {
+    std::ifstream ifs{"/proc/self/task/" + std::to_string(tid) + "/stat"};
+
+    std::string sStat{};
+
+    std::getline(ifs,sStat);
+
+    // the command field may contain spaces, skip past it
+    auto pos = sStat.rfind(')');
+
+    if(pos == std::string::npos)
+      {
+        return -1;
+      }
+
+    std::stringstream ss{sStat.substr(pos + 2)};
+
+    std::string sField{};
+
+    // fields following the command start at field 3
+    for(int i = 3; i <= 39 && ss>>sField; ++i){}
+
+    return ss ? std::stoi(sField) : -1;
+  }
+}
+
+EMANE::Utils::ThreadPlacement::ThreadPlacement():
+  policy_{{},{},PackMode::NONE,{},true}
+{
+  // NUMA topology, absent on hosts without NUMA support
+  if(DIR * pDir = opendir("/sys/devices/system/node"))
+    {
+      while(dirent * pEntry = readdir(pDir))
+        {
+          int iNode{};
+
+          if(sscanf(pEntry->d_name,"node%d",&iNode) == 1)
+            {
+              std::ifstream ifs{std::string{"/sys/devices/system/node/"} +
+                  pEntry->d_name +
+                  "/cpulist"};
+
+              std::string sCPUs{};
+
+              std::getline(ifs,sCPUs);
+
+              try
+                {
+                  nodes_[iNode] = parseCPUList(sCPUs);
+                }
+              catch(ConfigureException &)
+                {}
+            }
+        }
+
+      closedir(pDir);
+    }
+
+  auto statisticRegistrar = StatisticRegistrarProxy{*StatisticServiceSingleton::instance(),0};
+
+  pThreadPlacementTable_ =
+    statisticRegistrar.registerLazyTable<std::uint32_t,Row>("ThreadPlacementTable",
+                                                            {"TID",
+                                                             "Class",
+                                                             "NEM",
+                                                             "CPUs",
+                                                             "Last CPU",
+                                                             "Node",
+                                                             "Memory Node"},
+                                                            [this](const std::uint32_t & u32ThreadId,
+                                                                   const Row & row)
+                                                            {
+                                                              // actual placement at query time
+                                                              int iLastCPU{getLastCPU(u32ThreadId)};
+
+                                                              return std::vector<Any>{
+                                                                Any{u32ThreadId},
+                                                                Any{toString(row.threadClass_)},
+                                                                Any{row.nemId_},
+                                                                Any{toCPUList(getAffinity(u32ThreadId))},
+                                                                Any{std::int32_t{iLastCPU}},
+                                                                Any{std::int32_t{getNode(CPUs{iLastCPU})}},
+                                                                Any{std::int32_t{row.iMemoryNode_}}};
+                                                            },
+                                                            StatisticProperties::NONE,
+                                                            "Emulator thread placement. CPUs is the current"
+                                                            " affinity, Node is the NUMA node of the last CPU"
+                                                            " and Memory Node is the preferred memory node or"
+                                                            " -1 for the default policy.");
+}
+
+void EMANE::Utils::ThreadPlacement::setPolicy(const Policy & policy)
+{
+  std::lock_guard<std::mutex> m(mutex_);
+
+  policy_ = policy;
+
+  for(const auto & entry : threads_)
+    {
+      auto cpus = resolve(entry.second.threadClass_,entry.second.nemId_);
+
+      if(!cpus.empty() && !setAffinity(entry.first,cpus))
+        {
+          LOGGER_STANDARD_LOGGING(*LogServiceSingleton::instance(),
+                                  ERROR_LEVEL,
+                                  "ThreadPlacement::%s unable to set thread %d affinity to %s: %s",
+                                  __func__,
+                                  entry.first,
+                                  toCPUList(cpus).c_str(),
+                                  strerror(errno));
+        }
+    }
+}
+
+void EMANE::Utils::ThreadPlacement::assign(const std::vector<NEMId> & nems)
+{
+  std::lock_guard<std::mutex> m(mutex_);
+
+  packCPUs_.clear();
+
+  CPUs available{policy_.packCPUs_.empty() ? getAffinity(0) : policy_.packCPUs_};
+
+  if(available.empty())
+    {
+      return;
+    }
+
+  std::vector<CPUs> slots{};
+
+  switch(policy_.packMode_)
+    {
+    case PackMode::CORE:
+      for(auto iCPU : available)
+        {
+          slots.push_back({iCPU});
+        }
+      break;
+
+    case PackMode::NODE:
+      for(const auto & node : nodes_)
+        {
+          CPUs cpus{};
+
+          std::set_intersection(node.second.begin(),
+                                node.second.end(),
+                                available.begin(),
+                                available.end(),
+                                std::inserter(cpus,cpus.begin()));
+
+          if(!cpus.empty())
+            {
+              slots.push_back(cpus);
+            }
+        }
+
+      // no NUMA topology available, treat as a single node
+      if(slots.empty())
+        {
+          slots.push_back(available);
+        }
+      break;
+
+    default:
+      return;
+    }
+
+  // NEMs are spread evenly over the slots in order, so that
+  // consecutive NEMs share a slot
+  for(std::size_t i = 0; i < nems.size(); ++i)
+    {
+      packCPUs_[nems[i]] = slots[i * slots.size() / nems.size()];
+    }
+}
+
+EMANE::Utils::ThreadPlacement::CPUs
+EMANE::Utils::ThreadPlacement::parseCPUList(const std::string & sCPUs)
+{
+  CPUs cpus{};
+
+  std::stringstream ss{sCPUs};
+
+  std::string sRange{};
+
+  while(std::getline(ss,sRange,','))
+    {
+      int iFirst{};
+      int iLast{};
+      char cExtra{};
+
+      int iCount{sscanf(sRange.c_str()," %d - %d %c",&iFirst,&iLast,&cExtra)};
+
+      if(iCount == 1)
+        {
+          iLast = iFirst;
+        }
+      else if(iCount != 2)
+        {
+          throw makeException<ConfigureException>("ThreadPlacement: invalid CPU list: %s",
+                                                  sCPUs.c_str());
+        }
+
+      if(iFirst < 0 || iLast < iFirst || iLast >= CPU_SETSIZE)
+        {
+          throw makeException<ConfigureException>("ThreadPlacement: invalid CPU range %s in CPU list: %s",
+                                                  sRange.c_str(),
+                                                  sCPUs.c_str());
+        }
+
+      for(int i = iFirst; i <= iLast; ++i)
+        {
+          cpus.insert(i);
+        }
+    }
+
+  if(cpus.empty())
+    {
+      throw makeException<ConfigureException>("ThreadPlacement: empty CPU list");
+    }
+
+  return cpus;
+}
+
+std::string EMANE::Utils::ThreadPlacement::toString(ThreadClass threadClass)
+{
+  switch(threadClass)
+    {
+    case ThreadClass::OTA:
+      return "ota";
+    case ThreadClass::EVENT:
+      return "event";
+    case ThreadClass::TIMER:
+      return "timer";
+    case ThreadClass::CONTROL:
+      return "control";
+    case ThreadClass::NEM:
+      return "nem";
+    case ThreadClass::PROCESSINGPOOL:
+      return "processingpool";
+    case ThreadClass::TRANSPORT:
+      return "transport";
+    case ThreadClass::STARTUP:
+      return "startup";
+    }
+
+  return "unknown";
+}
+
+void EMANE::Utils::ThreadPlacement::enter(ThreadClass threadClass, NEMId id)
+{
+  pid_t tid{getThreadId()};
+
+  Row row{threadClass,id,-1};
+
+  std::lock_guard<std::mutex> m(mutex_);
+
+  auto cpus = resolve(threadClass,id);
+
+  if(!cpus.empty())
+    {
+      if(!setAffinity(tid,cpus))
+        {
+          LOGGER_STANDARD_LOGGING(*LogServiceSingleton::instance(),
+                                  ERROR_LEVEL,
+                                  "ThreadPlacement::%s unable to set %s thread %d affinity to %s: %s",
+                                  __func__,
+                                  toString(threadClass).c_str(),
+                                  tid,
+                                  toCPUList(cpus).c_str(),
+                                  strerror(errno));
+        }
+      else if(policy_.bNUMALocal_)
+        {
+          int iNode{getNode(cpus)};
+
+          if(iNode >= 0)
+            {
+              unsigned long ulNodeMask{1UL << iNode};
+
+              if(iNode < static_cast<int>(sizeof(ulNodeMask) * 8) &&
+                 !syscall(SYS_set_mempolicy,
+                          MPOL_PREFERRED,
+                          &ulNodeMask,
+                          sizeof(ulNodeMask) * 8))
+                {
+                  row.iMemoryNode_ = iNode;
+                }
+            }
+        }
+    }
+
+  threads_.insert_or_assign(tid,row);
+
+  pThreadPlacementTable_->setRow(tid,row);
+}
+
+void EMANE::Utils::ThreadPlacement::leave()
+{
+  pid_t tid{getThreadId()};
+
+  std::lock_guard<std::mutex> m(mutex_);
+
+  threads_.erase(tid);
+
+  pThreadPlacementTable_->deleteRow(tid);
+}
+
+EMANE::Utils::ThreadPlacement::CPUs
+EMANE::Utils::ThreadPlacement::resolve(ThreadClass threadClass, NEMId id) const
+{
+  // startup workers configure every NEM and only run until the
+  // emulator is built
+  if(threadClass == ThreadClass::STARTUP)
+    {
+      return {};
+    }
+
+  auto classIter = policy_.classCPUs_.find(threadClass);
+
+  if(classIter != policy_.classCPUs_.end())
+    {
+      return classIter->second;
+    }
+
+  if(id)
+    {
+      auto nemIter = policy_.nemCPUs_.find(id);
+
+      if(nemIter != policy_.nemCPUs_.end())
+        {
+          return nemIter->second;
+        }
+
+      auto packIter = packCPUs_.find(id);
+
+      if(packIter != packCPUs_.end())
+        {
+          return packIter->second;
+        }
+    }
+
+  return {};
+}
+
+int EMANE::Utils::ThreadPlacement::getNode(const CPUs & cpus) const
+{
+  for(const auto & node : nodes_)
+    {
+      if(std::includes(node.second.begin(),
+                       node.second.end(),
+                       cpus.begin(),
+                       cpus.end()))
+        {
+          return node.first;
+        }
+    }
+
+  return -1;
+}
+
+EMANE::Utils::ThreadPlacement::Scope::Scope(ThreadClass threadClass, NEMId id)
+{
+  ThreadPlacement::instance()->enter(threadClass,id);
+}
+
+EMANE::Utils::ThreadPlacement::Scope::~Scope()
+{
+  ThreadPlacement::instance()->leave();
+}
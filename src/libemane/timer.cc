@@ -31,6 +31,7 @@
  */
 
 #include "emane/utils/timer.h"
+#include "emane/utils/threadplacement.h"
 
 #include <sys/timerfd.h>
 #include <vector>
@@ -184,6 +185,8 @@ void EMANE::Utils::Timer::schedule_i()
   
 void EMANE::Utils::Timer::scheduler()
 {
+  Utils::ThreadPlacement::Scope placement{Utils::ThreadPlacement::ThreadClass::TIMER};
+
   std::vector<TimerInfo> expired;
 
   std::uint64_t u64Expired{};
@@ -115,6 +115,13 @@ void EMANE::TransportLayer::doProcessEvent(const EventId & eventId,
   pImplementor_->processEvent(eventId,serialization);
 }
 
+void EMANE::TransportLayer::doProcessDecodedEvent(const EventId & eventId,
+                                                  const std::shared_ptr<const Event> & pEvent,
+                                                  const Serialization & serialization)
+{
+  pImplementor_->processDecodedEvent(eventId,pEvent,serialization);
+}
+
 
 void EMANE::TransportLayer::doProcessTimedEvent(TimerEventId eventId,
                                                 const TimePoint & expireTime,
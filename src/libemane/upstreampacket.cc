@@ -33,6 +33,7 @@
  */
 
 #include "emane/upstreampacket.h"
+#include "emane/commonphyheader.h"
 #include "emane/net.h"
 
 #include <memory>
@@ -127,11 +128,43 @@ public:
   }
 
 
+  Microseconds stampTrace(const TimePoint & now)
+  {
+    TimePoint previous{traceTime_ == TimePoint{} ?
+        pShared_->info_.getCreationTime() : traceTime_};
+
+    traceTime_ = now;
+
+    return std::chrono::duration_cast<Microseconds>(now - previous);
+  }
+
   const PacketInfo &  getPacketInfo() const
   {
     return pShared_->info_;
   }
 
+  void attachCommonPHYHeader(std::shared_ptr<const CommonPHYHeader> pCommonPHYHeader,
+                             size_t size)
+  {
+    pShared_->pCommonPHYHeader_ = std::move(pCommonPHYHeader);
+    pShared_->commonPHYHeaderBegin_ = head_;
+    pShared_->commonPHYHeaderEnd_ = head_ + size;
+  }
+
+  std::shared_ptr<const CommonPHYHeader> stripCommonPHYHeader()
+  {
+    if(pShared_->pCommonPHYHeader_ &&
+       pShared_->commonPHYHeaderBegin_ == head_ &&
+       pShared_->commonPHYHeaderEnd_ <= pShared_->packetSegment_.size())
+      {
+        head_ = pShared_->commonPHYHeaderEnd_;
+
+        return pShared_->pCommonPHYHeader_;
+      }
+
+    return {};
+  }
+
 private:
   typedef std::vector<unsigned char> PacketSegment;
 
@@ -140,9 +173,13 @@ private:
   public:
     PacketSegment packetSegment_;
     PacketInfo info_{0,0,0,{}};
+    std::shared_ptr<const CommonPHYHeader> pCommonPHYHeader_{};
+    PacketSegment::size_type commonPHYHeaderBegin_{};
+    PacketSegment::size_type commonPHYHeaderEnd_{};
   };
 
   PacketSegment::size_type head_;
+  TimePoint traceTime_{};
   std::shared_ptr<Shared> pShared_;
 };
 
@@ -209,3 +246,19 @@ const EMANE::PacketInfo &  EMANE::UpstreamPacket::getPacketInfo() const
 {
   return pImpl_->getPacketInfo();
 }
+
+void EMANE::UpstreamPacket::attachCommonPHYHeader(std::shared_ptr<const CommonPHYHeader> pCommonPHYHeader,
+                                                  size_t size)
+{
+  pImpl_->attachCommonPHYHeader(std::move(pCommonPHYHeader),size);
+}
+
+std::shared_ptr<const EMANE::CommonPHYHeader> EMANE::UpstreamPacket::stripCommonPHYHeader()
+{
+  return pImpl_->stripCommonPHYHeader();
+}
+
+EMANE::Microseconds EMANE::UpstreamPacket::stampTrace(const TimePoint & now)
+{
+  return pImpl_->stampTrace(now);
+}
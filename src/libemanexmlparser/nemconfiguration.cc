@@ -37,14 +37,18 @@
 #include "emane/exception.h"
 
 #include <libxml/tree.h>
+#include <chrono>
 
 
 EMANE::NEMConfiguration::NEMConfiguration(xmlNodePtr pNEMNode,
                                           std::string sURI) :
   LayerConfiguration{"nem"},
   u16Id_{0},
-  type_{STRUCTURED}
+  type_{STRUCTURED},
+  parseDuration_{}
 {
+  auto start = std::chrono::steady_clock::now();
+
   processDefinition("nem", sURI);
 
   u16Id_ = getAttrValNumeric(pNEMNode, "id");
@@ -53,6 +57,9 @@ EMANE::NEMConfiguration::NEMConfiguration(xmlNodePtr pNEMNode,
 
   // overlay these param values on previously parsed
   overlayParams(pNEMNode);
+
+  parseDuration_ =
+    std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - start);
 }
 
 
@@ -85,6 +92,13 @@ EMANE::NEMConfiguration::isExternalTransport()
 }
 
 
+EMANE::Microseconds
+EMANE::NEMConfiguration::getParseDuration()
+{
+  return parseDuration_;
+}
+
+
 bool
 EMANE::NEMConfiguration::isValid()
 {
@@ -36,6 +36,7 @@
 
 #include "layerconfiguration.h"
 #include "emaneparseexception.h"
+#include "emane/types.h"
 
 #include <string>
 #include <list>
@@ -108,6 +109,14 @@ namespace EMANE
      */
     bool isExternalTransport();
 
+    /**
+     * Returns the time spent parsing and validating this NEM's
+     * definition and layer files
+     *
+     * @return Parse duration
+     */
+    Microseconds getParseDuration();
+
   protected:
     /**
      * Does processing of the root node as if it was an 'nem'
@@ -148,6 +157,11 @@ namespace EMANE
      */
     bool bExternalTransport_;
 
+    /**
+     * Parse duration
+     */
+    Microseconds parseDuration_;
+
     /**
      * Process a layer element
      */
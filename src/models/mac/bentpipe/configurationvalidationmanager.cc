@@ -98,9 +98,9 @@ EMANE::Models::BentPipe::ConfigurationValidationManager::validate(const Configur
 
               pcrManager.load(item.second[0].asString());
 
-              for(const auto & entry: pcrManager.getCurveTable())
+              for(const auto & index : pcrManager.getCurveIndexes())
                 {
-                  pcrCurveIndexSet_.emplace(entry.first);
+                  pcrCurveIndexSet_.emplace(index);
                 }
             }
         }
@@ -98,6 +98,8 @@ void EMANE::Models::BentPipe::NeighborStatusPublisher::update(NEMId remote,
                                                               double dNoiseFloordB,
                                                               const TimePoint & timestamp)
 {
+  std::lock_guard<std::mutex> m{mutex_};
+
   auto key = std::make_pair(remote,transponderIndex);
 
   std::uint64_t u64TimestampMicroseconds =
@@ -38,6 +38,7 @@
 #include "emane/utils/weightedmovingaverage.h"
 
 #include <map>
+#include <mutex>
 
 namespace EMANE
 {
@@ -74,6 +75,8 @@ namespace EMANE
         using NeighborStatusKey = std::pair<NEMId,TransponderIndex>;
         StatisticTable<NeighborStatusKey> * pNeighborStatusTable_;
         std::map<NeighborStatusKey,NeighborInfo> known_;
+        // receive managers may update from their own receive strands
+        std::mutex mutex_;
       };
     }
   }
@@ -92,51 +92,54 @@ EMANE::Models::BentPipe::PacketStatusPublisher::~PacketStatusPublisher(){}
 
 void EMANE::Models::BentPipe::PacketStatusPublisher::registerStatistics(StatisticRegistrar & statisticRegistrar)
 {
+  auto acceptMaterializer = [](const NEMId & src, const PacketAcceptRow & row)
+    {
+      return std::vector<Any>{Any{src},
+                              Any{row.u64BytesTx},
+                              Any{row.u64BytesRx}};
+    };
+
+  auto dropMaterializer = [](const NEMId & src, const PacketDropRow & row)
+    {
+      std::vector<Any> anys{Any{src}};
+
+      for(const auto & bytes : row)
+        {
+          anys.push_back(Any{bytes});
+        }
+
+      return anys;
+    };
+
   for(int queueIndex = 0; queueIndex < QUEUE_COUNT; ++queueIndex)
     {
       broadcastAcceptTables_[queueIndex] =
-        statisticRegistrar.registerTable<NEMId>("BroadcastByteAcceptTable" + std::to_string(queueIndex),
-                                                PacketAcceptLabels,
-                                                [this,queueIndex](StatisticTablePublisher * pTable)
-                                                {
-                                                  std::lock_guard<std::mutex> m(mutexBroadcastPacketAcceptTable_);
-                                                  broadcastAcceptInfos_[queueIndex].clear();
-                                                  pTable->clear();
-                                                },
-                                                "Broadcast bytes accepted");
+        statisticRegistrar.registerLazyTable<NEMId,PacketAcceptRow>("BroadcastByteAcceptTable" + std::to_string(queueIndex),
+                                                                    PacketAcceptLabels,
+                                                                    acceptMaterializer,
+                                                                    StatisticProperties::CLEARABLE,
+                                                                    "Broadcast bytes accepted");
 
       unicastAcceptTables_[queueIndex] =
-        statisticRegistrar.registerTable<NEMId>("UnicastByteAcceptTable" + std::to_string(queueIndex),
-                                                PacketAcceptLabels,
-                                                [this,queueIndex](StatisticTablePublisher * pTable)
-                                                {
-                                                  std::lock_guard<std::mutex> m(mutexUnicastPacketAcceptTable_);
-                                                  unicastAcceptInfos_[queueIndex].clear();
-                                                  pTable->clear();
-                                                },
-                                                "Unicast bytes accepted");
+        statisticRegistrar.registerLazyTable<NEMId,PacketAcceptRow>("UnicastByteAcceptTable" + std::to_string(queueIndex),
+                                                                    PacketAcceptLabels,
+                                                                    acceptMaterializer,
+                                                                    StatisticProperties::CLEARABLE,
+                                                                    "Unicast bytes accepted");
 
       broadcastDropTables_[queueIndex] =
-        statisticRegistrar.registerTable<NEMId>("BroadcastByteDropTable" + std::to_string(queueIndex),
-                                                PacketDropLabels,
-                                                [this,queueIndex](StatisticTablePublisher * pTable)
-                                                {
-                                                  std::lock_guard<std::mutex> m(mutexBroadcastPacketDropTable_);
-                                                  broadcastDropInfos_[queueIndex].clear();
-                                                  pTable->clear();
-                                                },
-                                                "Broadcast bytes dropped");
+        statisticRegistrar.registerLazyTable<NEMId,PacketDropRow>("BroadcastByteDropTable" + std::to_string(queueIndex),
+                                                                  PacketDropLabels,
+                                                                  dropMaterializer,
+                                                                  StatisticProperties::CLEARABLE,
+                                                                  "Broadcast bytes dropped");
 
       unicastDropTables_[queueIndex] =
-        statisticRegistrar.registerTable<NEMId>("UnicastByteDropTable" + std::to_string(queueIndex),
-                                                PacketDropLabels,
-                                                [this,queueIndex](StatisticTablePublisher * pTable)
-                                                {
-                                                  std::lock_guard<std::mutex> m(mutexUnicastPacketDropTable_);
-                                                  unicastDropInfos_[queueIndex].clear();
-                                                  pTable->clear();
-                                                },
-                                                "Unicast bytes dropped");
+        statisticRegistrar.registerLazyTable<NEMId,PacketDropRow>("UnicastByteDropTable" + std::to_string(queueIndex),
+                                                                  PacketDropLabels,
+                                                                  dropMaterializer,
+                                                                  StatisticProperties::CLEARABLE,
+                                                                  "Unicast bytes dropped");
     }
 }
 
@@ -170,218 +173,80 @@ void EMANE::Models::BentPipe::PacketStatusPublisher::inbound(NEMId src,
                                                              size_t size,
                                                              InboundAction action)
 {
-  TableArray * pAcceptTables{};
-  TableArray * pDropTables{};
-
-  AcceptInfoArrary * pAcceptInfos{};
-  DropInfoArrary  * pDropInfos{};
-
-  std::mutex * pMutexAcceptTable = {};
-  std::mutex * pMutexDropTable = {};
+  bool bBroadcast{dst == NEM_BROADCAST_MAC_ADDRESS};
 
-  if(dst == NEM_BROADCAST_MAC_ADDRESS)
-    {
-      pAcceptTables = &broadcastAcceptTables_;
-      pDropTables = &broadcastDropTables_;
-
-      pAcceptInfos = &broadcastAcceptInfos_;
-      pDropInfos = &broadcastDropInfos_;
-
-      pMutexAcceptTable = &mutexBroadcastPacketAcceptTable_;
-      pMutexDropTable = &mutexBroadcastPacketDropTable_;
-    }
-  else
-    {
-      pAcceptTables = &unicastAcceptTables_;
-      pDropTables = &unicastDropTables_;
-
-      pAcceptInfos = &unicastAcceptInfos_;
-      pDropInfos = &unicastDropInfos_;
-
-      pMutexAcceptTable = &mutexUnicastPacketAcceptTable_;
-      pMutexDropTable = &mutexUnicastPacketDropTable_;
-    }
+  std::uint8_t u8QueueIndex{0};
 
   if(action == InboundAction::ACCEPT_GOOD)
     {
-      std::lock_guard<std::mutex> m(*pMutexAcceptTable);
-
-      std::uint8_t u8QueueIndex{0};
+      auto & tables = bBroadcast ? broadcastAcceptTables_ : unicastAcceptTables_;
 
-      auto iter = (*pAcceptInfos)[u8QueueIndex].find(src);
-
-      if(iter == (*pAcceptInfos)[u8QueueIndex].end())
-        {
-          iter = (*pAcceptInfos)[u8QueueIndex].insert({src,{}}).first;
-
-
-          (*pAcceptTables)[u8QueueIndex]->addRow(src,
-                                                 {Any{src},
-                                                  Any{0L},
-                                                  Any{0L}});
-        }
-
-      auto & bytes = std::get<ACCEPT_COLUMN_NUM_BYTES_RX-1>(iter->second);
-
-      bytes += size;
-
-      (*pAcceptTables)[u8QueueIndex]->setCell(src,
-                                              ACCEPT_COLUMN_NUM_BYTES_RX,
-                                              Any{bytes});
+      tables[u8QueueIndex]->updateRow(src,
+                                      [size](PacketAcceptRow & row)
+                                      {
+                                        row.u64BytesRx += size;
+                                      });
     }
   else
     {
-      std::lock_guard<std::mutex> m(*pMutexDropTable);
-
-      std::uint8_t u8QueueIndex{0};
-
-      auto iter = (*pDropInfos)[u8QueueIndex].find(src);
-
-      if(iter == (*pDropInfos)[u8QueueIndex].end())
-        {
-          iter = (*pDropInfos)[u8QueueIndex].insert({src,{}}).first;
-
-          (*pDropTables)[u8QueueIndex]->addRow(src,
-                                               {Any{src},
-                                                Any{0L},
-                                                Any{0L},
-                                                Any{0L},
-                                                Any{0L},
-                                                Any{0L},
-                                                Any{0L},
-                                                Any{0L},
-                                                Any{0L},
-                                                Any{0L},
-                                                Any{0L},
-                                                Any{0L},
-                                                Any{0L},
-                                                Any{0L}});
-        }
+      int iColumn{};
 
       switch(action)
         {
         case InboundAction::DROP_BAD_CONTROL:
-          {
-            auto & bytes = std::get<DROP_COLUMN_BAD_CONTROL-1>(iter->second);
-
-            bytes += size;
-
-            (*pDropTables)[u8QueueIndex]->setCell(src,
-                                                  DROP_COLUMN_BAD_CONTROL,
-                                                  Any{bytes});
-          }
+          iColumn = DROP_COLUMN_BAD_CONTROL;
           break;
 
         case InboundAction::DROP_MISS_FRAGMENT:
-          {
-            auto & bytes = std::get<DROP_COLUMN_MISS_FRAGMENT-1>(iter->second);
-
-            bytes += size;
-
-            (*pDropTables)[u8QueueIndex]->setCell(src,
-                                                  DROP_COLUMN_MISS_FRAGMENT,
-                                                  Any{bytes});
-          }
+          iColumn = DROP_COLUMN_MISS_FRAGMENT;
           break;
 
         case InboundAction::DROP_BAD_CURVE:
-          {
-            auto & bytes = std::get<DROP_COLUMN_BAD_CURVE-1>(iter->second);
-
-            bytes += size;
-
-            (*pDropTables)[u8QueueIndex]->setCell(src,
-                                                  DROP_COLUMN_BAD_CURVE,
-                                                  Any{bytes});
-          }
+          iColumn = DROP_COLUMN_BAD_CURVE;
           break;
 
         case InboundAction::DROP_LOCK:
-          {
-            auto & bytes = std::get<DROP_COLUMN_LOCK-1>(iter->second);
-
-            bytes += size;
-
-            (*pDropTables)[u8QueueIndex]->setCell(src,
-                                                  DROP_COLUMN_LOCK,
-                                                  Any{bytes});
-          }
+          iColumn = DROP_COLUMN_LOCK;
           break;
 
         case InboundAction::DROP_RX_OFF:
-          {
-            auto & bytes = std::get<DROP_COLUMN_RX_OFF-1>(iter->second);
-
-            bytes += size;
-
-            (*pDropTables)[u8QueueIndex]->setCell(src,
-                                                  DROP_COLUMN_RX_OFF,
-                                                  Any{bytes});
-          }
+          iColumn = DROP_COLUMN_RX_OFF;
           break;
 
         case InboundAction::DROP_SPECTRUM_SERVICE:
-          {
-            auto & bytes = std::get<DROP_COLUMN_BAD_SPECTRUM_QUERY-1>(iter->second);
-
-            bytes += size;
-
-            (*pDropTables)[u8QueueIndex]->setCell(src,
-                                                  DROP_COLUMN_BAD_SPECTRUM_QUERY,
-                                                  Any{bytes});
-          }
+          iColumn = DROP_COLUMN_BAD_SPECTRUM_QUERY;
           break;
 
         case InboundAction::DROP_SINR:
-          {
-            auto & bytes = std::get<DROP_COLUMN_SINR-1>(iter->second);
-
-            bytes += size;
-
-            (*pDropTables)[u8QueueIndex]->setCell(src,
-                                                  DROP_COLUMN_SINR,
-                                                  Any{bytes});
-          }
+          iColumn = DROP_COLUMN_SINR;
           break;
 
         case InboundAction::DROP_REGISTRATION_ID:
-          {
-            auto & bytes = std::get<DROP_COLUMN_REG_ID-1>(iter->second);
-
-            bytes += size;
-
-            (*pDropTables)[u8QueueIndex]->setCell(src,
-                                                  DROP_COLUMN_REG_ID,
-                                                  Any{bytes});
-          }
+          iColumn = DROP_COLUMN_REG_ID;
           break;
 
         case InboundAction::DROP_DESTINATION_MAC:
-          {
-            auto & bytes = std::get<DROP_COLUMN_DST_MAC-1>(iter->second);
-
-            bytes += size;
-
-            (*pDropTables)[u8QueueIndex]->setCell(src,
-                                                  DROP_COLUMN_DST_MAC,
-                                                  Any{bytes});
-          }
+          iColumn = DROP_COLUMN_DST_MAC;
           break;
-        case InboundAction::DROP_TOO_LONG:
-          {
-            auto & bytes = std::get<DROP_COLUMN_TOO_LONG-1>(iter->second);
 
-            bytes += size;
-
-            (*pDropTables)[u8QueueIndex]->setCell(src,
-                                                  DROP_COLUMN_TOO_LONG,
-                                                  Any{bytes});
-          }
+        case InboundAction::DROP_TOO_LONG:
+          iColumn = DROP_COLUMN_TOO_LONG;
           break;
 
         default:
           break;
         }
+
+      auto & tables = bBroadcast ? broadcastDropTables_ : unicastDropTables_;
+
+      tables[u8QueueIndex]->updateRow(src,
+                                      [size,iColumn](PacketDropRow & row)
+                                      {
+                                        if(iColumn)
+                                          {
+                                            row[iColumn-1] += size;
+                                          }
+                                      });
     }
 }
 
@@ -391,134 +256,52 @@ void EMANE::Models::BentPipe::PacketStatusPublisher::outbound(NEMId src,
                                                               size_t size,
                                                               OutboundAction action)
 {
-  TableArray * pAcceptTables{};
-  TableArray * pDropTables{};
-
-  AcceptInfoArrary * pAcceptInfos{};
-  DropInfoArrary  * pDropInfos{};
-
-  std::mutex * pMutexAcceptTable = {};
-  std::mutex * pMutexDropTable = {};
-
-  if(dst == NEM_BROADCAST_MAC_ADDRESS)
-    {
-      pAcceptTables = &broadcastAcceptTables_;
-      pDropTables = &broadcastDropTables_;
-
-      pAcceptInfos = &broadcastAcceptInfos_;
-      pDropInfos = &broadcastDropInfos_;
-
-      pMutexAcceptTable = &mutexBroadcastPacketAcceptTable_;
-      pMutexDropTable = &mutexBroadcastPacketDropTable_;
-    }
-  else
-    {
-      pAcceptTables = &unicastAcceptTables_;
-      pDropTables = &unicastDropTables_;
-
-      pAcceptInfos = &unicastAcceptInfos_;
-      pDropInfos = &unicastDropInfos_;
+  bool bBroadcast{dst == NEM_BROADCAST_MAC_ADDRESS};
 
-      pMutexAcceptTable = &mutexUnicastPacketAcceptTable_;
-      pMutexDropTable = &mutexUnicastPacketDropTable_;
-    }
-
-  // detetmine the relevant queue based on priority
   std::uint8_t u8QueueIndex{0};
 
   if(action == OutboundAction::ACCEPT_GOOD)
     {
-      std::lock_guard<std::mutex> m(*pMutexAcceptTable);
-
-      auto iter = (*pAcceptInfos)[u8QueueIndex].find(src);
-
-      if(iter == (*pAcceptInfos)[u8QueueIndex].end())
-        {
-          iter = (*pAcceptInfos)[u8QueueIndex].insert({src,{}}).first;
-
+      auto & tables = bBroadcast ? broadcastAcceptTables_ : unicastAcceptTables_;
 
-          (*pAcceptTables)[u8QueueIndex]->addRow(src,
-                                                 {Any{src},
-                                                  Any{0L},
-                                                  Any{0L}});
-        }
-
-      auto & bytes = std::get<ACCEPT_COLUMN_NUM_BYTES_TX-1>(iter->second);
-
-      bytes += size;
-
-      (*pAcceptTables)[u8QueueIndex]->setCell(src,
-                                              ACCEPT_COLUMN_NUM_BYTES_TX,
-                                              Any{bytes});
+      tables[u8QueueIndex]->updateRow(src,
+                                      [size](PacketAcceptRow & row)
+                                      {
+                                        row.u64BytesTx += size;
+                                      });
     }
   else
     {
-      std::lock_guard<std::mutex> m(*pMutexDropTable);
-
-      auto iter = (*pDropInfos)[u8QueueIndex].find(src);
-
-      if(iter == (*pDropInfos)[u8QueueIndex].end())
-        {
-          iter = (*pDropInfos)[u8QueueIndex].insert({src,{}}).first;
-
-          (*pDropTables)[u8QueueIndex]->addRow(src,
-                                               {Any{src},
-                                                Any{0L},
-                                                Any{0L},
-                                                Any{0L},
-                                                Any{0L},
-                                                Any{0L},
-                                                Any{0L},
-                                                Any{0L},
-                                                Any{0L},
-                                                Any{0L},
-                                                Any{0L},
-                                                Any{0L},
-                                                Any{0L},
-                                                Any{0L},
-                                                Any{0L}});
-        }
+      int iColumn{};
 
       switch(action)
         {
         case OutboundAction::DROP_TOO_BIG:
-          {
-            auto & bytes = std::get<DROP_COLUMN_TOO_BIG-1>(iter->second);
-
-            bytes += size;
-
-            (*pDropTables)[u8QueueIndex]->setCell(src,
-                                                  DROP_COLUMN_TOO_BIG,
-                                                  Any{bytes});
-          }
+          iColumn = DROP_COLUMN_TOO_BIG;
           break;
-        case OutboundAction::DROP_OVERFLOW:
-          {
-            auto & bytes = std::get<DROP_COLUMN_QUEUE_OVERFLOW-1>(iter->second);
-
-            bytes += size;
 
-            (*pDropTables)[u8QueueIndex]->setCell(src,
-                                                  DROP_COLUMN_QUEUE_OVERFLOW,
-                                                  Any{bytes});
-          }
+        case OutboundAction::DROP_OVERFLOW:
+          iColumn = DROP_COLUMN_QUEUE_OVERFLOW;
           break;
 
         case OutboundAction::DROP_TX_OFF:
-          {
-            auto & bytes = std::get<DROP_COLUMN_TX_OFF-1>(iter->second);
-
-            bytes += size;
-
-            (*pDropTables)[u8QueueIndex]->setCell(src,
-                                                  DROP_COLUMN_TX_OFF,
-                                                  Any{bytes});
-          }
+          iColumn = DROP_COLUMN_TX_OFF;
           break;
 
         default:
           break;
         }
+
+      auto & tables = bBroadcast ? broadcastDropTables_ : unicastDropTables_;
+
+      tables[u8QueueIndex]->updateRow(src,
+                                      [size,iColumn](PacketDropRow & row)
+                                      {
+                                        if(iColumn)
+                                          {
+                                            row[iColumn-1] += size;
+                                          }
+                                      });
     }
 }
 
@@ -39,8 +39,6 @@
 #include "emane/statisticregistrar.h"
 
 #include <array>
-#include <mutex>
-#include <map>
 
 namespace EMANE
 {
@@ -110,45 +108,26 @@ namespace EMANE
       private:
         enum {QUEUE_COUNT = 1};
 
-        using PacketAcceptInfo = std::map<NEMId,std::tuple<std::uint64_t, // bytes Tx
-                                                           std::uint64_t>>; // bytes Rx
-
-        using PacketDropInfo = std::map<NEMId,std::tuple<std::uint64_t, // SINR
-                                                         std::uint64_t, // Reg Id
-                                                         std::uint64_t, // Dst MAC
-                                                         std::uint64_t, // Queue Overflow
-                                                         std::uint64_t, // Bad Control
-                                                         std::uint64_t, // Bad Spectrum Query
-                                                         std::uint64_t, // Flow Control
-                                                         std::uint64_t, // Too Big
-                                                         std::uint64_t, // Too Long
-                                                         std::uint64_t, // Frequency
-                                                         std::uint64_t, // Slot Error
-                                                         std::uint64_t,// Miss Fragment
-                                                         std::uint64_t, // Bad Curve
-                                                         std::uint64_t>>;  // Lock
-
-        using TableArray = std::array<StatisticTable<NEMId> *,QUEUE_COUNT>;
-
-        TableArray broadcastAcceptTables_;
-        TableArray broadcastDropTables_;
-
-        TableArray unicastAcceptTables_;
-        TableArray unicastDropTables_;
-
-        using AcceptInfoArrary = std::array<PacketAcceptInfo,QUEUE_COUNT>;
-        using DropInfoArrary = std::array<PacketDropInfo,QUEUE_COUNT>;
-
-        AcceptInfoArrary broadcastAcceptInfos_;
-        DropInfoArrary  broadcastDropInfos_;
-
-        AcceptInfoArrary unicastAcceptInfos_;
-        DropInfoArrary  unicastDropInfos_;
-
-        std::mutex mutexBroadcastPacketAcceptTable_;
-        std::mutex mutexUnicastPacketAcceptTable_;
-        std::mutex mutexBroadcastPacketDropTable_;
-        std::mutex mutexUnicastPacketDropTable_;
+        struct PacketAcceptRow
+        {
+          std::uint64_t u64BytesTx;
+          std::uint64_t u64BytesRx;
+        };
+
+        // bytes dropped indexed by drop column - 1
+        using PacketDropRow = std::array<std::uint64_t,13>;
+
+        using AcceptTableArray =
+          std::array<StatisticLazyTable<NEMId,PacketAcceptRow> *,QUEUE_COUNT>;
+
+        using DropTableArray =
+          std::array<StatisticLazyTable<NEMId,PacketDropRow> *,QUEUE_COUNT>;
+
+        AcceptTableArray broadcastAcceptTables_;
+        DropTableArray broadcastDropTables_;
+
+        AcceptTableArray unicastAcceptTables_;
+        DropTableArray unicastDropTables_;
       };
     }
   }
@@ -34,9 +34,8 @@
 #include "emane/configurationexception.h"
 #include "emane/utils/parameterconvert.h"
 
-#include <cmath>
 #include <cstdlib>
-#include <limits>
+#include <map>
 
 #include <libxml/parser.h>
 #include <libxml/xmlschemas.h>
@@ -115,10 +114,20 @@ namespace
   }
 }
 
-EMANE::Models::BentPipe::PCRManager::PCRManager():
-  modifierLengthBytes_{}{}
+EMANE::Models::BentPipe::PCRManager::PCRManager(){}
 
 void EMANE::Models::BentPipe::PCRManager::load(const std::string & sPCRFileName)
+{
+  pCurveTable_ = Utils::loadPCRCurveTable("bentpipe-model-pcr",
+                                          sPCRFileName,
+                                          [&sPCRFileName]()
+                                          {
+                                            return parse(sPCRFileName);
+                                          });
+}
+
+EMANE::Utils::PCRCurveTable
+EMANE::Models::BentPipe::PCRManager::parse(const std::string & sPCRFileName)
 {
   xmlDocPtr pSchemaDoc{xmlReadMemory(pzSchema,
                                      strlen(pzSchema),
@@ -165,10 +174,14 @@ void EMANE::Models::BentPipe::PCRManager::load(const std::string & sPCRFileName)
 
   xmlChar * pPacketSize = xmlGetProp(pRoot,BAD_CAST "packetsize");
 
-  modifierLengthBytes_ = Utils::ParameterConvert(reinterpret_cast<const char *>(pPacketSize)).toUINT16();
+  size_t modifierLengthBytes{Utils::ParameterConvert(reinterpret_cast<const char *>(pPacketSize)).toUINT16()};
 
   xmlFree(pPacketSize);
 
+  std::set<PCRCurveIndex> indexes{};
+
+  Utils::PCRCurveTable::Curves curves{};
+
   for(xmlNodePtr pCurveNode = pRoot->children;
       pCurveNode != nullptr;
       pCurveNode = pCurveNode->next)
@@ -182,9 +195,7 @@ void EMANE::Models::BentPipe::PCRManager::load(const std::string & sPCRFileName)
 
           xmlFree(pIndex);
 
-          Curve curve{};
-          std::int32_t i32MinScaledSINR{std::numeric_limits<std::int32_t>::max()};
-          std::int32_t i32MaxScaledSINR{std::numeric_limits<std::int32_t>::lowest()};
+          std::map<std::int32_t,float> curve{}; // scaled sinr, por
 
           for(xmlNodePtr pEntryNode = pCurveNode->children;
               pEntryNode != nullptr;
@@ -212,57 +223,32 @@ void EMANE::Models::BentPipe::PCRManager::load(const std::string & sPCRFileName)
 
                   xmlFree(pSINR);
                   xmlFree(pPOR);
-
-                  i32MinScaledSINR = std::min(i32ScaledSINR,i32MinScaledSINR);
-                  i32MaxScaledSINR = std::max(i32ScaledSINR,i32MaxScaledSINR);
                 }
             }
 
-          Curve interpolation{};
-
-          auto iter = curve.begin();
-
-          while(iter != curve.end())
+          if(!indexes.insert(index).second)
             {
-              auto x0 = iter->first;
-              auto y0 = iter->second;
-
-              ++iter;
-
-              if(iter != curve.end())
-                {
-                  auto x1 = iter->first;
-                  auto y1 = iter->second;
-
-                  auto slope = (y1 - y0) / (x1 - x0);
-
-                  for(auto i = x0; i < x1; ++i)
-                    {
-                      interpolation.insert({i,y1 - (x1 - i) * slope});
-                    }
-                }
+              throw makeException<ConfigurationException>("duplicate PCR curve: %zu in %s",
+                                                          index,
+                                                          sPCRFileName.c_str());
             }
 
-          curve.insert(interpolation.begin(),interpolation.end());
-
-          auto ret = curveTable_.insert(std::make_pair(index,
-                                                       std::make_tuple(i32MinScaledSINR,
-                                                                       i32MaxScaledSINR,
-                                                                       curve)));
+          Utils::PCRCurve::Points points{};
 
-          if(!ret.second)
+          for(const auto & entry : curve)
             {
-              throw makeException<ConfigurationException>("duplicate PCR curve: %zu in %s",
-                                                          index,
-                                                          sPCRFileName.c_str());
+              points.push_back({entry.first / 100.0f,entry.second});
             }
 
+          curves.push_back({index,points});
         }
     }
 
   xmlFreeDoc(pSchemaDoc);
 
   xmlFreeDoc(pDoc);
+
+  return {curves,modifierLengthBytes};
 }
 
 
@@ -270,48 +256,25 @@ std::optional<float> EMANE::Models::BentPipe::PCRManager::getPOR(PCRCurveIndex i
                                                                  float fSINR,
                                                                  size_t packetLengthBytes) const
 {
-  auto iter = curveTable_.find(index);
+  auto pCurve = pCurveTable_->getCurve(index);
 
-  if(iter == curveTable_.end())
+  if(!pCurve)
     {
       return {};
     }
 
-  std::int32_t i32MinScaledSINR = std::get<0>(iter->second);
-  std::int32_t i32MaxScaledSINR = std::get<1>(iter->second);
-  const Curve & curve = std::get<2>(iter->second);
-
-  std::int32_t i32Scaled{static_cast<std::int32_t>(fSINR * 100)};
-
-  if(i32Scaled < i32MinScaledSINR)
-    {
-      return 0;
-    }
-
-  if(i32Scaled > i32MaxScaledSINR)
-    {
-      return 1;
-    }
+  return pCurveTable_->getPOR(*pCurve,fSINR,packetLengthBytes);
+}
 
-  auto curveIter = curve.find(i32Scaled);
+std::set<EMANE::Models::BentPipe::PCRCurveIndex>
+EMANE::Models::BentPipe::PCRManager::PCRManager::getCurveIndexes() const
+{
+  std::set<PCRCurveIndex> indexes{};
 
-  if(curveIter != curve.end())
+  for(const auto & key : pCurveTable_->getKeys())
     {
-      auto por = curveIter->second;
-
-      if(modifierLengthBytes_)
-        {
-          por = powf(por, packetLengthBytes / static_cast<float>(modifierLengthBytes_));
-        }
-
-      return por;
+      indexes.emplace(static_cast<PCRCurveIndex>(key));
     }
 
-  return 0;
-}
-
-const EMANE::Models::BentPipe::PCRManager::CurveTable &
-EMANE::Models::BentPipe::PCRManager::PCRManager::getCurveTable() const
-{
-  return curveTable_;
+  return indexes;
 }
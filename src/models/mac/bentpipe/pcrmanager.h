@@ -34,10 +34,10 @@
 #define EMANE_MODELS_BENTPIPE_PCRMANAGER_HEADER_
 
 #include "types.h"
+#include "emane/utils/pcrcurve.h"
 
 #include <string>
-#include <map>
-#include <tuple>
+#include <set>
 #include <optional>
 
 namespace EMANE
@@ -58,17 +58,12 @@ namespace EMANE
                                     float fSINR,
                                     size_t packetLengthBytes) const;
 
-        using Curve = std::map<std::int32_t,float>; // sinr, por
-        using CurveTable = std::map<PCRCurveIndex, // por index
-                                    std::tuple<std::int32_t, // min SINR
-                                               std::int32_t, // max SINR
-                                               Curve>>;
-
-        const CurveTable & getCurveTable() const;
+        std::set<PCRCurveIndex> getCurveIndexes() const;
 
       private:
-        CurveTable curveTable_;
-        size_t modifierLengthBytes_;
+        Utils::PCRCurveTablePtr pCurveTable_;
+
+        static Utils::PCRCurveTable parse(const std::string & sPCRFileName);
       };
     }
   }
@@ -53,6 +53,8 @@ EMANE::Models::BentPipe::RadioModel::RadioModel(NEMId id,
                                                 RadioServiceProvider * pRadioServiceProvider):
   MACLayerImplementor{id, pPlatformServiceProvider, pRadioServiceProvider},
   packetStatusPublisher_{},
+  bReceiveStrandEnable_{},
+  receiveStrandMerger_{pPlatformServiceProvider,this},
   queueManager_{id,pPlatformServiceProvider,&packetStatusPublisher_},
   tosToTransponder_{},
   u64SequenceNumber_{}
@@ -296,6 +298,14 @@ EMANE::Models::BentPipe::RadioModel::initialize(Registrar & registrar)
                                                  "Defines the threshold in seconds to wait for another packet fragment"
                                                  " for an existing reassembly effort before abandoning the effort.");
 
+  configRegistrar.registerNumeric<bool>("receive.strandenable",
+                                        ConfigurationProperties::DEFAULT,
+                                        {false},
+                                        "Defines whether each transponder receive manager runs on its own"
+                                        " strand. When enabled, receive processing for multiple transponders"
+                                        " proceeds in parallel and upstream and ubend deliveries are merged"
+                                        " back onto the radio model thread in the order they are produced.");
+
   configRegistrar.registerNonNumeric<std::string>("pcrcurveuri",
                                                   ConfigurationProperties::REQUIRED,
                                                   {},
@@ -701,6 +711,18 @@ EMANE::Models::BentPipe::RadioModel::loadConfiguration(const ConfigurationUpdate
                                   item.first.c_str(),
                                   fragmentTimeoutThreshold.count());
         }
+      else if(item.first == "receive.strandenable")
+        {
+          bReceiveStrandEnable_ = item.second[0].asBool();
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "MACI %03hu BentPipe::RadioModel::%s: %s = %s",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  bReceiveStrandEnable_ ? "on" : "off");
+        }
       else if(item.first == "pcrcurveuri")
         {
           std::string sPCRCurveURI = item.second[0].asString();
@@ -828,11 +850,27 @@ EMANE::Models::BentPipe::RadioModel::loadConfiguration(const ConfigurationUpdate
 
       transponders_.emplace(transponderIndex,pTransponder);
 
+      TransponderPacketTransport * pTransponderPacketTransport{this};
+
+      // receive deliveries made on a receive strand are merged back
+      // onto the radio model thread
+      if(bReceiveStrandEnable_)
+        {
+          auto pReceiveStrand = new ReceiveStrand{id_,
+                                                  transponderIndex,
+                                                  pPlatformService_,
+                                                  &receiveStrandMerger_};
+
+          receiveStrands_.emplace(transponderIndex,pReceiveStrand);
+
+          pTransponderPacketTransport = pReceiveStrand;
+        }
+
       // create a per transponder receive manager
       receiveManagers_.emplace(transponderIndex,
                                new ReceiveManager{id_,
                                                   transponderIndex,
-                                                  this,
+                                                  pTransponderPacketTransport,
                                                   pPlatformService_,
                                                   pRadioService_,
                                                   &packetStatusPublisher_,
@@ -867,7 +905,17 @@ EMANE::Models::BentPipe::RadioModel::loadConfiguration(const ConfigurationUpdate
 
 void
 EMANE::Models::BentPipe::RadioModel::start()
-{}
+{
+  if(!receiveStrands_.empty())
+    {
+      receiveStrandMerger_.start();
+
+      for(auto & entry : receiveStrands_)
+        {
+          entry.second->start(receiveManagers_[entry.first].get());
+        }
+    }
+}
 
 
 void
@@ -922,6 +970,13 @@ EMANE::Models::BentPipe::RadioModel::stop()
       entry.second->stop();
     }
 
+  for(auto & entry : receiveStrands_)
+    {
+      entry.second->stop();
+    }
+
+  receiveStrandMerger_.stop();
+
   for(const auto & antennaIndex : registeredRxAntenna_)
     {
       sendDownstreamControl({Controls::RxAntennaRemoveControlMessage::create(antennaIndex)});
@@ -1048,14 +1103,42 @@ void EMANE::Models::BentPipe::RadioModel::processUpstreamPacket(const CommonMACH
                                      pktInfo.getSource(),
                                      pktInfo.getDestination());
 
-              receiveManagers_[transponderIndex]->enqueue(std::move(bentPipeMessage),
-                                                          pktInfo,
-                                                          pkt.length(),
-                                                          startOfReception,
-                                                          frequencySegments,
-                                                          antennaReceiveInfo.getSpan(),
-                                                          now,
-                                                          hdr.getSequenceNumber());
+              auto pReceiveManager = receiveManagers_[transponderIndex].get();
+
+              if(auto iterStrand = receiveStrands_.find(transponderIndex);
+                 iterStrand != receiveStrands_.end())
+                {
+                  iterStrand->second->post([pReceiveManager,
+                                            bentPipeMessage = std::move(bentPipeMessage),
+                                            pktInfo,
+                                            length = pkt.length(),
+                                            startOfReception,
+                                            frequencySegments,
+                                            span = antennaReceiveInfo.getSpan(),
+                                            now,
+                                            u64SequenceNumber = hdr.getSequenceNumber()]() mutable
+                                           {
+                                             pReceiveManager->enqueue(std::move(bentPipeMessage),
+                                                                      pktInfo,
+                                                                      length,
+                                                                      startOfReception,
+                                                                      frequencySegments,
+                                                                      span,
+                                                                      now,
+                                                                      u64SequenceNumber);
+                                           });
+                }
+              else
+                {
+                  pReceiveManager->enqueue(std::move(bentPipeMessage),
+                                           pktInfo,
+                                           pkt.length(),
+                                           startOfReception,
+                                           frequencySegments,
+                                           antennaReceiveInfo.getSpan(),
+                                           now,
+                                           hdr.getSequenceNumber());
+                }
             }
           else
             {
@@ -39,6 +39,8 @@
 #include "transponderpackettransport.h"
 #include "transponderconfiguration.h"
 #include "receivemanager.h"
+#include "receivestrand.h"
+#include "receivestrandmerger.h"
 #include "queuemanager.h"
 #include "pcrmanager.h"
 #include "packetstatuspublisher.h"
@@ -130,6 +132,11 @@ namespace EMANE
         using ReceiveManagers =
           std::map<TransponderIndex,std::unique_ptr<ReceiveManager>>;
         ReceiveManagers receiveManagers_;
+        bool bReceiveStrandEnable_;
+        ReceiveStrandMerger receiveStrandMerger_;
+        using ReceiveStrands =
+          std::map<TransponderIndex,std::unique_ptr<ReceiveStrand>>;
+        ReceiveStrands receiveStrands_;
         QueueManager queueManager_;
         std::array<int,256> tosToTransponder_;
         PCRManager pcrManager_;
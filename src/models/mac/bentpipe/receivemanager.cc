@@ -74,6 +74,12 @@ EMANE::Models::BentPipe::ReceiveManager::ReceiveManager(NEMId id,
                           bProcess ? "process" : "ubend");
 }
 
+void
+EMANE::Models::BentPipe::ReceiveManager::setProcessScheduler(ProcessScheduler scheduler)
+{
+  processScheduler_ = std::move(scheduler);
+}
+
 void
 EMANE::Models::BentPipe::ReceiveManager::enqueue(BentPipeMessage && otaMessage,
                                                  const PacketInfo & pktInfo,
@@ -505,9 +511,16 @@ EMANE::Models::BentPipe::ReceiveManager::process()
 
       // if(pendingEndOfReception < nextEoRCheckTime_)
       //   {
-      pPlatformService_->timerService().
-        schedule(std::bind(&ReceiveManager::process,this),
-                 pendingEndOfReception);
+      if(processScheduler_)
+        {
+          processScheduler_(pendingEndOfReception);
+        }
+      else
+        {
+          pPlatformService_->timerService().
+            schedule(std::bind(&ReceiveManager::process,this),
+                     pendingEndOfReception);
+        }
 
       nextEoRCheckTime_ = pendingEndOfReception;
       //}
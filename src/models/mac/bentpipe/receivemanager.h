@@ -50,6 +50,7 @@
 #include "emane/utils/randomnumberdistribution.h"
 
 #include <tuple>
+#include <functional>
 
 namespace EMANE
 {
@@ -94,6 +95,21 @@ namespace EMANE
 
         void process();
 
+        /**
+         * Function used to request a future call to process() at
+         * the specified time
+         */
+        using ProcessScheduler = std::function<void(const TimePoint &)>;
+
+        /**
+         * Sets the process scheduler used in place of the platform
+         * timer service. Used when the receive manager runs on its
+         * own receive strand.
+         *
+         * @param scheduler Process scheduler
+         */
+        void setProcessScheduler(ProcessScheduler scheduler);
+
       private:
         NEMId id_;
         TransponderIndex transponderIndex_;
@@ -137,6 +153,7 @@ namespace EMANE
         FragmentStore fragmentStore_;
         TimePoint lastFragmentCheckTime_;
         TimePoint nextEoRCheckTime_;
+        ProcessScheduler processScheduler_;
 
         ReceiveManager(const ReceiveManager &) = delete;
 
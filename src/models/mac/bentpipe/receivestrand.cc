@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "receivestrand.h"
+
+#include "emane/utils/threadplacement.h"
+
+#include <exception>
+
+EMANE::Models::BentPipe::ReceiveStrand::ReceiveStrand(NEMId id,
+                                                      TransponderIndex transponderIndex,
+                                                      PlatformServiceProvider * pPlatformService,
+                                                      ReceiveStrandMerger * pReceiveStrandMerger):
+  id_{id},
+  transponderIndex_{transponderIndex},
+  pPlatformService_{pPlatformService},
+  pReceiveStrandMerger_{pReceiveStrandMerger},
+  pReceiveManager_{},
+  bCancel_{},
+  nextProcessTime_{TimePoint::max()}{}
+
+EMANE::Models::BentPipe::ReceiveStrand::~ReceiveStrand()
+{
+  stop();
+}
+
+void
+EMANE::Models::BentPipe::ReceiveStrand::start(ReceiveManager * pReceiveManager)
+{
+  if(!thread_.joinable())
+    {
+      pReceiveManager_ = pReceiveManager;
+
+      // end of reception processing is requested by the receive
+      // manager on the strand thread
+      pReceiveManager_->setProcessScheduler([this](const TimePoint & timePoint)
+                                            {
+                                              nextProcessTime_ = std::min(nextProcessTime_,timePoint);
+                                            });
+
+      bCancel_ = false;
+
+      thread_ = std::thread{&ReceiveStrand::worker,this};
+    }
+}
+
+void
+EMANE::Models::BentPipe::ReceiveStrand::stop()
+{
+  if(thread_.joinable())
+    {
+      {
+        std::lock_guard<std::mutex> m{mutex_};
+
+        bCancel_ = true;
+
+        cond_.notify_one();
+      }
+
+      thread_.join();
+
+      tasks_.clear();
+    }
+}
+
+void
+EMANE::Models::BentPipe::ReceiveStrand::ubendPacket(DownstreamPacket & pkt,
+                                                    TransponderIndex transponderIndex)
+{
+  pReceiveStrandMerger_->ubendPacket(std::move(pkt),transponderIndex);
+}
+
+void
+EMANE::Models::BentPipe::ReceiveStrand::processPacket(UpstreamPacket & pkt)
+{
+  pReceiveStrandMerger_->processPacket(std::move(pkt));
+}
+
+void
+EMANE::Models::BentPipe::ReceiveStrand::worker()
+{
+  Utils::ThreadPlacement::Scope placement{Utils::ThreadPlacement::ThreadClass::NEM,id_};
+
+  while(true)
+    {
+      Utils::FunctionWrapper task{};
+
+      bool bTask{};
+
+      {
+        std::unique_lock<std::mutex> m{mutex_};
+
+        auto ready = [this]
+          {
+            return !tasks_.empty() || bCancel_ || Clock::now() >= nextProcessTime_;
+          };
+
+        if(nextProcessTime_ == TimePoint::max())
+          {
+            cond_.wait(m,ready);
+          }
+        else
+          {
+            cond_.wait_until(m,nextProcessTime_,ready);
+          }
+
+        if(bCancel_)
+          {
+            break;
+          }
+
+        if(!tasks_.empty())
+          {
+            task = std::move(tasks_.front());
+
+            tasks_.pop_front();
+
+            bTask = true;
+          }
+      }
+
+      try
+        {
+          if(bTask)
+            {
+              task();
+            }
+          else
+            {
+              nextProcessTime_ = TimePoint::max();
+
+              pReceiveManager_->process();
+            }
+        }
+      catch(std::exception & exp)
+        {
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  ERROR_LEVEL,
+                                  "MACI %03hu BentPipe::ReceiveStrand::%s transponder %hu"
+                                  " receive processing error: %s",
+                                  id_,
+                                  __func__,
+                                  transponderIndex_,
+                                  exp.what());
+        }
+      catch(...)
+        {
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  ERROR_LEVEL,
+                                  "MACI %03hu BentPipe::ReceiveStrand::%s transponder %hu"
+                                  " receive processing unknown error",
+                                  id_,
+                                  __func__,
+                                  transponderIndex_);
+        }
+    }
+}
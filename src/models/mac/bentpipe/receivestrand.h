@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANE_MODELS_BENTPIPE_RECEIVESTRAND_HEADER_
+#define EMANE_MODELS_BENTPIPE_RECEIVESTRAND_HEADER_
+
+#include "receivemanager.h"
+#include "receivestrandmerger.h"
+#include "transponderpackettransport.h"
+
+#include "emane/types.h"
+#include "emane/platformserviceprovider.h"
+#include "emane/utils/functionwrapper.h"
+
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+
+namespace EMANE
+{
+  namespace Models
+  {
+    namespace BentPipe
+    {
+      /**
+       * @class ReceiveStrand
+       *
+       * @brief Runs a single transponder receive manager on its own
+       * thread.
+       *
+       * Over-the-air frames are processed in the order they are
+       * posted and end of reception processing is driven by the
+       * strand instead of the platform timer service. Upstream and
+       * ubend deliveries are handed to the ReceiveStrandMerger for
+       * processing on the radio model thread.
+       */
+      class ReceiveStrand : public TransponderPacketTransport
+      {
+      public:
+        ReceiveStrand(NEMId id,
+                      TransponderIndex transponderIndex,
+                      PlatformServiceProvider * pPlatformService,
+                      ReceiveStrandMerger * pReceiveStrandMerger);
+
+        ~ReceiveStrand();
+
+        /**
+         * Starts the strand thread
+         *
+         * @param pReceiveManager Receive manager to run. The receive
+         * manager must use this strand as its packet transport.
+         */
+        void start(ReceiveManager * pReceiveManager);
+
+        void stop();
+
+        /**
+         * Posts a function to run on the strand thread
+         *
+         * @param fn Callable object
+         */
+        template<typename Function>
+        void post(Function && fn);
+
+        void ubendPacket(DownstreamPacket & pkt,
+                         TransponderIndex transponderIndex) override;
+
+        void processPacket(UpstreamPacket & pkt) override;
+
+      private:
+        NEMId id_;
+        TransponderIndex transponderIndex_;
+        PlatformServiceProvider * pPlatformService_;
+        ReceiveStrandMerger * pReceiveStrandMerger_;
+        ReceiveManager * pReceiveManager_;
+
+        std::thread thread_;
+        std::mutex mutex_;
+        std::condition_variable cond_;
+        bool bCancel_;
+
+        using Tasks = std::deque<Utils::FunctionWrapper>;
+        Tasks tasks_;
+
+        // only accessed by the strand thread
+        TimePoint nextProcessTime_;
+
+        void worker();
+
+        ReceiveStrand(const ReceiveStrand &) = delete;
+
+        ReceiveStrand & operator=(const ReceiveStrand &) = delete;
+      };
+    }
+  }
+}
+
+#include "receivestrand.inl"
+
+#endif // EMANE_MODELS_BENTPIPE_RECEIVESTRAND_HEADER_
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "receivestrandmerger.h"
+
+EMANE::Models::BentPipe::ReceiveStrandMerger::ReceiveStrandMerger(PlatformServiceProvider * pPlatformService,
+                                                                  TransponderPacketTransport * pTransponderPacketTransport):
+  pPlatformService_{pPlatformService},
+  pTransponderPacketTransport_{pTransponderPacketTransport},
+  bRunning_{},
+  drainTimedEventId_{}{}
+
+void
+EMANE::Models::BentPipe::ReceiveStrandMerger::start()
+{
+  std::lock_guard<std::mutex> m{mutex_};
+
+  bRunning_ = true;
+}
+
+void
+EMANE::Models::BentPipe::ReceiveStrandMerger::stop()
+{
+  std::lock_guard<std::mutex> m{mutex_};
+
+  bRunning_ = false;
+
+  if(drainTimedEventId_)
+    {
+      pPlatformService_->timerService().cancelTimedEvent(drainTimedEventId_);
+
+      drainTimedEventId_ = 0;
+    }
+
+  deliveries_.clear();
+}
+
+void
+EMANE::Models::BentPipe::ReceiveStrandMerger::processPacket(UpstreamPacket && pkt)
+{
+  post([this,pkt = std::move(pkt)]() mutable
+       {
+         pTransponderPacketTransport_->processPacket(pkt);
+       });
+}
+
+void
+EMANE::Models::BentPipe::ReceiveStrandMerger::ubendPacket(DownstreamPacket && pkt,
+                                                          TransponderIndex transponderIndex)
+{
+  post([this,pkt = std::move(pkt),transponderIndex]() mutable
+       {
+         pTransponderPacketTransport_->ubendPacket(pkt,transponderIndex);
+       });
+}
+
+void
+EMANE::Models::BentPipe::ReceiveStrandMerger::post(Utils::FunctionWrapper && delivery)
+{
+  std::lock_guard<std::mutex> m{mutex_};
+
+  if(!bRunning_)
+    {
+      return;
+    }
+
+  deliveries_.push_back(std::move(delivery));
+
+  // a single pending timer drains every delivery posted before it
+  // fires, so only schedule when one is not already outstanding
+  if(!drainTimedEventId_)
+    {
+      drainTimedEventId_ =
+        pPlatformService_->timerService().
+        schedule(std::bind(&ReceiveStrandMerger::drain,this),
+                 Clock::now());
+    }
+}
+
+void
+EMANE::Models::BentPipe::ReceiveStrandMerger::drain()
+{
+  Deliveries deliveries{};
+
+  {
+    std::lock_guard<std::mutex> m{mutex_};
+
+    // a drain already dispatched when the merger was stopped
+    if(!bRunning_)
+      {
+        return;
+      }
+
+    drainTimedEventId_ = 0;
+
+    deliveries.swap(deliveries_);
+  }
+
+  for(auto & delivery : deliveries)
+    {
+      delivery();
+    }
+}
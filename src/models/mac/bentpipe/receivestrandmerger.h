@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANE_MODELS_BENTPIPE_RECEIVESTRANDMERGER_HEADER_
+#define EMANE_MODELS_BENTPIPE_RECEIVESTRANDMERGER_HEADER_
+
+#include "transponderpackettransport.h"
+
+#include "emane/platformserviceprovider.h"
+#include "emane/utils/functionwrapper.h"
+
+#include <deque>
+#include <mutex>
+
+namespace EMANE
+{
+  namespace Models
+  {
+    namespace BentPipe
+    {
+      /**
+       * @class ReceiveStrandMerger
+       *
+       * @brief Merges the upstream and ubend deliveries of all
+       * receive strands back onto the radio model thread.
+       *
+       * Deliveries are handed to the radio model packet transport in
+       * the order they were produced by the receive strands.
+       */
+      class ReceiveStrandMerger
+      {
+      public:
+        ReceiveStrandMerger(PlatformServiceProvider * pPlatformService,
+                            TransponderPacketTransport * pTransponderPacketTransport);
+
+        void start();
+
+        void stop();
+
+        /**
+         * Posts an upstream delivery. May be called from any thread.
+         *
+         * @param pkt Upstream packet
+         */
+        void processPacket(UpstreamPacket && pkt);
+
+        /**
+         * Posts a ubend delivery. May be called from any thread.
+         *
+         * @param pkt Downstream packet
+         * @param transponderIndex Receiving transponder index
+         */
+        void ubendPacket(DownstreamPacket && pkt,
+                         TransponderIndex transponderIndex);
+
+      private:
+        PlatformServiceProvider * pPlatformService_;
+        TransponderPacketTransport * pTransponderPacketTransport_;
+
+        std::mutex mutex_;
+        bool bRunning_;
+        TimerEventId drainTimedEventId_;
+
+        using Deliveries = std::deque<Utils::FunctionWrapper>;
+        Deliveries deliveries_;
+
+        void post(Utils::FunctionWrapper && delivery);
+
+        void drain();
+
+        ReceiveStrandMerger(const ReceiveStrandMerger &) = delete;
+
+        ReceiveStrandMerger & operator=(const ReceiveStrandMerger &) = delete;
+      };
+    }
+  }
+}
+
+#endif // EMANE_MODELS_BENTPIPE_RECEIVESTRANDMERGER_HEADER_
@@ -401,6 +401,20 @@ void EMANE::Models::IEEE80211ABG::MACConfig::registerConfiguration(Configuration
                                          0.0f,
                                          3600.0f);
 
+  configRegistrar.registerNumeric<std::uint16_t>("duplicatewindowsize",
+                                                 ConfigurationProperties::DEFAULT,
+                                                 {1024},
+                                                 "Defines the number of sequence numbers, up to and"
+                                                 " including the highest received, tracked per source"
+                                                 " for unicast duplicate detection. A source advances"
+                                                 " its sequence number for every frame it transmits,"
+                                                 " to any destination, so the window must cover the"
+                                                 " frames sent between a transmission and its"
+                                                 " retries. A sequence number remains a duplicate for"
+                                                 " 5 seconds after it is received.",
+                                                 1,
+                                                 32768);
+
   configRegistrar.registerNumeric<bool>("radiometricenable",
                                         ConfigurationProperties::DEFAULT,
                                         {false},
@@ -927,6 +941,14 @@ EMANE::Models::IEEE80211ABG::MACConfig::getPcrUri() const
 
 
 
+std::uint16_t
+EMANE::Models::IEEE80211ABG::MACConfig::getDuplicateWindowSize() const
+{
+  return configItems_.u16DuplicateWindowSize_;
+}
+
+
+
 EMANE::Microseconds
 EMANE::Models::IEEE80211ABG::MACConfig::getNeighborTimeoutMicroseconds() const
 {
@@ -1409,6 +1431,19 @@ EMANE::Models::IEEE80211ABG::MACConfig::configureStaticItems(const Configuration
                                 item.first.c_str(),
                                 configItems_.sPcrUri_.c_str());
       }
+    else if(item.first == "duplicatewindowsize")
+      {
+        configItems_.u16DuplicateWindowSize_ = item.second[0].asUINT16();
+
+        LOGGER_STANDARD_LOGGING(logServiceProvider_,
+                                INFO_LEVEL,
+                                "MACI %03hu %s::%s %s = %hu",
+                                id_,
+                                pzLayerName,
+                                __func__,
+                                item.first.c_str(),
+                                configItems_.u16DuplicateWindowSize_);
+      }
     else if(item.first == "neighbortimeout")
       {
         float fValue{item.second[0].asFloat()};
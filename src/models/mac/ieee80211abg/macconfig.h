@@ -93,6 +93,7 @@ namespace EMANE
           std::uint8_t   u8BroadcastDataRateIndex_;                 // broadcast data rate index
           std::uint16_t  u16RtsThreshold_;                          // rtc cts enable threshold
           std::uint16_t  u16FlowControlTokens_;                     // flow control tokens
+          std::uint16_t  u16DuplicateWindowSize_;                   // duplicate detection window
 
           std::uint32_t  u32MaxP2PDistance_;                        // max p2p distance
 
@@ -221,6 +222,8 @@ namespace EMANE
 
             std::string getPcrUri() const;
 
+            std::uint16_t getDuplicateWindowSize() const;
+
             Microseconds getNeighborTimeoutMicroseconds() const;
 
             Microseconds getChannelActivityIntervalMicroseconds() const;
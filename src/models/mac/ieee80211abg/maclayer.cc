@@ -124,7 +124,13 @@ EMANE::Models::IEEE80211ABG::MACLayer::MACLayer(NEMId id,
   bHasPendingDownstreamQueueEntry_{},
   RNDZeroToOne_{0.0f, 1.0f},
   commonLayerStatistics_(MAX_ACCESS_CATEGORIES),
-  currentEndOfTransmissionTime_{}
+  currentEndOfTransmissionTime_{},
+  eorScheduler_{pPlatformService_->timerService(),
+                pRadioService_->spectrumService(),
+                std::bind(&MACLayer::processEndOfReception,
+                          this,
+                          std::placeholders::_1,
+                          std::placeholders::_2)}
 {
   commonLayerStatistics_[0].reset(
     new Utils::CommonLayerStatistics{STATISTIC_TABLE_LABELS,
@@ -231,6 +237,9 @@ EMANE::Models::IEEE80211ABG::MACLayer::start()
       queueMetricManager_.addQueueMetric(u8Category, maxCapacity);
     }
 
+  // set the duplicate detection window
+  duplicateDetector_.setWindowSize(macConfig_.getDuplicateWindowSize());
+
   // set neighbor timeout and num categories
   neighborManager_.setNeighborTimeoutMicroseconds(macConfig_.getNeighborTimeoutMicroseconds());
 
@@ -348,6 +357,9 @@ EMANE::Models::IEEE80211ABG::MACLayer::stop()
 
   downstreamQueueTimedEventId_ = 0;
 
+  // discard receptions pending end of reception
+  eorScheduler_.clear();
+
   if(macConfig_.getFlowControlEnable())
     {
       flowControlManager_.stop();
@@ -592,111 +604,114 @@ EMANE::Models::IEEE80211ABG::MACLayer::processUpstreamPacket(const CommonMACHead
 
       Microseconds span{pReceivePropertiesControlMessage->getSpan()};
 
-      auto callback =std::bind([this,
-                                startOfReception,
-                                frequencySegments,
-                                span,
-                                timeNow](UpstreamPacket & pkt,
-                                         std::uint64_t u64SequenceNumber,
-                                         std::uint8_t u8Category)
-                               {
-                                 const PacketInfo & pktInfo{pkt.getPacketInfo()};
-
-                                 const FrequencySegment & frequencySegment{*frequencySegments.begin()};
-
-                                 LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
-                                                        DEBUG_LEVEL,
-                                                        "MACI %03hu %s upstream EOR processing: src %hu, dst %hu, len %zu, freq %ju, offset %ju, duration %ju",
-                                                        id_,
-                                                        pzLayerName,
-                                                        pktInfo.getSource(),
-                                                        pktInfo.getDestination(),
-                                                        pkt.length(),
-                                                        frequencySegment.getFrequencyHz(),
-                                                        frequencySegment.getOffset().count(),
-                                                        frequencySegment.getDuration().count());
-
-
-                                 double dNoiseFloordB{};
-
-                                 try
-                                   {
-                                     // get the spectrum info for the entire span, where a span
-                                     // is the total time between the start of the signal of the
-                                     // earliest segment and the end of the signal of the latest
-                                     // segment. This is not necessarily the signal duration.
-                                     auto window = pRadioService_->spectrumService().request(frequencySegment.getFrequencyHz(),
-                                                                                             span,
-                                                                                             startOfReception);
-
-                                     // since we only have a single segment the span will equal the segment duration.
-                                     // For simple noise processing we will just pull out the max noise segment, we can
-                                     // use the maxBinNoiseFloor utility function for this. More elaborate noise window analysis
-                                     // will require a more complex algorithm, although you should get a lot of mileage out of
-                                     // this utility function.
-                                     bool bSignalInNoise{};
-
-                                     std::tie(dNoiseFloordB,bSignalInNoise) =
-                                       Utils::maxBinNoiseFloor(window,frequencySegment.getRxPowerdBm());
-
-                                     if(bSignalInNoise)
-                                       {
-                                         LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
-                                                                ERROR_LEVEL,
-                                                                "MACI %03hu %s upstream EOR processing: spectrum service reporting signal in noise."
-                                                                " This is an unallowable noise mode. Valid PHY noise modes are: none and outofband.",
-                                                                id_,
-                                                                pzLayerName);
-
-                                         commonLayerStatistics_[u8Category]->processOutbound(pkt,
-                                                                                             std::chrono::duration_cast<Microseconds>(Clock::now() - timeNow),
-                                                                                             DROP_CODE_BAD_CONTROL_INFO);
-
-                                         return true;
-
-                                       }
-
-                                   }
-                                 catch(SpectrumServiceException & exp)
-                                   {
-                                     LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
-                                                            ERROR_LEVEL,
-                                                            "MACI %03hu %s upstream EOR processing: spectrum service request error: %s",
-                                                            id_,
-                                                            pzLayerName,
-                                                            exp.what());
-                                     commonLayerStatistics_[u8Category]->processOutbound(pkt,
-                                                                                         std::chrono::duration_cast<Microseconds>(Clock::now() - timeNow),
-                                                                                         DROP_CODE_BAD_SPECTRUM_QUERY);
-                                     // drop
-                                     return true;
-                                   }
-
-                                 handleUpstreamPacket(pkt,
-                                                      frequencySegment.getRxPowerdBm(),
-                                                      dNoiseFloordB,
-                                                      u64SequenceNumber,
-                                                      timeNow,
-                                                      u8Category);
-
-                                 return true;
-
-                               },pkt,commonMACHeader.getSequenceNumber(),u8Category);
-
-
-      auto eor = startOfReception + frequencySegments.begin()->getDuration();
-
-      if(eor > timeNow)
+      const FrequencySegment & frequencySegment{*frequencySegments.begin()};
+
+      auto eor = startOfReception + frequencySegment.getDuration();
+
+      // wait for end of reception to complete processing
+      eorScheduler_.schedule(eor,
+                             {frequencySegment.getFrequencyHz(),span,startOfReception},
+                             {std::move(pkt),
+                              frequencySegment,
+                              timeNow,
+                              commonMACHeader.getSequenceNumber(),
+                              u8Category});
+    }
+}
+
+
+
+void
+EMANE::Models::IEEE80211ABG::MACLayer::processEndOfReception(Reception & reception,
+                                                             const SpectrumWindowResult & result)
+{
+  auto & pkt = reception.pkt_;
+
+  const auto & frequencySegment = reception.frequencySegment_;
+
+  const auto & timeNow = reception.timeNow_;
+
+  std::uint8_t u8Category{reception.u8Category_};
+
+  const PacketInfo & pktInfo{pkt.getPacketInfo()};
+
+  LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
+                         DEBUG_LEVEL,
+                         "MACI %03hu %s upstream EOR processing: src %hu, dst %hu, len %zu, freq %ju, offset %ju, duration %ju",
+                         id_,
+                         pzLayerName,
+                         pktInfo.getSource(),
+                         pktInfo.getDestination(),
+                         pkt.length(),
+                         frequencySegment.getFrequencyHz(),
+                         frequencySegment.getOffset().count(),
+                         frequencySegment.getDuration().count());
+
+
+  double dNoiseFloordB{};
+
+  try
+    {
+      // the spectrum info for the entire span, where a span is the
+      // total time between the start of the signal of the earliest
+      // segment and the end of the signal of the latest segment, is
+      // requested by the EOR scheduler. This is not necessarily the
+      // signal duration.
+      if(result.second)
         {
-          // wait for end of reception to complete processing
-          pPlatformService_->timerService().schedule(callback,eor);
+          std::rethrow_exception(result.second);
         }
-      else
+
+      const auto & window = result.first;
+
+      // since we only have a single segment the span will equal the segment duration.
+      // For simple noise processing we will just pull out the max noise segment, we can
+      // use the maxBinNoiseFloor utility function for this. More elaborate noise window analysis
+      // will require a more complex algorithm, although you should get a lot of mileage out of
+      // this utility function.
+      bool bSignalInNoise{};
+
+      std::tie(dNoiseFloordB,bSignalInNoise) =
+        Utils::maxBinNoiseFloor(window,frequencySegment.getRxPowerdBm());
+
+      if(bSignalInNoise)
         {
-          // we can process now, end of reception has past
-          callback();
+          LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
+                                 ERROR_LEVEL,
+                                 "MACI %03hu %s upstream EOR processing: spectrum service reporting signal in noise."
+                                 " This is an unallowable noise mode. Valid PHY noise modes are: none and outofband.",
+                                 id_,
+                                 pzLayerName);
+
+          commonLayerStatistics_[u8Category]->processOutbound(pkt,
+                                                              std::chrono::duration_cast<Microseconds>(Clock::now() - timeNow),
+                                                              DROP_CODE_BAD_CONTROL_INFO);
+
+          return;
         }
+
     }
+  catch(SpectrumServiceException & exp)
+    {
+      LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
+                             ERROR_LEVEL,
+                             "MACI %03hu %s upstream EOR processing: spectrum service request error: %s",
+                             id_,
+                             pzLayerName,
+                             exp.what());
+      commonLayerStatistics_[u8Category]->processOutbound(pkt,
+                                                          std::chrono::duration_cast<Microseconds>(Clock::now() - timeNow),
+                                                          DROP_CODE_BAD_SPECTRUM_QUERY);
+      // drop
+      return;
+    }
+
+  handleUpstreamPacket(pkt,
+                       frequencySegment.getRxPowerdBm(),
+                       dNoiseFloordB,
+                       reception.u64SequenceNumber_,
+                       timeNow,
+                       u8Category);
 }
 
 
@@ -825,7 +840,9 @@ EMANE::Models::IEEE80211ABG::MACLayer::handleUpstreamPacket(UpstreamPacket & pkt
       else
         {
           // check for duplicate packet based on previous sender
-          if(isDuplicate(macHeaderParams.getSrcNEM(), macHeaderParams.getSequenceNumber()))
+          if(duplicateDetector_.isDuplicate(macHeaderParams.getSrcNEM(),
+                                            macHeaderParams.getSequenceNumber(),
+                                            timeNow))
             {
               LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
                                      DEBUG_LEVEL,
@@ -1857,91 +1874,6 @@ bool EMANE::Models::IEEE80211ABG::MACLayer::handleDownstreamQueueEntry(std::uint
 }
 
 
-bool
-EMANE::Models::IEEE80211ABG::MACLayer::isDuplicate(NEMId src, std::uint16_t seq)
-{
-  TimePoint timeNow {Clock::now()};
-
-  size_t historySize{16};
-
-  // entry valid interval 5 seconds
-  Microseconds vaildIntervalMicroseconds{std::chrono::seconds{5}};
-
-  auto dupIter = duplicateMap_.find(src);
-
-  if(dupIter == duplicateMap_.end())
-    {
-      SequenceVector v{};
-
-      v.reserve(historySize);
-
-      v.push_back(SequenceEntry(seq, timeNow));
-
-      duplicateMap_.insert(std::make_pair(src, v));
-
-      // not a duplicate
-      return false;
-    }
-  else
-    {
-      // oldest index
-      size_t oldestIndex{};
-
-      // oldest time starts as current time
-      TimePoint oldestTime{timeNow};
-
-      for(size_t idx = 0; idx < dupIter->second.size(); ++idx)
-        {
-          if(dupIter->second.at(idx).seq_ == seq)
-            {
-              // within the time window
-              if((dupIter->second.at(idx).tp_ + vaildIntervalMicroseconds) >= timeNow)
-                {
-                  // is duplicate
-                  return true;
-                }
-              else
-                {
-                  // update entry
-                  dupIter->second.at(idx) = SequenceEntry(seq, timeNow);
-
-                  // not a duplicate
-                  return false;
-                }
-            }
-          // no match
-          else
-            {
-              // check entry age
-              if(dupIter->second.at(idx).tp_ < oldestTime)
-                {
-                  // new oldest time
-                  oldestTime = dupIter->second.at(idx).tp_;
-
-                  // new oldest index
-                  oldestIndex = idx;
-                }
-            }
-        }
-
-      if(dupIter->second.size() < historySize)
-        {
-          // add entry
-          dupIter->second.push_back(SequenceEntry(seq, timeNow));
-        }
-      else
-        {
-          // replace entry
-          dupIter->second.at(oldestIndex) = SequenceEntry(seq, timeNow);
-        }
-
-      // not a duplicate
-      return false;
-    }
-}
-
-
-
 bool
 EMANE::Models::IEEE80211ABG::MACLayer::addToken()
 {
@@ -44,6 +44,8 @@
 
 #include "emane/utils/randomnumberdistribution.h"
 #include "emane/utils/commonlayerstatistics.h"
+#include "emane/utils/eorscheduler.h"
+#include "emane/utils/duplicatedetector.h"
 
 #include "macheaderparams.h"
 #include "downstreamqueue.h"
@@ -67,32 +69,6 @@ namespace EMANE
   {
     namespace IEEE80211ABG
     {
-      /**
-       *
-       * @brief structure used to define parameters to detect duplicate frames
-       *
-       */
-      struct SequenceEntry
-      {
-        std::uint16_t     seq_;        // sequence number
-        TimePoint         tp_;         // validity time
-
-        /**
-         *
-         * default constructor
-         *
-         */
-
-        SequenceEntry(std::uint16_t seq, const TimePoint & tp) :
-          seq_(seq),
-          tp_(tp)
-        { }
-      };
-
-      using SequenceVector = std::vector<SequenceEntry>;
-
-      using DuplicateMap = std::map<NEMId, SequenceVector>;
-
       class TransmissionTxState;
 
       /**
@@ -207,19 +183,6 @@ namespace EMANE
         void sendDownstreamMessage(DownstreamQueueEntry & entry,
                                    MACHeaderParams & macHeaderParams);
 
-        /**
-         *
-         * check if a duplicate packet has been received
-         *
-         * @param src the source nem
-         * @param seq sequence number of packet
-         *
-         * @retval true if src and seq match the last received values, otherwise false.
-         *
-         */
-        bool isDuplicate(NEMId src, std::uint16_t seq);
-
-
         /**
          *
          * add token to flow control
@@ -311,7 +274,7 @@ namespace EMANE
 
         std::uint16_t u16EntrySequenceNumber_;
 
-        DuplicateMap duplicateMap_;
+        Utils::DuplicateDetector duplicateDetector_;
 
         ModeTimingParameters modeTiming_;
 
@@ -336,6 +299,20 @@ namespace EMANE
 
         TimePoint currentEndOfTransmissionTime_;
 
+        struct Reception
+        {
+          UpstreamPacket pkt_;
+          FrequencySegment frequencySegment_;
+          TimePoint timeNow_;
+          std::uint64_t u64SequenceNumber_;
+          std::uint8_t u8Category_;
+        };
+
+        Utils::EORScheduler<Reception> eorScheduler_;
+
+        void processEndOfReception(Reception & reception,
+                                   const SpectrumWindowResult & result);
+
         bool handleDownstreamQueueEntry(std::uint64_t u64SequenceNumber);
 
         void setEntrySequenceNumber(DownstreamQueueEntry &entry);
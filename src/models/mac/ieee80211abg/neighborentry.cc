@@ -219,22 +219,6 @@ EMANE::Models::IEEE80211ABG::NeighborEntry::setOneHopNeighbors(const NbrSet & nb
 
 
 
-void 
-EMANE::Models::IEEE80211ABG::NeighborEntry::setHiddenNeighbors(const NbrSet & nbrs)
-{
-  hiddenNbrSet_ = nbrs;
-}
-
-
-
-void 
-EMANE::Models::IEEE80211ABG::NeighborEntry::setCommonNeighbors(const NbrSet & nbrs)
-{
-  commonNbrSet_ = nbrs;
-}
-
-
-
 const EMANE::Models::IEEE80211ABG::NbrSet & 
 EMANE::Models::IEEE80211ABG::NeighborEntry::getOneHopNeighbors() const
 {
@@ -242,36 +226,8 @@ EMANE::Models::IEEE80211ABG::NeighborEntry::getOneHopNeighbors() const
 }
 
 
-const EMANE::Models::IEEE80211ABG::NbrSet & 
-EMANE::Models::IEEE80211ABG::NeighborEntry::getCommonNeighbors() const
-{
-  return commonNbrSet_;
-}
-
-
-const EMANE::Models::IEEE80211ABG::NbrSet & 
-EMANE::Models::IEEE80211ABG::NeighborEntry::getHiddenNeighbors() const
-{
-  return hiddenNbrSet_;
-}
-
-
 bool 
 EMANE::Models::IEEE80211ABG::NeighborEntry::isOneHopNbr(EMANE::NEMId id) const
 {
    return oneHopNbrSet_.find(id) != oneHopNbrSet_.end();
 }
-
-
-bool 
-EMANE::Models::IEEE80211ABG::NeighborEntry::isCommonNbr(EMANE::NEMId id) const
-{
-   return commonNbrSet_.find(id) != commonNbrSet_.end();
-}
-
-
-bool 
-EMANE::Models::IEEE80211ABG::NeighborEntry::isHiddenNbr(EMANE::NEMId id) const
-{
-   return hiddenNbrSet_.find(id) != hiddenNbrSet_.end();
-}
@@ -145,22 +145,10 @@ namespace EMANE
 
           void setOneHopNeighbors(const NbrSet & nbrs);
 
-          void setHiddenNeighbors(const NbrSet & nbrs);
-
-          void setCommonNeighbors(const NbrSet & nbrs);
-
           const NbrSet & getOneHopNeighbors() const;
 
-          const NbrSet & getCommonNeighbors() const;
-
-          const NbrSet & getHiddenNeighbors() const;
-
           bool isOneHopNbr(EMANE::NEMId id) const;
 
-          bool isCommonNbr(EMANE::NEMId id) const;
-
-          bool isHiddenNbr(EMANE::NEMId id) const;
-
         private:
         /**
          *
@@ -207,10 +195,6 @@ namespace EMANE
 
           NbrSet oneHopNbrSet_;
 
-          NbrSet commonNbrSet_;
-
-          NbrSet hiddenNbrSet_;
-
           float fEstimatedNumCommonNeighbors_;
 
           float fHiddenChannelActivity_;
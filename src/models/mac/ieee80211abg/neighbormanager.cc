@@ -55,6 +55,7 @@ EMANE::Models::IEEE80211ABG::NeighborManager::NeighborManager(NEMId id,
   wmmManager_{id, pPlatformService, pMACLayer},
   nbrTimeOutMicroseconds_{},
   lastOneHopNbrListTxTime_{},
+  neighborStatistics_{id},
   RNDZeroToOne_{0.0f, 1.0f},
   lastResetTime_{}
 {
@@ -257,7 +258,7 @@ EMANE::Models::IEEE80211ABG::NeighborManager::getRandomRxPowerCommonNodesMilliWa
   const float fRandom{RNDZeroToOne_()};
 
   // get result using common info
-  const float fResult{getRandomRxPowerMilliWatts_i(src, fRandom, commonProbabilityMapMap_, commonNbrAvgRxPowerMwMap_)};
+  const float fResult{neighborStatistics_.getRandomRxPowerCommonNodesMilliWatts(src, fRandom)};
 
   LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
                          DEBUG_LEVEL,
@@ -281,10 +282,7 @@ EMANE::Models::IEEE80211ABG::NeighborManager::getRandomRxPowerHiddenNodesMilliWa
   const float fRandom{RNDZeroToOne_()};
 
   // get result using hidden info
-  const float fResult{getRandomRxPowerMilliWatts_i(src,
-                                                     fRandom,
-                                                     hiddenProbabilityMapMap_,
-                                                     hiddenNbrAvgRxPowerMwMap_)};
+  const float fResult{neighborStatistics_.getRandomRxPowerHiddenNodesMilliWatts(src, fRandom)};
 
   LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
                          DEBUG_LEVEL,
@@ -302,58 +300,6 @@ EMANE::Models::IEEE80211ABG::NeighborManager::getRandomRxPowerHiddenNodesMilliWa
 
 
 
-float
-EMANE::Models::IEEE80211ABG::NeighborManager::getRandomRxPowerMilliWatts_i(NEMId src,
-                                                                           float fRandom,
-                                                                           const ProbabilityPairMapMap & pmap,
-                                                                           const RxPowerMap & rmap) const
-{
-  // result
-  float fResult{};
-
-  // lookup probabilty pair map
-  auto pmmiter = pmap.find(src);
-
-  // entry found
-  if(pmmiter != pmap.end())
-   {
-     // for each common probabilty entry
-     for(auto & piter : pmmiter->second)
-      {
-        // search probability ranges
-        if((fRandom >= piter.second.first) && (fRandom <= piter.second.second))
-         {
-           // lookup common nbr
-           auto riter = rmap.find(piter.first);
-
-           // common nbr found
-           if(riter != rmap.end())
-            {
-               // set result
-               fResult = riter->second;
-            }
-
-            // done
-            break;
-         }
-      }
-   }
-
-  LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
-                         DEBUG_LEVEL,
-                         "MACI %03hu %s::%s: src %hu, random %5.4f, result %6.4f",
-                         id_,
-                         pzLayerName,
-                         __func__,
-                         src,
-                         fRandom,
-                         fResult);
-
-  return fResult;
-}
-
-
-
 EMANE::TimePoint
 EMANE::Models::IEEE80211ABG::NeighborManager::getLastOneHopNbrListTxTime() const
 {
@@ -559,6 +505,9 @@ EMANE::Models::IEEE80211ABG::NeighborManager::handleOneHopNeighborsEvent(const S
 
       // set one hop nbrs of this one hop nbr
       nbrEntry->second.setOneHopNeighbors(nbrSet);
+
+      // common nbrs of this one hop nbr must be recalculated
+      neighborStatistics_.invalidate(eventSource);
     }
    else
     {
@@ -640,9 +589,15 @@ EMANE::Models::IEEE80211ABG::NeighborManager::calculateBwUtilization_i(const Mic
   // reset counters
   resetCounters_i();
 
+  // number of one hop nbrs with utilization, may include us
+  size_t numActiveOneHopNeighbors{};
+
   // each one hop nbr
   for(auto & nbrEntry : oneHopNbrMap_)
     {
+       // add to the dense per interval nbr statistics
+       neighborStatistics_.addNeighbor(nbrEntry.first, nbrEntry.second);
+
        // get bandwidth utilization all DATA msg types
        Microseconds utilizationMicroseconds{nbrEntry.second.getUtilizationMicroseconds(MSG_TYPE_MASK_ALL_DATA)};
 
@@ -652,8 +607,8 @@ EMANE::Models::IEEE80211ABG::NeighborManager::calculateBwUtilization_i(const Mic
           // sum total one hop bandwidth utilization
           totalOneHopUtilizationMicroseconds_ += utilizationMicroseconds;
 
-          // store the one hop utilization
-          oneHopUtilizationMap_[nbrEntry.first] = utilizationMicroseconds;
+          // count the active one hop nbr
+          ++numActiveOneHopNeighbors;
 
           LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
                                  DEBUG_LEVEL,
@@ -701,7 +656,7 @@ EMANE::Models::IEEE80211ABG::NeighborManager::calculateBwUtilization_i(const Mic
                          id_,
                          pzLayerName,
                          __func__,
-                         oneHopUtilizationMap_.size(),
+                         numActiveOneHopNeighbors,
                          std::chrono::duration_cast<DoubleSeconds>(totalOneHopUtilizationMicroseconds_).count(),
                          totalOneHopNumPackets_,
                          fTotalRxPowerMilliWatts_,
@@ -790,7 +745,7 @@ EMANE::Models::IEEE80211ABG::NeighborManager::calculateBwUtilization_i(const Mic
   if(totalOneHopNumPackets_ > 0)
     {
       // set num active nbrs, may include us
-      numTotalActiveOneHopNeighbors_ = oneHopUtilizationMap_.size();
+      numTotalActiveOneHopNeighbors_ = numActiveOneHopNeighbors;
 
       // average bandwidth utilization per active one hop nbr
       averageUtilizationPerOneHopNbrMicroseconds_ =
@@ -805,214 +760,18 @@ EMANE::Models::IEEE80211ABG::NeighborManager::calculateBwUtilization_i(const Mic
           std::chrono::duration_cast<Microseconds>(DoubleSeconds{(((totalOneHopUtilizationMicroseconds_.count() -
              utilizationThisNEMMicroseconds_.count()) * (1.0f / totalOneHopNumPackets_)) / USEC_PER_SEC_F)});
 
-      float A1{}, A2{}, B1{};
+      // estimate the common and hidden activity of each one hop nbr
+      const float B1{neighborStatistics_.calculate(averageUtilizationPerOneHopNbrMicroseconds_, deltaTMicroseconds)};
 
-      // each one hop nbr
-      for(auto & nbrEntry1 : oneHopNbrMap_)
-        {
-          // check nbr activity all DATA msg types
-          if(nbrEntry1.second.getNumberOfPackets(MSG_TYPE_MASK_ALL_DATA) > 0)
-           {
-             // get A
-             A1 = getA_i(nbrEntry1.second.getUtilizationMicroseconds(MSG_TYPE_MASK_ALL_DATA),
-                            averageUtilizationPerOneHopNbrMicroseconds_);
-
-             B1 += powf(A1, 2.0f);
-
-             // check nbr is not us
-             if(nbrEntry1.first != id_)
-              {
-                float B2{};
-
-                // the sum of hidden bandwidth utilization
-                Microseconds hiddenUtilizationMicroseconds{};
-
-                // the sum of common rx power in mW
-                float fCommonRxPowerMilliWatts{};
-
-                // the sum of hidden rx power in mW
-                float fHiddenRxPowerMilliWatts{};
-
-                // the sum of common tx pkts
-                size_t numCommonPackets{};
-
-                // the sum of hidden tx pkts
-                size_t numHiddenPackets{};
-
-                // get the one hop nbrs of this nbr
-                const NbrSet nbrOneHopNbrSet = nbrEntry1.second.getOneHopNeighbors();
-
-#ifdef VERBOSE_LOGGIN
-                std::stringstream ss;
-
-                // list the nbrs of this nbr
-                for(auto & nbr : nbrOneHopNbrSet)
-                 {
-                   if(nbr == nbrOneHopNbrSet.begin())
-                    {
-                      ss << *nbr;
-                    }
-                   else
-                    {
-                      ss << ", " << *nbr;
-                    }
-                 }
-
-                LOGGER_VERBOSE_LOGGING(pPlatformService_,
-                                       DEBUG_LEVEL,
-                                       "MACI %03hu %s::%s: nbr %hu has %zu 1hop_nbrs: %s",
-                                       id_,
-                                       pzLayerName,
-                                       __func__,
-                                       nbrEntry1.first,
-                                       nbrOneHopNbrSet.size(),
-                                        ss.str().c_str());
-#endif
+      // set the overall sum of common and hidden pkts
+      sumCommonPackets_ = neighborStatistics_.getSumCommonPackets();
 
-                // nbrs hidden from this nbr
-                NbrSet hiddenNbrs;
-
-                // nbrs common with this nbr
-                NbrSet commonNbrs;
-
-                // each one hop nbr (again)
-                for(auto & nbrEntry2 : oneHopNbrMap_)
-                 {
-                    // a node can not be common or hidden from itself
-                    if(nbrEntry2.first == nbrEntry1.first)
-                      {
-                        continue;
-                      }
-
-                    // does the nbr's one hop nbr set include our nbr
-                    if(nbrOneHopNbrSet.find(nbrEntry2.first) != nbrOneHopNbrSet.end())
-                     {
-                        // get all DATA msg types
-                        const int typeMask{MSG_TYPE_MASK_ALL_DATA};
-
-                        A2 = getA_i(nbrEntry2.second.getUtilizationMicroseconds(typeMask),
-                                    averageUtilizationPerOneHopNbrMicroseconds_);
-
-                        B2 +=powf(A2, 2.0f);
-
-                        // get common rx power
-                        const float fRxPowermW{nbrEntry2.second.getRxPowerMilliWatts(typeMask)};
-
-                        // get the common number of packets
-                        const size_t numPackets{nbrEntry2.second.getNumberOfPackets(typeMask)};
-
-                        LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
-                                               DEBUG_LEVEL,
-                                               "MACI %03hu %s::%s: our nbr %hu is common with nbr %hu, pkts %zd, rxpwr %6.4f mW",
-                                                id_,
-                                                pzLayerName,
-                                                __func__,
-                                                nbrEntry2.first,
-                                                nbrEntry1.first,
-                                                numPackets,
-                                                fRxPowermW);
-
-                        // add to common nbrs
-                        commonNbrs.insert(nbrEntry2.first);
-
-                        // save common rx power avoid / by 0
-                        commonNbrAvgRxPowerMwMap_[nbrEntry2.first] = numPackets > 0 ? fRxPowermW / numPackets : 0;
-
-                        // sum the common rx power
-                        fCommonRxPowerMilliWatts += fRxPowermW;
-
-                        // sum the common number of packets
-                        numCommonPackets += numPackets;
-                     }
-                    // hidden from this nbr
-                    else
-                     {
-                        // get all unicast and broadcast msg types
-                        const int typeMask {MSG_TYPE_MASK_UNICAST | MSG_TYPE_MASK_BROADCAST};
-
-                        // sum the hidden bandwidth utilization
-                        hiddenUtilizationMicroseconds += nbrEntry2.second.getUtilizationMicroseconds(typeMask);
-
-                        // get hidden rx power
-                        const float fRxPowermW{nbrEntry2.second.getRxPowerMilliWatts(typeMask)};
-
-                        // get the hidden number of packets
-                        const size_t numPackets{nbrEntry2.second.getNumberOfPackets(typeMask)};
-
-                        LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
-                                               DEBUG_LEVEL,
-                                               "MACI %03hu %s::%s: nbr %hu is hidden from nbr %hu, pkts %zd, rxpwr %6.4f mW",
-                                               id_,
-                                               pzLayerName,
-                                               __func__,
-                                               nbrEntry2.first,
-                                               nbrEntry1.first,
-                                               numPackets,
-                                               fRxPowermW);
-
-                        // add to hidden nbrs
-                        hiddenNbrs.insert(nbrEntry2.first);
-
-                        // save hidden rx power avoid / by 0
-                        hiddenNbrAvgRxPowerMwMap_[nbrEntry2.first] = numPackets > 0 ? fRxPowermW / numPackets : 0;
-
-                        // sum the hidden rx power
-                        fHiddenRxPowerMilliWatts += fRxPowermW;
-
-                        // sum the hidden number of packets
-                        numHiddenPackets += numPackets;
-                     }
-                 }
-
-                 // set the common nbrs
-                 nbrEntry1.second.setCommonNeighbors(commonNbrs);
-
-                 // set the hidden nbrs
-                 nbrEntry1.second.setHiddenNeighbors(hiddenNbrs);
-
-                 // get the hidden channel activity
-                 const float H{getH_i(hiddenUtilizationMicroseconds, deltaTMicroseconds)};
-
-                 LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
-                                        DEBUG_LEVEL,
-                                        "MACI %03hu %s::%s: 1hop_nbr %hu, A1 = %5.4f, A2 = %5.4f, B1 = %5.4f, B2 = %5.4f, H = %5.4f",
-                                        id_,
-                                        pzLayerName,
-                                         __func__,
-                                        nbrEntry1.first,
-                                        A1, A2, B1, B2, H);
-
-                 // set the estimated number of common nbrs this nbr
-                 nbrEntry1.second.setEstimatedNumCommonNeighbors(round(B2));
-
-                 // set the avg common rx power this nbr, avoid / by 0
-                 nbrEntry1.second.setAverageCommonRxPowerMilliWatts(numCommonPackets > 0.0f ?
-                   fCommonRxPowerMilliWatts / numCommonPackets : 0.0f);
-
-                 // set the hidden channel activity this nbr
-                 nbrEntry1.second.setHiddenChannelActivity(H);
-
-                 // set the avg hidden rx power this nbr, avoid / by 0
-                 nbrEntry1.second.setAverageHiddenRxPowerMilliWatts(numHiddenPackets > 0.0f ?
-                   fHiddenRxPowerMilliWatts / numHiddenPackets : 0.0f);
-
-                 // set the overall sum of common pkts
-                 sumCommonPackets_ += numCommonPackets;
-
-                 // set the overall sum of hidden pkts
-                 sumHiddenPackets_ += numHiddenPackets;
-
-                 // set the overall pwr of common pkts
-                 fCommonRxPowerMilliWatts_ += fCommonRxPowerMilliWatts;
-
-                 // set the overall pwr of hidden pkts
-                 fHiddenRxPowerMilliWatts_ += fHiddenRxPowerMilliWatts;
-              }
-           }
-        }
+      sumHiddenPackets_ = neighborStatistics_.getSumHiddenPackets();
+
+      // set the overall pwr of common and hidden pkts
+      fCommonRxPowerMilliWatts_ = neighborStatistics_.getCommonRxPowerMilliWatts();
 
-      // set common and hidden probability
-      setCommonAndHiddenProbability_i();
+      fHiddenRxPowerMilliWatts_ = neighborStatistics_.getHiddenRxPowerMilliWatts();
 
       // calculate the total estimated number of one hop nbrs
       fEstimatedNumOneHopNeighbors_ = round(B1);
@@ -1073,7 +832,7 @@ EMANE::Models::IEEE80211ABG::NeighborManager::resetCounters_i()
 
   utilizationThisNEMMicroseconds_ = Microseconds::zero();
 
-  oneHopUtilizationMap_.clear();
+  neighborStatistics_.reset();
 
   twoHopUtilizationMap_.clear();
 }
@@ -1243,6 +1002,9 @@ EMANE::Models::IEEE80211ABG::NeighborManager::addOneHopNeighbor_i(NEMId src)
 
      pStatisticOneHopNbrTable_->addRow(src,{Any{src}});
 
+     // a returning nbr may have a different one hop nbr list
+     neighborStatistics_.invalidate(src);
+
      // set high water
      pMACLayer_->getStatistics().updateOneHopNbrHighWaterMark(oneHopNbrMap_.size());
 
@@ -1374,27 +1136,6 @@ EMANE::Models::IEEE80211ABG::NeighborManager::getC_i(const Microseconds & utiliz
 
 
 
-float
-EMANE::Models::IEEE80211ABG::NeighborManager::getH_i(const Microseconds & utilizationMicroseconds,
-                                                     const Microseconds & deltaTMicroseconds) const
-{
-  // internal call
-
-  const float H{getChannelActivity_i(utilizationMicroseconds, deltaTMicroseconds)};
-
-  // cap at 1.0
-  if(H > 1.0f)
-   {
-     return 1.0f;
-   }
-  else
-   {
-     return H;
-   }
-}
-
-
-
 float
 EMANE::Models::IEEE80211ABG::NeighborManager::getChannelActivity_i(const Microseconds & utilizationMicroseconds,
                                                                    const Microseconds & deltaTMicroseconds) const
@@ -1413,162 +1154,6 @@ EMANE::Models::IEEE80211ABG::NeighborManager::getChannelActivity_i(const Microse
 }
 
 
-void
-EMANE::Models::IEEE80211ABG::NeighborManager::setCommonAndHiddenProbability_i()
-{
-   // for each one hop utilization
-   for(auto & oneHopUtilization : oneHopUtilizationMap_)
-    {
-      // exclude ourself
-      if(oneHopUtilization.first != id_)
-       {
-          // remove local and src utilization from total one hop utilization
-          Microseconds adjustedUtililizationMicroseconds{
-                           totalOneHopUtilizationMicroseconds_ -
-                               utilizationThisNEMMicroseconds_ -
-                                 oneHopUtilization.second};
-
-          // check remaining utlzation
-          if(adjustedUtililizationMicroseconds > Microseconds::zero())
-           {
-             // lookup nbr
-             auto niter = oneHopNbrMap_.find(oneHopUtilization.first);
-
-             if(niter != oneHopNbrMap_.end())
-              {
-                // get common nbrs
-                const NbrSet commonNbrs = niter->second.getCommonNeighbors();
-
-                // get hidden nbrs
-                const NbrSet hiddenNbrs = niter->second.getHiddenNeighbors();
-
-                // get one hop utilzation
-                NbrUtilizationMap adjustedUtilzationMap = oneHopUtilizationMap_;
-
-                // remove local node from utilization
-                adjustedUtilzationMap.erase(id_);
-
-                // remove src from utilization
-                adjustedUtilzationMap.erase(oneHopUtilization.first);
-
-                // get and store common probability using adjusted one hop utilization for this src
-                commonProbabilityMapMap_[oneHopUtilization.first] = setProbability_i(oneHopUtilization.first,
-                                                                          adjustedUtilzationMap,
-                                                                          adjustedUtililizationMicroseconds,
-                                                                          commonNbrs,
-                                                                          "common");
-
-               // get and store hidden probability using adjusted one hop utilization for this src
-               hiddenProbabilityMapMap_[oneHopUtilization.first] = setProbability_i(oneHopUtilization.first,
-                                                                         adjustedUtilzationMap,
-                                                                         adjustedUtililizationMicroseconds,
-                                                                         hiddenNbrs,
-                                                                         "hidden");
-             }
-          }
-       }
-    }
-}
-
-
-
-EMANE::Models::IEEE80211ABG::NeighborManager::ProbabilityPairMap
-EMANE::Models::IEEE80211ABG::NeighborManager::setProbability_i(NEMId src __attribute__((unused)),
-                                                               const NbrUtilizationMap & map,
-                                                               const Microseconds & rUtilizationMicroseconds,
-                                                               const NbrSet & nbrSet,
-                                                               const char *str __attribute__((unused))) const
-{
-  ProbabilityPairMap probabilityMap;
-
-  NbrUtilizationMap adjustedUtilizationMap;
-
-  Microseconds utilizationMicroseconds{rUtilizationMicroseconds};
-
-  for(auto & utilization : map)
-   {
-      if(nbrSet.find(utilization.first) != nbrSet.end())
-       {
-         LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
-                                DEBUG_LEVEL,
-                                "MACI %03hu %s::%s_%s: src %hu, is %s w/r to nbr %hu",
-                                id_,
-                                pzLayerName,
-                                __func__,
-                                str,
-                                src,
-                                str,
-                                utilization.first);
-
-         // add entry
-         adjustedUtilizationMap[utilization.first] = utilization.second;
-       }
-      else
-       {
-         LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
-                                DEBUG_LEVEL,
-                                "MACI %03hu %s::%s_%s: src %hu, is not %s w/r to nbr %hu, ignore",
-                                id_,
-                                pzLayerName,
-                                __func__,
-                                str,
-                                src,
-                                str,
-                                utilization.first);
-
-         // subtract utilization
-         utilizationMicroseconds -= utilization.second;
-       }
-   }
-
-  // check remaining utilization
-  if(utilizationMicroseconds > Microseconds::zero())
-   {
-     // initial values
-     float p1{}, p2{};
-
-     size_t num{adjustedUtilizationMap.size()};
-
-     // for each utilization
-     for(NbrUtilizationMap::iterator iter = adjustedUtilizationMap.begin(); iter != adjustedUtilizationMap.end(); ++iter, --num)
-      {
-         // not last entry
-         if(num != 1)
-          {
-            // get ratio
-            p2 += getRatio(iter->second, utilizationMicroseconds);
-          }
-         // last entry
-         else
-          {
-            // set to 1
-            p2 = 1.0f;
-          }
-
-          LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
-                                 DEBUG_LEVEL,
-                                 "MACI %03hu %s::%s_%s: src %hu, nbr %hu, p1 %5.4f, p2 %5.4f",
-                                 id_,
-                                 pzLayerName,
-                                 __func__,
-                                 str,
-                                 src,
-                                 iter->first,
-                                 p1,
-                                 p2);
-
-          // insert range
-          probabilityMap[iter->first] = ProbabilityPair(p1, p2);
-
-          // bump range
-          p1 = p2;
-      }
-   }
-
-  return probabilityMap;
-}
-
-
 void
 EMANE::Models::IEEE80211ABG::NeighborManager::registerStatistics(StatisticRegistrar & statisticRegistrar)
 {
@@ -45,6 +45,7 @@
 #include "wmmmanager.h"
 #include "neighborentry.h"
 #include "neighbor2hopentry.h"
+#include "neighborstatistics.h"
 #include "onehopneighborsevent.h"
 
 #include <map>
@@ -149,14 +150,6 @@ namespace EMANE
 
           using  NbrUtilizationMap = std::map<NEMId, Microseconds>;
 
-          using ProbabilityPair = std::pair<float, float>;
-
-          using  ProbabilityPairMap = std::map<NEMId, ProbabilityPair>;
-
-          using  ProbabilityPairMapMap = std::map<NEMId, ProbabilityPairMap>;
-
-          using  RxPowerMap = std::map<NEMId, float>;
-
           NEMId id_;
 
           PlatformServiceProvider * pPlatformService_;
@@ -211,17 +204,9 @@ namespace EMANE
 
           TimePoint lastOneHopNbrListTxTime_;
 
-          NbrUtilizationMap oneHopUtilizationMap_;
-
           NbrUtilizationMap twoHopUtilizationMap_;
 
-          ProbabilityPairMapMap commonProbabilityMapMap_;
-
-          ProbabilityPairMapMap hiddenProbabilityMapMap_;
-
-          RxPowerMap commonNbrAvgRxPowerMwMap_;
-
-          RxPowerMap hiddenNbrAvgRxPowerMwMap_;
+          NeighborStatistics neighborStatistics_;
 
           WMMManager::UtilizationRatioVector utilizationRatioVector_;
 
@@ -252,19 +237,7 @@ namespace EMANE
 
           float getC_i(const Microseconds & utilizationMicroseconds, const Microseconds & deltaTMicroseconds) const;
 
-          float getH_i(const Microseconds & utilizationMicroseconds, const Microseconds & deltaTMicroseconds) const;
-
           float getChannelActivity_i(const Microseconds & utilizationMicroseconds, const Microseconds & deltaTMicroseconds) const;
-
-          void setCommonAndHiddenProbability_i();
-
-          ProbabilityPairMap setProbability_i(NEMId id, const NbrUtilizationMap & map, 
-                                               const Microseconds & utilizationMicroseconds, 
-                                               const NbrSet & nbrSet, const char * str) const;
-
-          float getRandomRxPowerMilliWatts_i(NEMId src, float R1, 
-                                                const ProbabilityPairMapMap & pmap, 
-                                                const RxPowerMap & rmap) const;
         };
      }
   }
@@ -0,0 +1,474 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "neighborstatistics.h"
+#include "utils.h"
+#include "msgtypes.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+  // channel activity capped at 1.0, 0 when the duration is 0
+  float getActivity(const EMANE::Microseconds & utilizationMicroseconds,
+                    const EMANE::Microseconds & durationMicroseconds)
+  {
+    if(durationMicroseconds == EMANE::Microseconds::zero())
+      {
+        return 0.0f;
+      }
+
+    const float fActivity{EMANE::Models::IEEE80211ABG::getRatio(utilizationMicroseconds,
+                                                                durationMicroseconds)};
+
+    return fActivity > 1.0f ? 1.0f : fActivity;
+  }
+
+  const std::uint8_t MSG_TYPE_MASK_HIDDEN{EMANE::Models::IEEE80211ABG::MSG_TYPE_MASK_UNICAST |
+                                          EMANE::Models::IEEE80211ABG::MSG_TYPE_MASK_BROADCAST};
+}
+
+
+EMANE::Models::IEEE80211ABG::NeighborStatistics::NeighborStatistics(NEMId id):
+  id_{id},
+  numSlots_{},
+  numBitmapSlots_{},
+  bLayoutChanged_{},
+  wordsPerSlot_{},
+  bCalculated_{},
+  totalUtilizationMicroseconds_{},
+  utilizationThisNEMMicroseconds_{},
+  sumCommonPackets_{},
+  sumHiddenPackets_{},
+  fCommonRxPowerMilliWatts_{},
+  fHiddenRxPowerMilliWatts_{}
+{}
+
+
+void
+EMANE::Models::IEEE80211ABG::NeighborStatistics::reset()
+{
+  // release the slot table entries, slot storage is kept for reuse
+  for(size_t i = 0; i < numSlots_; ++i)
+    {
+      slotIndexes_[slots_[i].id_] = -1;
+    }
+
+  numSlots_ = 0;
+
+  bCalculated_ = false;
+
+  totalUtilizationMicroseconds_ = Microseconds::zero();
+
+  utilizationThisNEMMicroseconds_ = Microseconds::zero();
+
+  sumCommonPackets_ = 0;
+
+  sumHiddenPackets_ = 0;
+
+  fCommonRxPowerMilliWatts_ = 0.0f;
+
+  fHiddenRxPowerMilliWatts_ = 0.0f;
+}
+
+
+void
+EMANE::Models::IEEE80211ABG::NeighborStatistics::addNeighbor(NEMId nbr, NeighborEntry & entry)
+{
+  if(nbr >= slotIndexes_.size())
+    {
+      slotIndexes_.resize(nbr + 1, -1);
+    }
+
+  if(numSlots_ == slots_.size())
+    {
+      slots_.emplace_back();
+
+      slotStates_.emplace_back();
+
+      bLayoutChanged_ = true;
+    }
+  else if(slots_[numSlots_].id_ != nbr)
+    {
+      // slot assignment differs from the previous interval
+      bLayoutChanged_ = true;
+    }
+
+  slotIndexes_[nbr] = numSlots_;
+
+  auto & slot = slots_[numSlots_];
+
+  auto & state = slotStates_[numSlots_];
+
+  ++numSlots_;
+
+  slot.id_ = nbr;
+  slot.fActivitySquared_ = 0.0f;
+  slot.fRxPowerMilliWatts_ = entry.getRxPowerMilliWatts(MSG_TYPE_MASK_ALL_DATA);
+  slot.fHiddenRxPowerMilliWatts_ = entry.getRxPowerMilliWatts(MSG_TYPE_MASK_HIDDEN);
+  slot.utilizationMicroseconds_ = entry.getUtilizationMicroseconds(MSG_TYPE_MASK_ALL_DATA);
+  slot.hiddenUtilizationMicroseconds_ = entry.getUtilizationMicroseconds(MSG_TYPE_MASK_HIDDEN);
+  slot.numPackets_ = entry.getNumberOfPackets(MSG_TYPE_MASK_ALL_DATA);
+  slot.numHiddenPackets_ = entry.getNumberOfPackets(MSG_TYPE_MASK_HIDDEN);
+
+  state.pEntry_ = &entry;
+  state.bCommonRanges_ = false;
+  state.bHiddenRanges_ = false;
+
+  totalUtilizationMicroseconds_ += slot.utilizationMicroseconds_;
+
+  if(nbr == id_)
+    {
+      utilizationThisNEMMicroseconds_ = slot.utilizationMicroseconds_;
+    }
+}
+
+
+void
+EMANE::Models::IEEE80211ABG::NeighborStatistics::invalidate(NEMId nbr)
+{
+  std::int32_t iSlot{getSlotIndex_i(nbr)};
+
+  if(iSlot >= 0)
+    {
+      slotStates_[iSlot].bCommonBitmap_ = false;
+    }
+}
+
+
+float
+EMANE::Models::IEEE80211ABG::NeighborStatistics::calculate(const Microseconds & averageUtilizationMicroseconds,
+                                                           const Microseconds & deltaTMicroseconds)
+{
+  // squared channel activity of each nbr, used by every common sum
+  for(size_t i = 0; i < numSlots_; ++i)
+    {
+      slots_[i].fActivitySquared_ =
+        powf(getActivity(slots_[i].utilizationMicroseconds_,averageUtilizationMicroseconds), 2.0f);
+    }
+
+  // slots were added, removed or reordered, rebuild all bitmaps
+  if(bLayoutChanged_ || numSlots_ != numBitmapSlots_)
+    {
+      numBitmapSlots_ = numSlots_;
+
+      wordsPerSlot_ = (numSlots_ + 63) / 64;
+
+      commonBitmap_.assign(numSlots_ * wordsPerSlot_, 0);
+
+      for(size_t i = 0; i < numSlots_; ++i)
+        {
+          slotStates_[i].bCommonBitmap_ = false;
+        }
+
+      bLayoutChanged_ = false;
+    }
+
+  float B1{};
+
+  for(size_t i = 0; i < numSlots_; ++i)
+    {
+      auto & slot = slots_[i];
+
+      auto & state = slotStates_[i];
+
+      // check nbr activity all DATA msg types
+      if(slot.numPackets_ == 0)
+        {
+          continue;
+        }
+
+      B1 += slot.fActivitySquared_;
+
+      // check nbr is not us
+      if(slot.id_ == id_)
+        {
+          continue;
+        }
+
+      auto * pBits = &commonBitmap_[i * wordsPerSlot_];
+
+      if(!state.bCommonBitmap_)
+        {
+          std::fill_n(pBits,wordsPerSlot_,0);
+
+          // our nbrs that are also one hop nbrs of this nbr
+          for(const auto & nbr : state.pEntry_->getOneHopNeighbors())
+            {
+              std::int32_t iOther{getSlotIndex_i(nbr)};
+
+              // a node can not be common or hidden from itself
+              if(iOther >= 0 && static_cast<size_t>(iOther) != i)
+                {
+                  pBits[iOther / 64] |= std::uint64_t{1} << (iOther % 64);
+                }
+            }
+
+          state.bCommonBitmap_ = true;
+        }
+
+      float B2{};
+
+      Microseconds hiddenUtilizationMicroseconds{};
+
+      float fCommonRxPowerMilliWatts{};
+
+      float fHiddenRxPowerMilliWatts{};
+
+      size_t numCommonPackets{};
+
+      size_t numHiddenPackets{};
+
+      for(size_t j = 0; j < numSlots_; ++j)
+        {
+          if(j == i)
+            {
+              continue;
+            }
+
+          const auto & other = slots_[j];
+
+          if(pBits[j / 64] & (std::uint64_t{1} << (j % 64)))
+            {
+              B2 += other.fActivitySquared_;
+
+              fCommonRxPowerMilliWatts += other.fRxPowerMilliWatts_;
+
+              numCommonPackets += other.numPackets_;
+            }
+          else
+            {
+              hiddenUtilizationMicroseconds += other.hiddenUtilizationMicroseconds_;
+
+              fHiddenRxPowerMilliWatts += other.fHiddenRxPowerMilliWatts_;
+
+              numHiddenPackets += other.numHiddenPackets_;
+            }
+        }
+
+      // set the estimated number of common nbrs this nbr
+      state.pEntry_->setEstimatedNumCommonNeighbors(round(B2));
+
+      // set the avg common rx power this nbr, avoid / by 0
+      state.pEntry_->setAverageCommonRxPowerMilliWatts(numCommonPackets > 0 ?
+                                                       fCommonRxPowerMilliWatts / numCommonPackets : 0.0f);
+
+      // set the hidden channel activity this nbr
+      state.pEntry_->setHiddenChannelActivity(getActivity(hiddenUtilizationMicroseconds,deltaTMicroseconds));
+
+      // set the avg hidden rx power this nbr, avoid / by 0
+      state.pEntry_->setAverageHiddenRxPowerMilliWatts(numHiddenPackets > 0 ?
+                                                       fHiddenRxPowerMilliWatts / numHiddenPackets : 0.0f);
+
+      sumCommonPackets_ += numCommonPackets;
+
+      sumHiddenPackets_ += numHiddenPackets;
+
+      fCommonRxPowerMilliWatts_ += fCommonRxPowerMilliWatts;
+
+      fHiddenRxPowerMilliWatts_ += fHiddenRxPowerMilliWatts;
+    }
+
+  // entries may be removed before the next interval
+  for(size_t i = 0; i < numSlots_; ++i)
+    {
+      slotStates_[i].pEntry_ = nullptr;
+    }
+
+  bCalculated_ = true;
+
+  return B1;
+}
+
+
+size_t
+EMANE::Models::IEEE80211ABG::NeighborStatistics::getSumCommonPackets() const
+{
+  return sumCommonPackets_;
+}
+
+
+size_t
+EMANE::Models::IEEE80211ABG::NeighborStatistics::getSumHiddenPackets() const
+{
+  return sumHiddenPackets_;
+}
+
+
+float
+EMANE::Models::IEEE80211ABG::NeighborStatistics::getCommonRxPowerMilliWatts() const
+{
+  return fCommonRxPowerMilliWatts_;
+}
+
+
+float
+EMANE::Models::IEEE80211ABG::NeighborStatistics::getHiddenRxPowerMilliWatts() const
+{
+  return fHiddenRxPowerMilliWatts_;
+}
+
+
+float
+EMANE::Models::IEEE80211ABG::NeighborStatistics::getRandomRxPowerCommonNodesMilliWatts(NEMId src,
+                                                                                     float fRandom)
+{
+  return getRandomRxPowerMilliWatts_i(src,fRandom,true);
+}
+
+
+float
+EMANE::Models::IEEE80211ABG::NeighborStatistics::getRandomRxPowerHiddenNodesMilliWatts(NEMId src,
+                                                                                     float fRandom)
+{
+  return getRandomRxPowerMilliWatts_i(src,fRandom,false);
+}
+
+
+std::int32_t
+EMANE::Models::IEEE80211ABG::NeighborStatistics::getSlotIndex_i(NEMId id) const
+{
+  return id < slotIndexes_.size() ? slotIndexes_[id] : -1;
+}
+
+
+bool
+EMANE::Models::IEEE80211ABG::NeighborStatistics::isCommon_i(size_t slot, size_t other) const
+{
+  return commonBitmap_[slot * wordsPerSlot_ + other / 64] & (std::uint64_t{1} << (other % 64));
+}
+
+
+float
+EMANE::Models::IEEE80211ABG::NeighborStatistics::getRandomRxPowerMilliWatts_i(NEMId src,
+                                                                            float fRandom,
+                                                                            bool bCommon)
+{
+  std::int32_t iSlot{getSlotIndex_i(src)};
+
+  if(!bCalculated_ || iSlot < 0)
+    {
+      return 0.0f;
+    }
+
+  const auto & ranges = getProbabilityRanges_i(iSlot,bCommon);
+
+  // first range with an upper bound at or above the probability
+  auto iter = std::lower_bound(ranges.begin(),
+                               ranges.end(),
+                               fRandom,
+                               [](const ProbabilityRanges::value_type & range, float f)
+                               {
+                                 return range.first < f;
+                               });
+
+  return iter != ranges.end() ? iter->second : 0.0f;
+}
+
+
+const EMANE::Models::IEEE80211ABG::NeighborStatistics::ProbabilityRanges &
+EMANE::Models::IEEE80211ABG::NeighborStatistics::getProbabilityRanges_i(size_t i, bool bCommon)
+{
+  const auto & slot = slots_[i];
+
+  auto & state = slotStates_[i];
+
+  auto & ranges = bCommon ? state.commonRanges_ : state.hiddenRanges_;
+
+  bool & bValid = bCommon ? state.bCommonRanges_ : state.bHiddenRanges_;
+
+  if(bValid)
+    {
+      return ranges;
+    }
+
+  bValid = true;
+
+  ranges.clear();
+
+  // exclude ourself, a src without utilization or when the src and
+  // this nem are the only utilization
+  if(slot.id_ == id_ ||
+     slot.utilizationMicroseconds_ == Microseconds::zero() ||
+     totalUtilizationMicroseconds_ - utilizationThisNEMMicroseconds_ - slot.utilizationMicroseconds_ <= Microseconds::zero() ||
+     slot.numPackets_ == 0)
+    {
+      return ranges;
+    }
+
+  auto isCandidate = [this,i,bCommon](size_t j)
+                     {
+                       return j != i &&
+                         slots_[j].id_ != id_ &&
+                         slots_[j].utilizationMicroseconds_ > Microseconds::zero() &&
+                         isCommon_i(i,j) == bCommon;
+                     };
+
+  Microseconds utilizationMicroseconds{};
+
+  size_t numCandidates{};
+
+  for(size_t j = 0; j < numSlots_; ++j)
+    {
+      if(isCandidate(j))
+        {
+          utilizationMicroseconds += slots_[j].utilizationMicroseconds_;
+          ++numCandidates;
+        }
+    }
+
+  if(utilizationMicroseconds > Microseconds::zero())
+    {
+      float p2{};
+
+      for(size_t j = 0; j < numSlots_; ++j)
+        {
+          if(isCandidate(j))
+            {
+              const auto & other = slots_[j];
+
+              // last entry is set to 1
+              p2 = --numCandidates ? p2 + getRatio(other.utilizationMicroseconds_,utilizationMicroseconds) : 1.0f;
+
+              const float fRxPowerMilliWatts{bCommon ? other.fRxPowerMilliWatts_ : other.fHiddenRxPowerMilliWatts_};
+
+              const size_t numPackets{bCommon ? other.numPackets_ : other.numHiddenPackets_};
+
+              // avg rx power avoid / by 0
+              ranges.emplace_back(p2, numPackets > 0 ? fRxPowerMilliWatts / numPackets : 0.0f);
+            }
+        }
+    }
+
+  return ranges;
+}
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANEMODELSIEEE80211ABGNEIGHBORSTATISTICS_HEADER_
+#define EMANEMODELSIEEE80211ABGNEIGHBORSTATISTICS_HEADER_
+
+#include "emane/types.h"
+
+#include "neighborentry.h"
+
+#include <vector>
+#include <cstdint>
+
+namespace EMANE
+ {
+  namespace Models
+   {
+     namespace IEEE80211ABG
+       {
+        /**
+         *
+         * @class  NeighborStatistics
+         *
+         * @brief Estimates the common and hidden channel activity of
+         * each one hop nbr from the activity of the last interval
+         *
+         * One hop nbrs are held in dense slots, in the order they are
+         * added, and located using a NEM id indexed slot table. The
+         * common nbrs of each one hop nbr are stored as a bitmap over
+         * the slots so the per nbr sums are a single pass over
+         * contiguous storage. A bitmap is only rebuilt when the one
+         * hop nbrs change. The common and hidden rx power probability
+         * ranges of a src are only built the first time they are
+         * requested during an interval.
+         *
+         */
+        class NeighborStatistics
+        {
+        public:
+         /**
+          *
+          * constructor
+          *
+          * @param id this nem id
+          *
+          */
+          explicit NeighborStatistics(NEMId id);
+
+         /**
+          *
+          * removes all nbrs in preparation for a new interval
+          *
+          */
+          void reset();
+
+         /**
+          *
+          * adds a one hop nbr using the stored utilization of its
+          * entry. The entry must remain valid until calculate()
+          * returns.
+          *
+          * @param nbr   the nbr id
+          * @param entry the nbr entry
+          *
+          */
+          void addNeighbor(NEMId nbr, NeighborEntry & entry);
+
+         /**
+          *
+          * calculates and sets the estimated number of common nbrs,
+          * hidden channel activity and average common and hidden rx
+          * power of each active one hop nbr
+          *
+          * @param averageUtilizationMicroseconds the average utilization per active one hop nbr
+          * @param deltaTMicroseconds             the interval duration
+          *
+          * @return the sum of the squared channel activity of all active one hop nbrs
+          *
+          */
+          float calculate(const Microseconds & averageUtilizationMicroseconds,
+                          const Microseconds & deltaTMicroseconds);
+
+          size_t getSumCommonPackets() const;
+
+          size_t getSumHiddenPackets() const;
+
+          float getCommonRxPowerMilliWatts() const;
+
+          float getHiddenRxPowerMilliWatts() const;
+
+         /**
+          *
+          * gets the average rx power of a common nbr of a src selected
+          * using a random probability weighted by nbr utilization
+          *
+          * @param src     the src nem
+          * @param fRandom random probability [0,1]
+          *
+          * @return the rx power in milliwatts or 0 if there are no
+          * common nbrs with utilization
+          *
+          */
+          float getRandomRxPowerCommonNodesMilliWatts(NEMId src, float fRandom);
+
+         /**
+          *
+          * gets the average rx power of a hidden nbr of a src selected
+          * using a random probability weighted by nbr utilization
+          *
+          * @param src     the src nem
+          * @param fRandom random probability [0,1]
+          *
+          * @return the rx power in milliwatts or 0 if there are no
+          * hidden nbrs with utilization
+          *
+          */
+          float getRandomRxPowerHiddenNodesMilliWatts(NEMId src, float fRandom);
+
+         /**
+          *
+          * indicates the one hop nbrs of a nbr have changed. The
+          * common nbr bitmap of a nbr is otherwise kept across
+          * intervals while the set of one hop nbrs is unchanged.
+          *
+          * @param nbr the nbr id
+          *
+          */
+          void invalidate(NEMId nbr);
+
+        private:
+          // <upper probability bound, average rx power in mW>
+          using ProbabilityRanges = std::vector<std::pair<float, float>>;
+
+          // per interval activity, read for every nbr pair
+          struct Slot
+            {
+              NEMId id_;
+              float fActivitySquared_;
+              float fRxPowerMilliWatts_;
+              float fHiddenRxPowerMilliWatts_;
+              Microseconds utilizationMicroseconds_;
+              Microseconds hiddenUtilizationMicroseconds_;
+              size_t numPackets_;
+              size_t numHiddenPackets_;
+            };
+
+          struct SlotState
+            {
+              NeighborEntry * pEntry_;
+              bool bCommonBitmap_;
+              bool bCommonRanges_;
+              bool bHiddenRanges_;
+              ProbabilityRanges commonRanges_;
+              ProbabilityRanges hiddenRanges_;
+            };
+
+          using Slots = std::vector<Slot>;
+
+          using SlotStates = std::vector<SlotState>;
+
+          using SlotIndexes = std::vector<std::int32_t>;
+
+          using Bitmap = std::vector<std::uint64_t>;
+
+          NEMId id_;
+
+          Slots slots_;
+
+          SlotStates slotStates_;
+
+          size_t numSlots_;
+
+          size_t numBitmapSlots_;
+
+          bool bLayoutChanged_;
+
+          SlotIndexes slotIndexes_;
+
+          Bitmap commonBitmap_;
+
+          size_t wordsPerSlot_;
+
+          bool bCalculated_;
+
+          Microseconds totalUtilizationMicroseconds_;
+
+          Microseconds utilizationThisNEMMicroseconds_;
+
+          size_t sumCommonPackets_;
+
+          size_t sumHiddenPackets_;
+
+          float fCommonRxPowerMilliWatts_;
+
+          float fHiddenRxPowerMilliWatts_;
+
+          std::int32_t getSlotIndex_i(NEMId id) const;
+
+          bool isCommon_i(size_t slot, size_t other) const;
+
+          const ProbabilityRanges & getProbabilityRanges_i(size_t slot, bool bCommon);
+
+          float getRandomRxPowerMilliWatts_i(NEMId src, float fRandom, bool bCommon);
+        };
+     }
+  }
+}
+#endif  //EMANEMODELSIEEE80211ABGNEIGHBORSTATISTICS_HEADER_
@@ -36,15 +36,12 @@
 #include "pcrmanager.h"
 
 #include <libxml/parser.h>
-#include <math.h>
 
 #include <sstream>
 
 
 namespace
 {
-  const int PRECISION_FACTOR{100};
-
   inline xmlChar * toXMLChar(const char * p)
    {
       return reinterpret_cast<xmlChar *>(const_cast<char *>(p));
@@ -54,8 +51,7 @@ namespace
 
 EMANE::Models::IEEE80211ABG::PCRManager::PCRManager(EMANE::NEMId id, EMANE::PlatformServiceProvider * pPlatformService):
 id_{id}, 
-pPlatformService_{pPlatformService}, 
-tablePacketSize_{}
+pPlatformService_{pPlatformService}
 { }
 
 
@@ -117,8 +113,6 @@ EMANE::Models::IEEE80211ABG::PCRManager::closeDoc(xmlParserCtxtPtr * ppContext,
       xmlFreeDoc(*ppDocument);
       *ppDocument = NULL;
     }
-
-  xmlCleanupParser();
 }
 
 
@@ -126,10 +120,6 @@ EMANE::Models::IEEE80211ABG::PCRManager::closeDoc(xmlParserCtxtPtr * ppContext,
 void
 EMANE::Models::IEEE80211ABG::PCRManager::load(const std::string & uri)
 {
-  xmlDoc * doc{};
-  xmlNode * root{};
-  xmlParserCtxtPtr pContext{};
-
   if(uri.empty())
     {
       std::stringstream excString;
@@ -138,21 +128,40 @@ EMANE::Models::IEEE80211ABG::PCRManager::load(const std::string & uri)
       throw EMANE::ConfigurationException(excString.str());
     }
 
+  pCurveTable_ = Utils::loadPCRCurveTable("ieee80211abg-pcr",
+                                          uri,
+                                          [&uri]()
+                                          {
+                                            return parse(uri);
+                                          });
+}
+
+
+
+EMANE::Utils::PCRCurveTable
+EMANE::Models::IEEE80211ABG::PCRManager::parse(const std::string & uri)
+{
+  xmlDoc * doc{};
+  xmlNode * root{};
+  xmlParserCtxtPtr pContext{};
+
   // open doc
   openDoc(uri, &pContext, &doc, &root);
 
   // root
   xmlNodePtr cur {root};
 
-  // clear pcr entries
-  pcrPorMap_.clear();
+  // pcr entries
+  Utils::PCRCurveTable::Curves curves{};
+
+  size_t tablePacketSize{};
 
   // get table
   while(cur)
     {
       if((!xmlStrcmp(cur->name, toXMLChar("pcr"))))
         {
-          getTable(cur->xmlChildrenNode, pcrPorMap_);
+          getTable(cur->xmlChildrenNode, curves, tablePacketSize);
         }
 
       cur = cur->next;
@@ -162,9 +171,9 @@ EMANE::Models::IEEE80211ABG::PCRManager::load(const std::string & uri)
   closeDoc(&pContext, &doc);
 
   // need at least 1 point
-  for(auto & iter : pcrPorMap_)
+  for(auto & iter : curves)
     {
-      if(iter.second.pcr_.size() < 1)
+      if(iter.second.size() < 1)
         {
           std::stringstream excString;
           excString << "IEEE80211ABG::PCRManager::load: need at least 1 point to define a pcr curve " << std::ends;
@@ -172,24 +181,26 @@ EMANE::Models::IEEE80211ABG::PCRManager::load(const std::string & uri)
         }
     }
 
-  // fill in points
-  interpolate();
+  // compile curves, filling in points
+  return {curves, tablePacketSize};
 }
 
 
 
 void
-EMANE::Models::IEEE80211ABG::PCRManager::getTable(xmlNodePtr cur, PCRPORMap & map)
+EMANE::Models::IEEE80211ABG::PCRManager::getTable(xmlNodePtr cur,
+                                                  Utils::PCRCurveTable::Curves & curves,
+                                                  size_t & tablePacketSize)
 {
   while(cur)
     {
       if((!xmlStrcmp(cur->name, toXMLChar("table"))))
         {
           // save table packet size
-          tablePacketSize_ = Utils::ParameterConvert(getAttribute(cur, toXMLChar("pktsize"))).toUINT32();
+          tablePacketSize = Utils::ParameterConvert(getAttribute(cur, toXMLChar("pktsize"))).toUINT32();
 
           // get each data rate
-          getDataRate(cur->xmlChildrenNode, map);
+          getDataRate(cur->xmlChildrenNode, curves);
         }
 
       cur = cur->next;
@@ -198,7 +209,7 @@ EMANE::Models::IEEE80211ABG::PCRManager::getTable(xmlNodePtr cur, PCRPORMap & ma
 
 
 void
-EMANE::Models::IEEE80211ABG::PCRManager::getDataRate(xmlNodePtr cur, PCRPORMap & map)
+EMANE::Models::IEEE80211ABG::PCRManager::getDataRate(xmlNodePtr cur, Utils::PCRCurveTable::Curves & curves)
 {
   while(cur)
     {
@@ -207,18 +218,23 @@ EMANE::Models::IEEE80211ABG::PCRManager::getDataRate(xmlNodePtr cur, PCRPORMap &
           // get data rate index
           const std::uint16_t u16DataRateIndex{Utils::ParameterConvert(getAttribute(cur, toXMLChar("index"))).toUINT16()};
 
+          for(const auto & iter : curves)
+            {
+              if(iter.first == u16DataRateIndex)
+                {
+                  std::stringstream excString;
+                  excString << "IEEE80211ABG::PCRManager::getDataRate: duplicate datarate index value " << u16DataRateIndex << std::ends;
+                  throw EMANE::ConfigurationException(excString.str());
+                }
+            }
+
           // entry 
-          PCRPOR entry;
+          Utils::PCRCurve::Points points;
 
           // get pcr each row 
-          getRows(cur->xmlChildrenNode, entry.pcr_);
+          getRows(cur->xmlChildrenNode, points);
 
-          if(map.insert(std::make_pair(u16DataRateIndex, entry)).second == false)
-            {
-              std::stringstream excString;
-              excString << "IEEE80211ABG::PCRManager::getDataRate: duplicate datarate index value " << u16DataRateIndex << std::ends;
-              throw EMANE::ConfigurationException(excString.str());
-            }
+          curves.push_back({u16DataRateIndex, points});
         }
 
       cur = cur->next;
@@ -227,7 +243,7 @@ EMANE::Models::IEEE80211ABG::PCRManager::getDataRate(xmlNodePtr cur, PCRPORMap &
 
 
 void
-EMANE::Models::IEEE80211ABG::PCRManager::getRows(xmlNodePtr cur, PCREntryVector & vec)
+EMANE::Models::IEEE80211ABG::PCRManager::getRows(xmlNodePtr cur, Utils::PCRCurve::Points & points)
 {
   while(cur)
     {
@@ -240,15 +256,15 @@ EMANE::Models::IEEE80211ABG::PCRManager::getRows(xmlNodePtr cur, PCREntryVector
           const float
             fPOR{Utils::ParameterConvert(getAttribute(cur, toXMLChar("por"))).toFloat(0.0f, 100.0f) / 100.0f};
 
-          for(const auto & iter : vec)
+          for(const auto & iter : points)
             {
-              if(fSINR == iter.fSINR_)
+              if(fSINR == iter.first)
                 {
                   std::stringstream excString;
                   excString << "IEEE80211ABG::PCRManager::getRows: duplicate sinr value " << fSINR << std::ends;
                   throw EMANE::ConfigurationException(excString.str());
                 }
-              else if(fSINR < iter.fSINR_)
+              else if(fSINR < iter.first)
                 {
                   std::stringstream excString;
                   excString << "IEEE80211ABG::PCRManager::getRows: out of order sinr value, must be in increasing value " 
@@ -258,7 +274,7 @@ EMANE::Models::IEEE80211ABG::PCRManager::getRows(xmlNodePtr cur, PCREntryVector
             }
 
           // append entry 
-          vec.push_back(PCREntry(fSINR, fPOR));
+          points.push_back({fSINR, fPOR});
         }
 
       cur = cur->next;
@@ -266,144 +282,28 @@ EMANE::Models::IEEE80211ABG::PCRManager::getRows(xmlNodePtr cur, PCREntryVector
 }
 
 
-void
-EMANE::Models::IEEE80211ABG::PCRManager::interpolate()
-{
-  // for each datarate
-  for(auto & iter : pcrPorMap_)
-    {
-      // for each sinr/pcr entry
-      for(size_t i = 0; i < (iter.second.pcr_.size() - 1); ++i)
-        {
-          // x1
-          const int x1{static_cast<int>(iter.second.pcr_[i].fSINR_ * PRECISION_FACTOR)};
-
-          // y1
-          const float y1{iter.second.pcr_[i].fPOR_};
-
-          // x2
-          const int x2{static_cast<int>(iter.second.pcr_[i + 1].fSINR_ * PRECISION_FACTOR)};
-
-          // y2
-          const float y2{iter.second.pcr_[i + 1].fPOR_};
-
-          // slope(m)
-          const float slope{(y2 - y1) / (x2 - x1)};
-
-          // fill in between points
-          for(int dx = x1; dx < x2; ++dx)
-            {
-              // y = mx + b
-              const float por{(dx - x1) * slope + y1};
-
-              // save value to end of vector
-              iter.second.por_.push_back(por);
-            }
-        }
-
-      iter.second.por_.push_back(iter.second.pcr_[iter.second.pcr_.size() - 1].fPOR_);
-    }
-}
-
-
-
 
 float
 EMANE::Models::IEEE80211ABG::PCRManager::getPCR(float fSINR, size_t packetLen, std::uint16_t u16DataRateIndex)
 {
-  const auto iter = pcrPorMap_.find(u16DataRateIndex);
+  const auto pCurve = pCurveTable_->getCurve(u16DataRateIndex);
 
-  if(iter != pcrPorMap_.end())
+  if(pCurve)
     {
-      // check low end
-      if(fSINR < iter->second.pcr_.front().fSINR_)
-        {
-          LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
-                                 DEBUG_LEVEL,
-                                 "MACI %03hu PCRManager::%s: sinr %3.2f, for datarate index %hu, "
-                                 "is below the low limit sinr of %3.2f",
-                                 id_,
-                                 __func__,
-                                 fSINR, 
-                                 u16DataRateIndex,
-                                 iter->second.pcr_.front().fSINR_);
-
-          // full loss
-          return 0.0f;
-        }
-      // check high end
-      else if(fSINR > iter->second.pcr_.back().fSINR_)
-        {
-          LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
-                                 DEBUG_LEVEL,
-                                 "MACI %03hu PCRManager::%s: sinr %3.2f, for datarate index %hu, "
-                                 "is above the high limit sinr of %3.2f",
-                                 id_, 
-                                 __func__, 
-                                 fSINR, 
-                                 u16DataRateIndex,
-                                 iter->second.pcr_.back().fSINR_);
-          // no loss
-          return 1.0f;
-        }
-      // lookup
-      else
-        {
-          float fPOR{};
+      // direct por lookup, adjusted for packet length
+      const float fPOR{pCurveTable_->getPOR(*pCurve, fSINR, packetLen)};
 
-          // single point(front == back)
-          if(fSINR == iter->second.pcr_.front().fSINR_ && fSINR == iter->second.pcr_.back().fSINR_)
-            {
-              // get por
-              fPOR = iter->second.pcr_.front().fPOR_;
-            }
-          else
-            {
-              // sinr adjusted
-              const int sinrScaled{static_cast<int>(fSINR * PRECISION_FACTOR)};
-
-              // sinr offset from the front
-              const int sinrOffset{static_cast<int>(iter->second.pcr_.front().fSINR_ * PRECISION_FACTOR)};
-
-              // get the table index
-              int idx{sinrScaled - sinrOffset};
-
-              // cap max index, low end check covers min index
-              if(idx >= static_cast<int>(iter->second.por_.size()))
-               {
-                  idx = iter->second.por_.size() - 1;
-               }
-
-              // direct por lookup
-              fPOR = iter->second.por_[idx];
-
-              LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
-                                     DEBUG_LEVEL, 
-                                     "MACI %03hu PCRManager::%s: lookup por %3.2f at table index %d",
-                                     id_,
-                                     __func__,
-                                     fPOR, 
-                                     idx);
-            }
+      LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
+                             DEBUG_LEVEL,
+                             "MACI %03hu PCRManager::%s: sinr %3.2f, for datarate index %hu, por %3.2f",
+                             id_, 
+                             __func__, 
+                             fSINR, 
+                             u16DataRateIndex,
+                             fPOR);
 
-          // adjust por for packet length
-          if(tablePacketSize_ > 0)
-           {
-             fPOR = powf(fPOR, static_cast<float>(packetLen) / tablePacketSize_);
-           }
-
-          LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
-                                 DEBUG_LEVEL,
-                                 "MACI %03hu PCRManager::%s: sinr %3.2f, for datarate index %hu, por %3.2f",
-                                 id_, 
-                                 __func__, 
-                                 fSINR, 
-                                 u16DataRateIndex,
-                                 fPOR);
-
-          // return por
-          return fPOR;
-        }
+      // return por
+      return fPOR;
     }
   else
     {
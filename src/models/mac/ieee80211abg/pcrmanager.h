@@ -38,12 +38,11 @@
 #include "emane/types.h"
 #include "emane/configurationexception.h"
 #include "emane/platformserviceprovider.h"
+#include "emane/utils/pcrcurve.h"
 
 #include <libxml/parser.h>
 
 #include <string>
-#include <vector>
-#include <map>
 
 namespace EMANE
  {
@@ -57,79 +56,12 @@ namespace EMANE
        *
        * @brief provides access to the pcr curves
        *
+       * Curves are compiled into fixed-step interpolated arrays and
+       * shared by all instances loading the same file.
+       *
        */
         class PCRManager
         {
-        /**
-         *
-         * @struct PCREntry
-         *
-         * @brief proides a direct lookup mapping of packet completion to probability of reception
-         *
-         */
-          struct PCREntry
-          {
-            float fSINR_;
-            float fPOR_;
-
-          /**
-           *
-           * default constructor
-           *
-           */
-            PCREntry(): 
-             fSINR_{}, 
-             fPOR_{}
-             { } 
-
-          /**
-           *
-           * initialized constructor
-           *
-           * @param fSinr the singnal to noise ratio
-           * @param por  the probability of reception
-           *
-           */
-            PCREntry(float fSinr, float por):
-              fSINR_{fSinr}, 
-              fPOR_{por}
-            { }
-          }; 
-
-          /**
-           *
-           * @brief vector of PCREntry
-           *
-           */
-          typedef std::vector <PCREntry> PCREntryVector;
-
-          /**
-           *
-           * @brief vector of POR (probability of reception) values
-           *
-           */
-          typedef std::vector <float> PORVector;
-
-         /**
-          *
-          * @struct PCRPOR
-          *
-          * @brief proides a direct lookup mapping of packet completion to probability of reception over a range of entries
-          *
-          */
-          struct PCRPOR
-          {
-            PCREntryVector pcr_;
-            PORVector      por_;
-          };
-
-          /**
-           *
-           * @brief map of data rate index to PCRPOR
-           *
-           */
-          typedef std::map <std::uint16_t, PCRPOR> PCRPORMap;
-
         public:
           /**
            * initialized constructor
@@ -172,30 +104,30 @@ namespace EMANE
           float getPCR(float fSinr, size_t size, std::uint16_t DataRateIndex);
 
         private:
-          void openDoc(const std::string & uri, xmlParserCtxtPtr * ppContext,
-                     xmlDoc ** ppDocument, xmlNode ** ppRoot);
+          static Utils::PCRCurveTable parse(const std::string & uri);
 
-          void closeDoc(xmlParserCtxtPtr * ppContext, xmlDoc ** ppDocument);
+          static void openDoc(const std::string & uri, xmlParserCtxtPtr * ppContext,
+                              xmlDoc ** ppDocument, xmlNode ** ppRoot);
 
-          std::string getAttribute(xmlNodePtr cur, const xmlChar * id);
+          static void closeDoc(xmlParserCtxtPtr * ppContext, xmlDoc ** ppDocument);
 
-          std::string getContent(xmlNodePtr cur);
+          static std::string getAttribute(xmlNodePtr cur, const xmlChar * id);
 
-          void getTable(xmlNodePtr cur, PCRManager::PCRPORMap & map);
+          static std::string getContent(xmlNodePtr cur);
 
-          void getDataRate(xmlNodePtr cur, PCRManager::PCRPORMap & map);
+          static void getTable(xmlNodePtr cur,
+                               Utils::PCRCurveTable::Curves & curves,
+                               size_t & tablePacketSize);
 
-          void getRows(xmlNodePtr cur, PCRManager::PCREntryVector & vec);
+          static void getDataRate(xmlNodePtr cur, Utils::PCRCurveTable::Curves & curves);
 
-          void interpolate();
+          static void getRows(xmlNodePtr cur, Utils::PCRCurve::Points & points);
 
           const NEMId id_;
 
           PlatformServiceProvider * pPlatformService_;
 
-          PCRPORMap pcrPorMap_;
-
-          size_t tablePacketSize_;
+          Utils::PCRCurveTablePtr pCurveTable_;
         };
       }
    }
@@ -96,7 +96,13 @@ EMANE::Models::RFPipe::MACLayer::MACLayer(NEMId id,
   downstreamQueueTimedEventId_{},
   bHasPendingDownstreamQueueEntry_{},
   pendingDownstreamQueueEntry_{},
-  currentEndOfTransmissionTime_{}
+  currentEndOfTransmissionTime_{},
+  eorScheduler_{pPlatformService_->timerService(),
+                pRadioService_->spectrumService(),
+                std::bind(&MACLayer::processEndOfReception,
+                          this,
+                          std::placeholders::_1,
+                          std::placeholders::_2)}
 {}
 
 EMANE::Models::RFPipe::MACLayer::~MACLayer(){}
@@ -607,6 +613,9 @@ EMANE::Models::RFPipe::MACLayer::stop()
 
   downstreamQueueTimedEventId_ = 0;
 
+  // discard receptions pending end of reception
+  eorScheduler_.clear();
+
   // check flow control enabled
   if(bFlowControlEnable_)
     {
@@ -829,198 +838,204 @@ EMANE::Models::RFPipe::MACLayer::processUpstreamPacket(const CommonMACHeader & c
 
           Microseconds span{pReceivePropertiesControlMessage->getSpan()};
 
-          auto callback =
-            std::bind([this,
-                       startOfReception,
-                       frequencySegments,
-                       span,
-                       beginTime](UpstreamPacket & pkt,
-                                  std::uint64_t u64SequenceNumber,
-                                  std::uint64_t u64DataRate)
-            {
-              const PacketInfo & pktInfo{pkt.getPacketInfo()};
-
-              const FrequencySegment & frequencySegment{*frequencySegments.begin()};
-
-              LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
-                                     DEBUG_LEVEL,
-                                     "MACI %03hu %s upstream EOR processing: src %hu, dst %hu,"
-                                     " len %zu, freq %ju, offset %ju, duration %ju, mac sequence %ju",
-                                     id_,
-                                     pzLayerName,
-                                     pktInfo.getSource(),
-                                     pktInfo.getDestination(),
-                                     pkt.length(),
-                                     frequencySegment.getFrequencyHz(),
-                                     frequencySegment.getOffset().count(),
-                                     frequencySegment.getDuration().count(),
-                                     u64SequenceNumber);
-
-
-              double dSINR{};
-              double dNoiseFloordB{};
-              double dReceiverSensitivitymW{};
-
-              try
-                {
-                  /** [spectrumservice-request-snibbet] */
-                  // get the spectrum info for the entire span, where a span
-                  // is the total time between the start of the signal of the
-                  // earliest segment and the end of the signal of the latest
-                  // segment. This is not necessarily the signal duration.
-                  auto window = pRadioService_->spectrumService().request(frequencySegment.getFrequencyHz(),
-                                                                          span,
-                                                                          startOfReception);
-
-                  // since we only have a single segment the span will equal the segment duration.
-                  // For simple noise processing we will just pull out the max noise segment, we can
-                  // use the maxBinNoiseFloor utility function for this. More elaborate noise window analysis
-                  // will require a more complex algorithm, although you should get a lot of mileage out of
-                  // this utility function.
-                  bool bSignalInNoise{};
-
-                  std::tie(dNoiseFloordB,bSignalInNoise) =
-                    Utils::maxBinNoiseFloor(window,frequencySegment.getRxPowerdBm());
-
-                  dSINR = frequencySegment.getRxPowerdBm() - dNoiseFloordB;
-
-                  dReceiverSensitivitymW = std::get<3>(window);
-
-                  /** [spectrumservice-request-snibbet] */
-
-                  LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
-                                         DEBUG_LEVEL,
-                                         "MACI %03hu %s upstream EOR processing: src %hu, dst %hu, max noise %f, signal in noise %s, SINR %f",
-                                         id_,
-                                         pzLayerName,
-                                         pktInfo.getSource(),
-                                         pktInfo.getDestination(),
-                                         dNoiseFloordB,
-                                         bSignalInNoise ? "yes" : "no",
-                                         dSINR);
-                }
-              catch(SpectrumServiceException & exp)
-                {
-                  LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
-                                         ERROR_LEVEL,
-                                         "MACI %03hu %s upstream EOR processing: src %hu, dst %hu, sor %ju, span %ju spectrum service request error: %s",
-                                         id_,
-                                         pzLayerName,
-                                         pktInfo.getSource(),
-                                         pktInfo.getDestination(),
-                                         std::chrono::duration_cast<Microseconds>(startOfReception.time_since_epoch()).count(),
-                                         span.count(),
-                                         exp.what());
-
-                  commonLayerStatistics_.processOutbound(pkt,
-                                                         std::chrono::duration_cast<Microseconds>(Clock::now() - beginTime),
-                                                         DROP_CODE_BAD_SPECTRUM_QUERY);
-                  // drop
-                  return;
-                }
+          const FrequencySegment & frequencySegment{*frequencySegments.begin()};
 
-              const Microseconds & durationMicroseconds{frequencySegment.getDuration()};
+          auto eor = startOfReception + frequencySegment.getDuration();
 
-              // check sinr
-              if(!checkPOR(dSINR, pkt.length()))
-                {
-                  LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
-                                         DEBUG_LEVEL,
-                                         "MACI %03hu %s upstream EOR processing: src %hu, dst %hu, "
-                                         "rxpwr %3.2f dBm, drop",
-                                         id_,
-                                         pzLayerName,
-                                         pktInfo.getSource(),
-                                         pktInfo.getDestination(),
-                                         frequencySegment.getRxPowerdBm());
-
-                  commonLayerStatistics_.processOutbound(pkt,
-                                                         std::chrono::duration_cast<Microseconds>(Clock::now() - beginTime),
-                                                         DROP_CODE_SINR);
-
-                  // drop
-                  return;
-                }
+          // wait for end of reception to complete processing
+          eorScheduler_.schedule(eor,
+                                 {frequencySegment.getFrequencyHz(),span,startOfReception},
+                                 {std::move(pkt),
+                                  startOfReception,
+                                  frequencySegment,
+                                  span,
+                                  beginTime,
+                                  commonMACHeader.getSequenceNumber(),
+                                  rfpipeMACHeader.getDataRate()});
+        }
+    }
+}
 
-              // update neighbor metrics
-              neighborMetricManager_.updateNeighborRxMetric(pktInfo.getSource(),    // nbr (src)
-                                                            u64SequenceNumber,      // sequence number
-                                                            pktInfo.getUUID(),
-                                                            dSINR,                  // sinr in dBm
-                                                            dNoiseFloordB,          // noise floor in dB
-                                                            startOfReception,       // rx time
-                                                            durationMicroseconds,   // duration
-                                                            u64DataRate);           // data rate bps
-              // update rf signal table
-              rfSignalTable_.update(pktInfo.getSource(),               // src nem
-                                    0,                                 // antenna id always 0 for rf pipe
-                                    frequencySegment.getFrequencyHz(), // segment frequency
-                                    frequencySegment.getRxPowerdBm(),  // rx power dBm
-                                    dSINR,                             // SINR
-                                    dNoiseFloordB,                     // noise floor dB
-                                    Utils::MILLIWATT_TO_DB(dReceiverSensitivitymW)); // receiver sensitivity dB
-
-
-              // check promiscuous mode, destination is this nem or to all nem's
-              if(bPromiscuousMode_ ||
-                 (pktInfo.getDestination() == id_) ||
-                 (pktInfo.getDestination() == NEM_BROADCAST_MAC_ADDRESS))
-                {
-                  LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
-                                         DEBUG_LEVEL,
-                                         "MACI %03hu %s upstream EOR processing: src %hu, dst %hu, forward upstream",
-                                         id_,
-                                         pzLayerName,
-                                         pktInfo.getSource(),
-                                         pktInfo.getDestination());
 
-                  commonLayerStatistics_.processOutbound(pkt,
-                                                         std::chrono::duration_cast<Microseconds>(Clock::now() - beginTime));
 
+void
+EMANE::Models::RFPipe::MACLayer::processEndOfReception(Reception & reception,
+                                                       const SpectrumWindowResult & result)
+{
+  auto & pkt = reception.pkt_;
 
-                  sendUpstreamPacket(pkt);
+  const auto & startOfReception = reception.startOfReception_;
 
-                  // done
-                  return;
-                }
-              else
-                {
-                  LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
-                                         DEBUG_LEVEL,
-                                         "MACI %03hu %s upstream EOR processing: not for this nem, "
-                                         "ignore pkt src %hu, dst %hu, drop",
-                                         id_,
-                                         pzLayerName,
-                                         pktInfo.getSource(),
-                                         pktInfo.getDestination());
-
-                  commonLayerStatistics_.processOutbound(pkt,
-                                                         std::chrono::duration_cast<Microseconds>(Clock::now() - beginTime),
-                                                         DROP_CODE_DST_MAC);
-
-                  // drop
-                  return;
-                }
-            },pkt,commonMACHeader.getSequenceNumber(),rfpipeMACHeader.getDataRate());
+  const auto & frequencySegment = reception.frequencySegment_;
 
+  const auto & beginTime = reception.beginTime_;
 
-          auto eor = startOfReception + frequencySegments.begin()->getDuration();
+  const PacketInfo & pktInfo{pkt.getPacketInfo()};
 
-          if(eor > beginTime)
-            {
-              // wait for end of reception to complete processing
-              pPlatformService_->timerService().schedule(callback,eor);
-            }
-          else
-            {
-              // we can process now, end of reception has past
-              callback();
-            }
+  LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
+                         DEBUG_LEVEL,
+                         "MACI %03hu %s upstream EOR processing: src %hu, dst %hu,"
+                         " len %zu, freq %ju, offset %ju, duration %ju, mac sequence %ju",
+                         id_,
+                         pzLayerName,
+                         pktInfo.getSource(),
+                         pktInfo.getDestination(),
+                         pkt.length(),
+                         frequencySegment.getFrequencyHz(),
+                         frequencySegment.getOffset().count(),
+                         frequencySegment.getDuration().count(),
+                         reception.u64SequenceNumber_);
+
+
+  double dSINR{};
+  double dNoiseFloordB{};
+  double dReceiverSensitivitymW{};
+
+  try
+    {
+      /** [spectrumservice-request-snibbet] */
+      // the spectrum info for the entire span, where a span is the
+      // total time between the start of the signal of the earliest
+      // segment and the end of the signal of the latest segment, is
+      // requested by the EOR scheduler. This is not necessarily the
+      // signal duration.
+      if(result.second)
+        {
+          std::rethrow_exception(result.second);
         }
+
+      const auto & window = result.first;
+
+      // since we only have a single segment the span will equal the segment duration.
+      // For simple noise processing we will just pull out the max noise segment, we can
+      // use the maxBinNoiseFloor utility function for this. More elaborate noise window analysis
+      // will require a more complex algorithm, although you should get a lot of mileage out of
+      // this utility function.
+      bool bSignalInNoise{};
+
+      std::tie(dNoiseFloordB,bSignalInNoise) =
+        Utils::maxBinNoiseFloor(window,frequencySegment.getRxPowerdBm());
+
+      dSINR = frequencySegment.getRxPowerdBm() - dNoiseFloordB;
+
+      dReceiverSensitivitymW = std::get<3>(window);
+
+      /** [spectrumservice-request-snibbet] */
+
+      LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
+                             DEBUG_LEVEL,
+                             "MACI %03hu %s upstream EOR processing: src %hu, dst %hu, max noise %f, signal in noise %s, SINR %f",
+                             id_,
+                             pzLayerName,
+                             pktInfo.getSource(),
+                             pktInfo.getDestination(),
+                             dNoiseFloordB,
+                             bSignalInNoise ? "yes" : "no",
+                             dSINR);
+    }
+  catch(SpectrumServiceException & exp)
+    {
+      LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
+                             ERROR_LEVEL,
+                             "MACI %03hu %s upstream EOR processing: src %hu, dst %hu, sor %ju, span %ju spectrum service request error: %s",
+                             id_,
+                             pzLayerName,
+                             pktInfo.getSource(),
+                             pktInfo.getDestination(),
+                             std::chrono::duration_cast<Microseconds>(startOfReception.time_since_epoch()).count(),
+                             reception.span_.count(),
+                             exp.what());
+
+      commonLayerStatistics_.processOutbound(pkt,
+                                             std::chrono::duration_cast<Microseconds>(Clock::now() - beginTime),
+                                             DROP_CODE_BAD_SPECTRUM_QUERY);
+      // drop
+      return;
     }
-}
 
+  const Microseconds & durationMicroseconds{frequencySegment.getDuration()};
+
+  // check sinr
+  if(!checkPOR(dSINR, pkt.length()))
+    {
+      LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
+                             DEBUG_LEVEL,
+                             "MACI %03hu %s upstream EOR processing: src %hu, dst %hu, "
+                             "rxpwr %3.2f dBm, drop",
+                             id_,
+                             pzLayerName,
+                             pktInfo.getSource(),
+                             pktInfo.getDestination(),
+                             frequencySegment.getRxPowerdBm());
+
+      commonLayerStatistics_.processOutbound(pkt,
+                                             std::chrono::duration_cast<Microseconds>(Clock::now() - beginTime),
+                                             DROP_CODE_SINR);
+
+      // drop
+      return;
+    }
 
+  // update neighbor metrics
+  neighborMetricManager_.updateNeighborRxMetric(pktInfo.getSource(),           // nbr (src)
+                                                reception.u64SequenceNumber_, // sequence number
+                                                pktInfo.getUUID(),
+                                                dSINR,                         // sinr in dBm
+                                                dNoiseFloordB,                 // noise floor in dB
+                                                startOfReception,              // rx time
+                                                durationMicroseconds,          // duration
+                                                reception.u64DataRate_);      // data rate bps
+  // update rf signal table
+  rfSignalTable_.update(pktInfo.getSource(),               // src nem
+                        0,                                 // antenna id always 0 for rf pipe
+                        frequencySegment.getFrequencyHz(), // segment frequency
+                        frequencySegment.getRxPowerdBm(),  // rx power dBm
+                        dSINR,                             // SINR
+                        dNoiseFloordB,                     // noise floor dB
+                        Utils::MILLIWATT_TO_DB(dReceiverSensitivitymW)); // receiver sensitivity dB
+
+
+  // check promiscuous mode, destination is this nem or to all nem's
+  if(bPromiscuousMode_ ||
+     (pktInfo.getDestination() == id_) ||
+     (pktInfo.getDestination() == NEM_BROADCAST_MAC_ADDRESS))
+    {
+      LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
+                             DEBUG_LEVEL,
+                             "MACI %03hu %s upstream EOR processing: src %hu, dst %hu, forward upstream",
+                             id_,
+                             pzLayerName,
+                             pktInfo.getSource(),
+                             pktInfo.getDestination());
+
+      commonLayerStatistics_.processOutbound(pkt,
+                                             std::chrono::duration_cast<Microseconds>(Clock::now() - beginTime));
+
+
+      sendUpstreamPacket(pkt);
+
+      // done
+      return;
+    }
+  else
+    {
+      LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
+                             DEBUG_LEVEL,
+                             "MACI %03hu %s upstream EOR processing: not for this nem, "
+                             "ignore pkt src %hu, dst %hu, drop",
+                             id_,
+                             pzLayerName,
+                             pktInfo.getSource(),
+                             pktInfo.getDestination());
+
+      commonLayerStatistics_.processOutbound(pkt,
+                                             std::chrono::duration_cast<Microseconds>(Clock::now() - beginTime),
+                                             DROP_CODE_DST_MAC);
+
+      // drop
+      return;
+    }
+}
 
 
 void
@@ -42,10 +42,13 @@
 #include "emane/queuemetricmanager.h"
 #include "emane/statisticnumeric.h"
 #include "emane/rfsignaltable.h"
+#include "emane/upstreampacket.h"
+#include "emane/frequencysegment.h"
 
 #include "emane/utils/runningaverage.h"
 #include "emane/utils/randomnumberdistribution.h"
 #include "emane/utils/commonlayerstatistics.h"
+#include "emane/utils/eorscheduler.h"
 
 #include "downstreamqueue.h"
 #include "pcrmanager.h"
@@ -183,6 +186,22 @@ namespace EMANE
 
         TimePoint currentEndOfTransmissionTime_;
 
+        struct Reception
+        {
+          UpstreamPacket pkt_;
+          TimePoint startOfReception_;
+          FrequencySegment frequencySegment_;
+          Microseconds span_;
+          TimePoint beginTime_;
+          std::uint64_t u64SequenceNumber_;
+          std::uint64_t u64DataRate_;
+        };
+
+        Utils::EORScheduler<Reception> eorScheduler_;
+
+        void processEndOfReception(Reception & reception,
+                                   const SpectrumWindowResult & result);
+
         void sendDownstreamQueueEntry();
 
         Microseconds getDurationMicroseconds(size_t lengthInBytes);
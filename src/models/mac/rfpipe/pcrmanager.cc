@@ -38,12 +38,8 @@
 
 #include <sstream>
 
-#include <cmath>
-
 namespace 
 {
-  const int PRECISION_FACTOR = 100;
-
   xmlChar* toXmlChar(const char * arg)
    {
      return reinterpret_cast<xmlChar*>(const_cast<char *>(arg));
@@ -54,7 +50,7 @@ namespace
 EMANE::Models::RFPipe::PCRManager::PCRManager(EMANE::NEMId id, EMANE::PlatformServiceProvider * pPlatformService) :
   id_{id},
   pPlatformService_{pPlatformService},
-  tablePacketSize_{}
+  pCurve_{}
 {}
 
 
@@ -111,18 +107,12 @@ EMANE::Models::RFPipe::PCRManager::Close(xmlParserCtxtPtr * ppContext, xmlDoc **
       xmlFreeDoc(*ppDocument);
       *ppDocument = NULL;
     }
-
-  xmlCleanupParser();
 }
 
 
 
 void EMANE::Models::RFPipe::PCRManager::load(const std::string & uri)
 {
-  xmlDoc  * doc{};
-  xmlNode * root{};
-  xmlParserCtxtPtr pContext{};
-
   if(uri.empty())
     {
       std::stringstream excString;
@@ -131,24 +121,42 @@ void EMANE::Models::RFPipe::PCRManager::load(const std::string & uri)
       throw StartException(excString.str());
     }
 
+  pCurveTable_ = Utils::loadPCRCurveTable("rfpipe-pcr",
+                                          uri,
+                                          [&uri]()
+                                          {
+                                            return parse(uri);
+                                          });
+
+  pCurve_ = pCurveTable_->getCurve(0);
+}
+
+
+
+EMANE::Utils::PCRCurveTable
+EMANE::Models::RFPipe::PCRManager::parse(const std::string & uri)
+{
+  xmlDoc  * doc{};
+  xmlNode * root{};
+  xmlParserCtxtPtr pContext{};
+
   // open doc
   Open(uri, &pContext, &doc, &root);
 
   // root
   xmlNodePtr cur{root};
 
-  // clear pcr entries
-  pcrEntryVector_.clear();
+  // pcr entries
+  Utils::PCRCurve::Points points{};
 
-  // clear por entries
-  porVector_.clear();
+  size_t tablePacketSize{};
 
   // get table
   while(cur) 
     {
       if((!xmlStrcmp(cur->name, toXmlChar("pcr")))) 
         {
-          getTable(cur->xmlChildrenNode);
+          getTable(cur->xmlChildrenNode, points, tablePacketSize);
         }
 
       cur = cur->next;
@@ -158,7 +166,7 @@ void EMANE::Models::RFPipe::PCRManager::load(const std::string & uri)
   Close(&pContext, &doc);
 
   // need at least 1 point
-  if(pcrEntryVector_.size() < 1)
+  if(points.size() < 1)
     {
       std::stringstream excString;
       excString << "EMANE::Models::RFPipe::PCRManager::getRows: need at least 1 point to define a pcr curve " << std::ends;
@@ -166,22 +174,22 @@ void EMANE::Models::RFPipe::PCRManager::load(const std::string & uri)
       throw StartException(excString.str());
     }
 
-  // fill in points
-  interpolate();
+  // compile the single curve, filling in points
+  return {{{0,points}}, tablePacketSize};
 }
 
 
 
 void
-EMANE::Models::RFPipe::PCRManager::getTable(xmlNodePtr cur)
+EMANE::Models::RFPipe::PCRManager::getTable(xmlNodePtr cur, Utils::PCRCurve::Points & points, size_t & tablePacketSize)
 {
   while(cur) 
     {
       if((!xmlStrcmp(cur->name, toXmlChar("table"))))
         {
-          tablePacketSize_ = Utils::ParameterConvert(getAttribute(cur, toXmlChar("pktsize"))).toUINT32();
+          tablePacketSize = Utils::ParameterConvert(getAttribute(cur, toXmlChar("pktsize"))).toUINT32();
 
-          getRows(cur->xmlChildrenNode);
+          getRows(cur->xmlChildrenNode, points);
         }
 
       cur = cur->next;
@@ -191,7 +199,7 @@ EMANE::Models::RFPipe::PCRManager::getTable(xmlNodePtr cur)
 
 
 void
-EMANE::Models::RFPipe::PCRManager::getRows(xmlNodePtr cur)
+EMANE::Models::RFPipe::PCRManager::getRows(xmlNodePtr cur, Utils::PCRCurve::Points & points)
 {
   while(cur) 
     {
@@ -203,15 +211,15 @@ EMANE::Models::RFPipe::PCRManager::getRows(xmlNodePtr cur)
           // get por value, convert from percent to fraction
           const float fPOR{Utils::ParameterConvert(getAttribute(cur, toXmlChar("por"))).toFloat(0.0f, 100.0f) / 100.0f};
 
-          for(const auto & entry : pcrEntryVector_)
+          for(const auto & entry : points)
             {
-              if(fSINR == entry.fSINR_)
+              if(fSINR == entry.first)
                 {
                   std::stringstream excString;
                   excString << "EMANE::Models::RFPipe::PCRManager::getRows: duplicate sinr value " << fSINR << std::ends;
                   throw StartException(excString.str());
                 }
-              else if(fSINR < entry.fSINR_)
+              else if(fSINR < entry.first)
                 {
                   std::stringstream excString;
                   excString << "EMANE::Models::RFPipe::PCRManager::getRows: out of order sinr value, must be in increasing value " << fSINR << std::ends;
@@ -219,7 +227,7 @@ EMANE::Models::RFPipe::PCRManager::getRows(xmlNodePtr cur)
                 }
             }
           
-          pcrEntryVector_.push_back(EMANE::Models::RFPipe::PCRManager::PCREntry(fSINR, fPOR));
+          points.push_back({fSINR, fPOR});
         }
  
       cur = cur->next;
@@ -227,107 +235,25 @@ EMANE::Models::RFPipe::PCRManager::getRows(xmlNodePtr cur)
 }
 
 
-void 
-EMANE::Models::RFPipe::PCRManager::interpolate()
-{
-  // for each sinr/pcr entry
-  for(size_t i = 0; i < (pcrEntryVector_.size() - 1); ++i)
-    {
-      // x1
-      const int x1{static_cast<int>(pcrEntryVector_[i].fSINR_ * PRECISION_FACTOR)};
-
-      // y1
-      const float y1{pcrEntryVector_[i].fPOR_};
-
-      // x2
-      const int x2{static_cast<int>(pcrEntryVector_[i + 1].fSINR_ * PRECISION_FACTOR)};
-
-      // y2
-      const float y2{pcrEntryVector_[i + 1].fPOR_};
-
-      // slope
-      const float slope{(y2 - y1) / (x2 - x1)};
-
-      // fill in between points
-      for(int dx = x1; dx < x2; ++dx)
-        {
-          // y = mx + b
-          porVector_.push_back((dx - x1) * slope + y1);
-        }
-    }
-
-  porVector_.push_back(pcrEntryVector_[pcrEntryVector_.size()-1].fPOR_);
-}
-
-
 float 
 EMANE::Models::RFPipe::PCRManager::getPCR(float fSINR, size_t packetLen)
 {
-  // check low end
-  if(fSINR < pcrEntryVector_.front().fSINR_)
-    {
-      // full loss
-      return 0.0f; 
-    }
-  // check high end
-  else if(fSINR > pcrEntryVector_.back().fSINR_)
-    {
-      // no loss
-      return 1.0f;
-    }
-  // lookup
-  else
-    {
-      // por value
-      float fPOR{};
-
-      // single point
-      if(fSINR == pcrEntryVector_.front().fSINR_ && fSINR == pcrEntryVector_.back().fSINR_)
-        {
-          fPOR = pcrEntryVector_.front().fPOR_;
-        }
-      else
-        {
-          // sinr adjusted
-          const int sinrScaled{static_cast<int>(fSINR * PRECISION_FACTOR)};
-
-          // sinr offset from the front
-          const int sinrOffset{static_cast<int>(pcrEntryVector_.front().fSINR_ * PRECISION_FACTOR)};
-
-          // get the table index
-          int idx{sinrScaled - sinrOffset};
-
-          // cap max index, low end check covers min index
-          if(idx >= static_cast<int>(porVector_.size()))
-            {
-              idx = porVector_.size() - 1;
-            }
-
-          // direct lookup
-          fPOR = porVector_[idx];
-        }
-
-      // adjust for pkt size is given in the table
-      if(tablePacketSize_ > 0)
-        {
-          fPOR = pow(fPOR,(float) packetLen /(float) tablePacketSize_);
-        }
-
-      LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
-                             DEBUG_LEVEL, 
-                             "MACI %03hu PCRManager::%s: sinr %3.2f, len %zu, por %3.2f",
-                             id_, 
-                             __func__, 
-                             fSINR, 
-                             packetLen, 
-                             fPOR);
-      return fPOR;
-    }
+  // direct lookup, adjusted for pkt size if given in the table
+  const float fPOR{pCurveTable_->getPOR(*pCurve_, fSINR, packetLen)};
+
+  LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
+                         DEBUG_LEVEL, 
+                         "MACI %03hu PCRManager::%s: sinr %3.2f, len %zu, por %3.2f",
+                         id_, 
+                         __func__, 
+                         fSINR, 
+                         packetLen, 
+                         fPOR);
+  return fPOR;
 }
 
 
 
-
 std::string 
 EMANE::Models::RFPipe::PCRManager::getAttribute(xmlNodePtr cur, const xmlChar * id)
 {
@@ -38,12 +38,11 @@
 #include "emane/types.h"
 #include "emane/startexception.h"
 #include "emane/platformserviceprovider.h"
+#include "emane/utils/pcrcurve.h"
 
 #include <libxml/parser.h>
 
 #include <string>
-#include <vector>
-#include <map>
 
 namespace EMANE
 {
@@ -58,37 +57,12 @@ namespace EMANE
        *
        * @brief  Manages the PCR curves
        *
+       * The curve is compiled into a fixed-step interpolated array
+       * and shared by all instances loading the same file.
+       *
        */
       class PCRManager 
       {
-
-        /**
-         *
-         * @brief Defines a PCR entry (sinr and por)
-         *
-         */
-        struct PCREntry {
-          float fSINR_;
-          float fPOR_;
-
-          PCREntry () :
-            fSINR_{},
-            fPOR_{}
-          { }
-
-          PCREntry (float fSinr, float fPor) :
-            fSINR_{fSinr},
-            fPOR_{fPor}
-          { }
-        };
-
-        typedef std::vector<PCREntry>    PCREntryVector;
-        typedef PCREntryVector::iterator PCREntryVectorIter;
-
-        typedef std::vector<float>  PORVector;
-        typedef PORVector::iterator PORVectorIter;
-
-
       public:
         PCRManager(EMANE::NEMId id, EMANE::PlatformServiceProvider * pPlatformService);
 
@@ -114,29 +88,27 @@ namespace EMANE
         float getPCR(float fSinr, size_t size);
        
       private:
-        void Open(const std::string & uri, xmlParserCtxtPtr * ppContext, xmlDoc ** ppDocument, xmlNode ** ppRoot);
+        static Utils::PCRCurveTable parse(const std::string & uri);
 
-        void Close(xmlParserCtxtPtr * ppContext, xmlDoc ** ppDocument);
+        static void Open(const std::string & uri, xmlParserCtxtPtr * ppContext, xmlDoc ** ppDocument, xmlNode ** ppRoot);
 
-        std::string getAttribute (xmlNodePtr cur, const xmlChar * id);
+        static void Close(xmlParserCtxtPtr * ppContext, xmlDoc ** ppDocument);
 
-        std::string getContent (xmlNodePtr cur);
+        static std::string getAttribute (xmlNodePtr cur, const xmlChar * id);
 
-        void getTable (xmlNodePtr cur);
+        static std::string getContent (xmlNodePtr cur);
 
-        void getRows (xmlNodePtr cur);
+        static void getTable (xmlNodePtr cur, Utils::PCRCurve::Points & points, size_t & tablePacketSize);
 
-        void interpolate();
+        static void getRows (xmlNodePtr cur, Utils::PCRCurve::Points & points);
 
         const EMANE::NEMId id_;
 
         EMANE::PlatformServiceProvider * pPlatformService_;
 
-        PCREntryVector pcrEntryVector_;
-
-        PORVector porVector_;
+        Utils::PCRCurveTablePtr pCurveTable_;
 
-        size_t tablePacketSize_;
+        const Utils::PCRCurve * pCurve_;
       };
     }
   }
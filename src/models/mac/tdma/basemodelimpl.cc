@@ -54,6 +54,9 @@ namespace
 {
   const std::string QUEUEMANAGER_PREFIX{"queue."};
   const std::string SCHEDULER_PREFIX{"scheduler."};
+
+  const std::string TxPreparationStage{"Preparation"};
+  const std::string TxSlotStartToSendStage{"Slot Start To Send"};
 }
 
 EMANE::Models::TDMA::BaseModel::Implementation::
@@ -69,6 +72,7 @@ Implementation(NEMId id,
   pRadioModel_{pRadioModel},
   bFlowControlEnable_{},
   u16FlowControlTokens_{},
+  bCompactMessageFormatEnable_{},
   sPCRCurveURI_{},
   transmitTimedEventId_{},
   nextMultiFrameTime_{},
@@ -88,7 +92,13 @@ Implementation(NEMId id,
       &packetStatusPublisher_,
       &neighborMetricManager_},
   flowControlManager_{*pRadioModel},
-  u64ScheduleIndex_{}{}
+  u64ScheduleIndex_{},
+  txPreparationLeadTime_{},
+  preparedTransmission_{},
+  pNumTxPrepared_{},
+  pNumTxPreparedLate_{},
+  pNumTxPreparedDiscard_{},
+  pTxLatencyTable_{}{}
 
 
 EMANE::Models::TDMA::BaseModel::Implementation::~Implementation()
@@ -135,6 +145,14 @@ EMANE::Models::TDMA::BaseModel::Implementation::initialize(Registrar & registrar
                                                  " further packets are transmitted causing application socket"
                                                  " queues to backup.");
 
+  configRegistrar.registerNumeric<bool>("compactmessageformatenable",
+                                        ConfigurationProperties::DEFAULT,
+                                        {false},
+                                        "Defines whether transmitted messages use the compact message format."
+                                        " The compact format is built from the queued packet data without"
+                                        " intermediate copies. Messages in either format are always received,"
+                                        " so only enable once all NEMs support the compact format.");
+
   configRegistrar.registerNonNumeric<std::string>("pcrcurveuri",
                                                   ConfigurationProperties::REQUIRED,
                                                   {},
@@ -172,6 +190,18 @@ EMANE::Models::TDMA::BaseModel::Implementation::initialize(Registrar & registrar
                                          0.1f,
                                          60.0f);
 
+  configRegistrar.registerNumeric<std::uint32_t>("txpreparationleadtime",
+                                                 ConfigurationProperties::DEFAULT,
+                                                 {0},
+                                                 "Defines the time in microseconds ahead of a transmit slot"
+                                                 " at which the next frame is dequeued, aggregated and"
+                                                 " serialized, leaving only the send at the slot boundary."
+                                                 " Packets enqueued during the lead time wait for a later"
+                                                 " slot. A value of 0 prepares the frame at the slot"
+                                                 " boundary.",
+                                                 0,
+                                                 1000000);
+
   auto & statisticRegistrar = registrar.statisticRegistrar();
 
   packetStatusPublisher_.registerStatistics(statisticRegistrar);
@@ -182,6 +212,53 @@ EMANE::Models::TDMA::BaseModel::Implementation::initialize(Registrar & registrar
 
   aggregationStatusPublisher_.registerStatistics(statisticRegistrar);
 
+  pNumTxPrepared_ =
+    statisticRegistrar.registerNumeric<std::uint64_t>("numTxPrepared",
+                                                      StatisticProperties::CLEARABLE,
+                                                      "Number of transmit slots prepared ahead of the"
+                                                      " slot boundary.");
+
+  pNumTxPreparedLate_ =
+    statisticRegistrar.registerNumeric<std::uint64_t>("numTxPreparedLate",
+                                                      StatisticProperties::CLEARABLE,
+                                                      "Number of transmit slots prepared at the slot"
+                                                      " boundary because the preparation lead time was"
+                                                      " not met.");
+
+  pNumTxPreparedDiscard_ =
+    statisticRegistrar.registerNumeric<std::uint64_t>("numTxPreparedDiscard",
+                                                      StatisticProperties::CLEARABLE,
+                                                      "Number of prepared transmit frames discarded because"
+                                                      " their slot was missed and the next tx slot could not"
+                                                      " carry them, or the model was stopped. Discarded bytes"
+                                                      " are reported in the Tx Prepared drop column.");
+
+  pTxLatencyTable_ =
+    statisticRegistrar.registerLazyTable<std::string,Utils::LogLinearHistogram>("TxLatencyTable",
+                                                                                {"Stage",
+                                                                                 "Count",
+                                                                                 "p50",
+                                                                                 "p99",
+                                                                                 "p99.9",
+                                                                                 "Max"},
+                                                                                [](const std::string & sStage,
+                                                                                   const Utils::LogLinearHistogram & histogram)
+                                                                                {
+                                                                                  return std::vector<Any>{
+                                                                                    Any{sStage},
+                                                                                    Any{histogram.getCount()},
+                                                                                    Any{histogram.getPercentile(50)},
+                                                                                    Any{histogram.getPercentile(99)},
+                                                                                    Any{histogram.getPercentile(99.9)},
+                                                                                    Any{histogram.getMax()}};
+                                                                                },
+                                                                                StatisticProperties::CLEARABLE,
+                                                                                "Transmit slot latency percentiles in"
+                                                                                " microseconds. Preparation is the time to"
+                                                                                " dequeue, aggregate and serialize a slot frame."
+                                                                                " Slot Start To Send is the time from the slot"
+                                                                                " boundary to the frame being sent downstream.");
+
   pQueueManager_->setPacketStatusPublisher(&packetStatusPublisher_);
 
   pQueueManager_->initialize(registrar);
@@ -243,6 +320,18 @@ EMANE::Models::TDMA::BaseModel::Implementation::configure(const ConfigurationUpd
                                   item.first.c_str(),
                                   u16FlowControlTokens_);
         }
+      else if(item.first == "compactmessageformatenable")
+        {
+          bCompactMessageFormatEnable_ = item.second[0].asBool();
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "MACI %03hu TDMA::BaseModel::%s: %s = %s",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  bCompactMessageFormatEnable_ ? "on" : "off");
+        }
       else if(item.first == "pcrcurveuri")
         {
           sPCRCurveURI_ = item.second[0].asString();
@@ -314,6 +403,18 @@ EMANE::Models::TDMA::BaseModel::Implementation::configure(const ConfigurationUpd
                                   item.first.c_str(),
                                   std::chrono::duration_cast<DoubleSeconds>(neighborMetricUpdateInterval_).count());
         }
+      else if(item.first == "txpreparationleadtime")
+        {
+          txPreparationLeadTime_ = Microseconds{item.second[0].asUINT32()};
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "MACI %03hu TDMA::BaseModel::%s %s = %ju",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  static_cast<std::uintmax_t>(txPreparationLeadTime_.count()));
+        }
       else
         {
           if(!item.first.compare(0,SCHEDULER_PREFIX.size(),SCHEDULER_PREFIX))
@@ -403,6 +504,8 @@ EMANE::Models::TDMA::BaseModel::Implementation::stop()
       transmitTimedEventId_ = 0;
     }
 
+  discardPreparedPacket();
+
   // check flow control enabled
   if(bFlowControlEnable_)
     {
@@ -984,6 +1087,10 @@ void EMANE::Models::TDMA::BaseModel::Implementation::notifyScheduleChange(const
       transmitTimedEventId_ = 0;
     }
 
+  // a frame prepared for the old schedule is kept if it is
+  // compatible with the next tx slot of the new schedule
+  preparedTransmission_.bRevalidate_ = true;
+
   if(u64BandwidthHz_ != u64BandwidthHz || frequencies != frequencies_)
     {
       // only required if freq set/bandwidth differs from existing
@@ -1019,12 +1126,7 @@ void EMANE::Models::TDMA::BaseModel::Implementation::notifyScheduleChange(const
 
       txSlotInfos_.pop_front();
 
-      transmitTimedEventId_ =
-        pPlatformService_->timerService().
-        schedule(std::bind(&Implementation::processTxOpportunity,
-                           this,
-                           u64ScheduleIndex_),
-                 pendingTxSlotInfo_.timePoint_);
+      scheduleTxOpportunity();
     }
 }
 
@@ -1066,9 +1168,34 @@ EMANE::Models::TDMA::QueueInfos EMANE::Models::TDMA::BaseModel::Implementation::
 
 void EMANE::Models::TDMA::BaseModel::Implementation::sendDownstreamPacket(double dSlotPortionRatio)
 {
+  if(!checkPreparedPacket())
+    {
+      // frame was not prepared ahead of the slot boundary
+      if(txPreparationLeadTime_ > Microseconds::zero())
+        {
+          ++*pNumTxPreparedLate_;
+        }
+
+      prepareDownstreamPacket();
+    }
+
+  transmitPreparedPacket(dSlotPortionRatio);
+}
+
+void EMANE::Models::TDMA::BaseModel::Implementation::prepareDownstreamPacket()
+{
+  auto start = Clock::now();
+
+  preparedTransmission_ = {};
+
+  preparedTransmission_.u64AbsoluteSlotIndex_ = pendingTxSlotInfo_.u64AbsoluteSlotIndex_;
+
+  preparedTransmission_.bPending_ = true;
+
+  preparedTransmission_.u8QueueId_ = pendingTxSlotInfo_.u8QueueId_;
+
   // calculate the number of bytes allowed in the slot
-  size_t bytesAvailable =
-    (slotDuration_.count() - slotOverhead_.count()) / 1000000.0 * pendingTxSlotInfo_.u64DataRatebps_ / 8.0;
+  size_t bytesAvailable{getSlotBytesAvailable()};
 
   auto entry = pQueueManager_->dequeue(pendingTxSlotInfo_.u8QueueId_,
                                        bytesAvailable,
@@ -1081,16 +1208,6 @@ void EMANE::Models::TDMA::BaseModel::Implementation::sendDownstreamPacket(double
     {
       if(totalSize <= bytesAvailable)
         {
-          float fSeconds{totalSize * 8.0f / pendingTxSlotInfo_.u64DataRatebps_};
-
-          Microseconds duration{std::chrono::duration_cast<Microseconds>(DoubleSeconds{fSeconds})};
-
-          // rounding error corner case mitigation
-          if(duration >= slotDuration_)
-            {
-              duration = slotDuration_ - Microseconds{1};
-            }
-
           NEMId dst{};
           size_t completedPackets{};
 
@@ -1120,7 +1237,7 @@ void EMANE::Models::TDMA::BaseModel::Implementation::sendDownstreamPacket(double
 
           LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
                                   DEBUG_LEVEL,
-                                  "MACI %03hu TDMA::BaseModel::%s sending downstream to %03hu components: %zu",
+                                  "MACI %03hu TDMA::BaseModel::%s preparing downstream to %03hu components: %zu",
                                   id_,
                                   __func__,
                                   dst,
@@ -1145,35 +1262,21 @@ void EMANE::Models::TDMA::BaseModel::Implementation::sendDownstreamPacket(double
 
           aggregationStatusPublisher_.update(components);
 
-          BaseModelMessage baseModelMessage{pendingTxSlotInfo_.u64AbsoluteSlotIndex_,
-              pendingTxSlotInfo_.u64DataRatebps_,
-              std::move(components)};
+          preparedTransmission_.dst_ = dst;
 
-          Serialization serialization{baseModelMessage.serialize()};
+          preparedTransmission_.totalSize_ = totalSize;
 
-          auto now = Clock::now();
+          preparedTransmission_.duration_ = getTxDuration(totalSize);
 
-          DownstreamPacket pkt({id_,dst,0,now},serialization.c_str(),serialization.size());
+          preparedTransmission_.message_ = BaseModelMessage{pendingTxSlotInfo_.u64AbsoluteSlotIndex_,
+                                                            pendingTxSlotInfo_.u64DataRatebps_,
+                                                            std::move(components)};
 
-          pkt.prependLengthPrefixFraming(serialization.size());
-
-          pRadioModel_->sendDownstreamPacket(CommonMACHeader{REGISTERED_EMANE_MAC_TDMA,u64SequenceNumber_++},
-                                             pkt,
-                                             {Controls::FrequencyControlMessage::create(
-                                                                                        u64BandwidthHz_,
-                                                                                        {{pendingTxSlotInfo_.u64FrequencyHz_,duration}}),
-                                                 Controls::TimeStampControlMessage::create(pendingTxSlotInfo_.timePoint_),
-                                                 Controls::TransmitterControlMessage::create({{id_,pendingTxSlotInfo_.dPowerdBm_}})});
-
-          slotStatusTablePublisher_.update(pendingTxSlotInfo_.u32RelativeIndex_,
-                                           pendingTxSlotInfo_.u32RelativeFrameIndex_,
-                                           pendingTxSlotInfo_.u32RelativeSlotIndex_,
-                                           SlotStatusTablePublisher::Status::TX_GOOD,
-                                           dSlotPortionRatio);
-
-          neighborMetricManager_.updateNeighborTxMetric(dst,
-                                                        pendingTxSlotInfo_.u64DataRatebps_,
-                                                        now);
+          // the compact format serializes only the header, payloads
+          // are gathered from the components at send
+          preparedTransmission_.serialization_ = bCompactMessageFormatEnable_ ?
+            preparedTransmission_.message_.serializeCompactHeader() :
+            preparedTransmission_.message_.serialize();
         }
       else
         {
@@ -1184,17 +1287,235 @@ void EMANE::Models::TDMA::BaseModel::Implementation::sendDownstreamPacket(double
                                   __func__,
                                   totalSize,
                                   bytesAvailable);
+
+          preparedTransmission_.bOversize_ = true;
+        }
+    }
+
+  pTxLatencyTable_->updateRow(TxPreparationStage,
+                              [start](Utils::LogLinearHistogram & histogram)
+                              {
+                                histogram.record(std::chrono::duration_cast<Microseconds>(Clock::now() -
+                                                                                          start).count());
+                              });
+}
+
+void EMANE::Models::TDMA::BaseModel::Implementation::transmitPreparedPacket(double dSlotPortionRatio)
+{
+  if(preparedTransmission_.bOversize_)
+    {
+      preparedTransmission_ = {};
+
+      return;
+    }
+
+  if(!preparedTransmission_.serialization_.empty())
+    {
+      const Serialization & serialization{preparedTransmission_.serialization_};
+
+      NEMId dst{preparedTransmission_.dst_};
+
+      auto now = Clock::now();
+
+      DownstreamPacket pkt = bCompactMessageFormatEnable_ ?
+        DownstreamPacket{{id_,dst,0,now},preparedTransmission_.message_.getCompactVectorIO(serialization)} :
+        DownstreamPacket{{id_,dst,0,now},serialization.c_str(),serialization.size()};
+
+      pkt.prependLengthPrefixFraming(pkt.length());
+
+      pRadioModel_->sendDownstreamPacket(CommonMACHeader{REGISTERED_EMANE_MAC_TDMA,u64SequenceNumber_++},
+                                         pkt,
+                                         {Controls::FrequencyControlMessage::create(
+                                                                                    u64BandwidthHz_,
+                                                                                    {{pendingTxSlotInfo_.u64FrequencyHz_,
+                                                                                          preparedTransmission_.duration_}}),
+                                             Controls::TimeStampControlMessage::create(pendingTxSlotInfo_.timePoint_),
+                                             Controls::TransmitterControlMessage::create({{id_,pendingTxSlotInfo_.dPowerdBm_}})});
+
+      // timer skew may place the send a little ahead of the slot
+      // boundary, which is counted as 0
+      Microseconds slotStartToSend{std::chrono::duration_cast<Microseconds>(now -
+                                                                            pendingTxSlotInfo_.timePoint_)};
+
+      pTxLatencyTable_->updateRow(TxSlotStartToSendStage,
+                                  [&slotStartToSend](Utils::LogLinearHistogram & histogram)
+                                  {
+                                    histogram.record(std::max(slotStartToSend.count(),
+                                                              Microseconds::rep{}));
+                                  });
+
+      neighborMetricManager_.updateNeighborTxMetric(dst,
+                                                    pendingTxSlotInfo_.u64DataRatebps_,
+                                                    now);
+    }
+
+  // update the slot table to record how well schedule is being
+  // serviced, whether or not there was anything to transmit
+  slotStatusTablePublisher_.update(pendingTxSlotInfo_.u32RelativeIndex_,
+                                   pendingTxSlotInfo_.u32RelativeFrameIndex_,
+                                   pendingTxSlotInfo_.u32RelativeSlotIndex_,
+                                   SlotStatusTablePublisher::Status::TX_GOOD,
+                                   dSlotPortionRatio);
+
+  // release the sent frame
+  preparedTransmission_ = {};
+}
+
+bool EMANE::Models::TDMA::BaseModel::Implementation::checkPreparedPacket()
+{
+  auto & prepared = preparedTransmission_;
+
+  if(!prepared.bPending_)
+    {
+      return false;
+    }
+
+  if(!prepared.bRevalidate_ &&
+     prepared.u64AbsoluteSlotIndex_ == pendingTxSlotInfo_.u64AbsoluteSlotIndex_)
+    {
+      return true;
+    }
+
+  // the slot the frame was prepared for was missed or the schedule
+  // changed, carry the frame to the pending slot if it is
+  // compatible, otherwise the frame must be discarded since its
+  // packets are no longer queued
+  if(!prepared.bOversize_ &&
+     !prepared.serialization_.empty() &&
+     prepared.u8QueueId_ == pendingTxSlotInfo_.u8QueueId_ &&
+     prepared.totalSize_ <= getSlotBytesAvailable() &&
+     (!pendingTxSlotInfo_.destination_ || pendingTxSlotInfo_.destination_ == prepared.dst_))
+    {
+      prepared.message_ = BaseModelMessage{pendingTxSlotInfo_.u64AbsoluteSlotIndex_,
+                                           pendingTxSlotInfo_.u64DataRatebps_,
+                                           MessageComponents{prepared.message_.getMessages()}};
+
+      prepared.serialization_ = bCompactMessageFormatEnable_ ?
+        prepared.message_.serializeCompactHeader() :
+        prepared.message_.serialize();
+
+      prepared.duration_ = getTxDuration(prepared.totalSize_);
+
+      prepared.u64AbsoluteSlotIndex_ = pendingTxSlotInfo_.u64AbsoluteSlotIndex_;
+
+      prepared.bRevalidate_ = false;
+
+      return true;
+    }
+
+  discardPreparedPacket();
+
+  return false;
+}
+
+void EMANE::Models::TDMA::BaseModel::Implementation::discardPreparedPacket()
+{
+  if(preparedTransmission_.bPending_)
+    {
+      if(!preparedTransmission_.serialization_.empty())
+        {
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  ERROR_LEVEL,
+                                  "MACI %03hu TDMA::BaseModel::%s prepared frame for slot %ju"
+                                  " discarded",
+                                  id_,
+                                  __func__,
+                                  static_cast<std::uintmax_t>(preparedTransmission_.u64AbsoluteSlotIndex_));
+
+          ++*pNumTxPreparedDiscard_;
+
+          // the components were accounted as accepted when dequeued
+          packetStatusPublisher_.outbound(id_,
+                                          preparedTransmission_.message_.getMessages(),
+                                          PacketStatusPublisher::OutboundAction::DROP_TX_PREPARED);
         }
+
+      preparedTransmission_ = {};
+    }
+}
+
+size_t EMANE::Models::TDMA::BaseModel::Implementation::getSlotBytesAvailable() const
+{
+  return (slotDuration_.count() - slotOverhead_.count()) / 1000000.0 * pendingTxSlotInfo_.u64DataRatebps_ / 8.0;
+}
+
+EMANE::Microseconds
+EMANE::Models::TDMA::BaseModel::Implementation::getTxDuration(size_t totalSize) const
+{
+  float fSeconds{totalSize * 8.0f / pendingTxSlotInfo_.u64DataRatebps_};
+
+  Microseconds duration{std::chrono::duration_cast<Microseconds>(DoubleSeconds{fSeconds})};
+
+  // rounding error corner case mitigation
+  if(duration >= slotDuration_)
+    {
+      duration = slotDuration_ - Microseconds{1};
+    }
+
+  return duration;
+}
+
+void EMANE::Models::TDMA::BaseModel::Implementation::scheduleTxOpportunity()
+{
+  if(txPreparationLeadTime_ > Microseconds::zero())
+    {
+      // prepare the frame ahead of the slot boundary
+      transmitTimedEventId_ =
+        pPlatformService_->timerService().
+        schedule(std::bind(&Implementation::processTxPreparation,
+                           this,
+                           u64ScheduleIndex_),
+                 pendingTxSlotInfo_.timePoint_ - txPreparationLeadTime_);
     }
   else
     {
-      // nothing to transmit, update the slot table to record how well
-      // schedule is being serviced
-      slotStatusTablePublisher_.update(pendingTxSlotInfo_.u32RelativeIndex_,
-                                       pendingTxSlotInfo_.u32RelativeFrameIndex_,
-                                       pendingTxSlotInfo_.u32RelativeSlotIndex_,
-                                       SlotStatusTablePublisher::Status::TX_GOOD,
-                                       dSlotPortionRatio);
+      transmitTimedEventId_ =
+        pPlatformService_->timerService().
+        schedule(std::bind(&Implementation::processTxOpportunity,
+                           this,
+                           u64ScheduleIndex_),
+                 pendingTxSlotInfo_.timePoint_);
+    }
+}
+
+void EMANE::Models::TDMA::BaseModel::Implementation::processTxPreparation(std::uint64_t u64ScheduleIndex)
+{
+  // check for scheduled timer functor after new schedule, if so disregard
+  if(u64ScheduleIndex != u64ScheduleIndex_)
+    {
+      LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                              ERROR_LEVEL,
+                              "MACI %03hu TDMA::BaseModel::%s old schedule tx preparation found"
+                              " scheduled index: %zu current index: %zu",
+                              id_,
+                              __func__,
+                              u64ScheduleIndex,
+                              u64ScheduleIndex_);
+      return;
+    }
+
+  if(Clock::now() < pendingTxSlotInfo_.timePoint_)
+    {
+      if(!checkPreparedPacket())
+        {
+          prepareDownstreamPacket();
+
+          ++*pNumTxPrepared_;
+        }
+
+      // only the send remains for the slot boundary
+      transmitTimedEventId_ =
+        pPlatformService_->timerService().
+        schedule(std::bind(&Implementation::processTxOpportunity,
+                           this,
+                           u64ScheduleIndex_),
+                 pendingTxSlotInfo_.timePoint_);
+    }
+  else
+    {
+      // preparation timer fired at or after the slot boundary,
+      // prepare and send as part of the tx opportunity
+      processTxOpportunity(u64ScheduleIndex);
     }
 }
 
@@ -1226,6 +1547,7 @@ void EMANE::Models::TDMA::BaseModel::Implementation::processTxOpportunity(std::u
     }
   else
     {
+      // a prepared frame is kept for the next compatible tx slot
       slotStatusTablePublisher_.update(pendingTxSlotInfo_.u32RelativeIndex_,
                                        pendingTxSlotInfo_.u32RelativeFrameIndex_,
                                        pendingTxSlotInfo_.u32RelativeSlotIndex_,
@@ -1260,13 +1582,7 @@ void EMANE::Models::TDMA::BaseModel::Implementation::processTxOpportunity(std::u
           if(pendingTxSlotInfo_.u64AbsoluteSlotIndex_ > nowSlotInfo.u64AbsoluteSlotIndex_)
             {
               // need to schedule processing in the future
-
-              transmitTimedEventId_ =
-                pPlatformService_->timerService().
-                schedule(std::bind(&Implementation::processTxOpportunity,
-                                   this,
-                                   u64ScheduleIndex_),
-                         pendingTxSlotInfo_.timePoint_);
+              scheduleTxOpportunity();
 
               bFoundTXSlot = true;
               break;
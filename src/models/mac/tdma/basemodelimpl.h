@@ -40,11 +40,16 @@
 #include "emane/models/tdma/basemodel.h"
 #include "emane/models/tdma/scheduler.h"
 #include "emane/models/tdma/queuemanager.h"
+#include "emane/serializable.h"
+#include "emane/statisticlazytable.h"
+#include "emane/statisticnumeric.h"
+#include "emane/utils/loglinearhistogram.h"
 
 #include "slotstatustablepublisher.h"
 #include "receivemanager.h"
 #include "packetstatuspublisherimpl.h"
 #include "aggregationstatuspublisher.h"
+#include "basemodelmessage.h"
 
 namespace EMANE
 {
@@ -119,6 +124,7 @@ namespace EMANE
 
         bool bFlowControlEnable_;
         std::uint16_t u16FlowControlTokens_;
+        bool bCompactMessageFormatEnable_;
         std::string sPCRCurveURI_;
         TimerEventId transmitTimedEventId_;
         TxSlotInfo pendingTxSlotInfo_;
@@ -138,8 +144,50 @@ namespace EMANE
         std::uint64_t u64ScheduleIndex_;
         AggregationStatusPublisher aggregationStatusPublisher_;
 
+        /**
+         * Frame built for a transmit slot ahead of the slot
+         * boundary, either by the preparation timer or at the
+         * boundary itself
+         */
+        struct PreparedTransmission
+        {
+          std::uint64_t u64AbsoluteSlotIndex_;
+          bool bPending_;
+          bool bOversize_;
+          bool bRevalidate_;
+          std::uint8_t u8QueueId_;
+          NEMId dst_;
+          size_t totalSize_;
+          Microseconds duration_;
+          BaseModelMessage message_;
+          Serialization serialization_;
+        };
+
+        Microseconds txPreparationLeadTime_;
+        PreparedTransmission preparedTransmission_;
+        StatisticNumeric<std::uint64_t> * pNumTxPrepared_;
+        StatisticNumeric<std::uint64_t> * pNumTxPreparedLate_;
+        StatisticNumeric<std::uint64_t> * pNumTxPreparedDiscard_;
+        StatisticLazyTable<std::string,Utils::LogLinearHistogram> * pTxLatencyTable_;
+
         void sendDownstreamPacket(double dSlotRemainingRatio);
 
+        void prepareDownstreamPacket();
+
+        void transmitPreparedPacket(double dSlotPortionRatio);
+
+        void discardPreparedPacket();
+
+        bool checkPreparedPacket();
+
+        size_t getSlotBytesAvailable() const;
+
+        Microseconds getTxDuration(size_t totalSize) const;
+
+        void scheduleTxOpportunity();
+
+        void processTxPreparation(std::uint64_t u64ScheduleIndex);
+
         void processTxOpportunity(std::uint64_t u64ScheduleIndex);
 
         double slotPortionRatio(const TimePoint & current,
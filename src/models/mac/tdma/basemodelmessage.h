@@ -37,6 +37,7 @@
 #include "emane/types.h"
 #include "tdmabasemodelmessage.pb.h"
 #include "emane/models/tdma/messagecomponent.h"
+#include "emane/utils/vectorio.h"
 
 namespace EMANE
 {
@@ -49,6 +50,14 @@ namespace EMANE
        *
        * @brief Message class used to serialize and deserialize %TDMA
        * radio model messages.
+       *
+       * Messages are serialized either as a protobuf
+       * TDMABaseModelMessage or in a compact format made of a fixed
+       * size header, one descriptor per component and the component
+       * payloads in order. The compact format lets a sender gather
+       * component payloads directly from their packets. The first
+       * byte of a compact message can never start a protobuf
+       * message, so deserialization accepts both formats.
        */
       class BaseModelMessage : public Serializable
       {
@@ -59,6 +68,17 @@ namespace EMANE
                          std::uint64_t u64DataRatebps,
                          MessageComponents && messages);
 
+        /**
+         * Creates a message from either serialized format
+         *
+         * @param p Pointer to the serialized message
+         * @param len Length of the serialized message
+         *
+         * @throw SerializationException when the message is malformed
+         *
+         * @note Component data references a single copy of the
+         * message owned by the components.
+         */
         BaseModelMessage(const void * p, size_t len);
 
         const MessageComponents & getMessages() const;
@@ -69,10 +89,63 @@ namespace EMANE
 
         Serialization serialize() const override;
 
+        /**
+         * Serializes the compact format header and component
+         * descriptors
+         *
+         * @return header serialization
+         */
+        Serialization serializeCompactHeader() const;
+
+        /**
+         * Gets the compact format message as a Scatter-Gather list
+         *
+         * @param header Header returned by serializeCompactHeader()
+         *
+         * @return Vectored IO referencing @a header followed by the
+         * component payloads, valid for the lifetime of both
+         */
+        Utils::VectorIO getCompactVectorIO(const Serialization & header) const;
+
       private:
+        static constexpr std::uint8_t COMPACT_FORMAT_IDENTIFIER{0xC1};
+        static constexpr std::uint8_t COMPACT_FLAG_FRAGMENT{0x01};
+        static constexpr std::uint8_t COMPACT_FLAG_MORE{0x02};
+
+        struct CompactHeader
+        {
+          std::uint8_t u8Identifier_;
+          std::uint8_t u8Reserved_;
+          std::uint16_t u16ComponentCount_;
+          std::uint64_t u64AbsoluteSlotIndex_;
+          std::uint64_t u64DataRatebps_;
+        } __attribute__((packed));
+
+        struct CompactComponent
+        {
+          std::uint8_t u8Type_;
+          std::uint8_t u8Flags_;
+          std::uint16_t u16Destination_;
+          std::uint8_t u8Priority_;
+          std::uint8_t u8Reserved_;
+          std::uint16_t u16Reserved_;
+          std::uint32_t u32Length_;
+        } __attribute__((packed));
+
+        struct CompactFragment
+        {
+          std::uint32_t u32Index_;
+          std::uint32_t u32Offset_;
+          std::uint64_t u64Sequence_;
+        } __attribute__((packed));
+
         std::uint64_t u64AbsoluteSlotIndex_;
         std::uint64_t u64DataRatebps_;
         MessageComponents messages_;
+
+        void parseProtobuf(const void * p, size_t len);
+
+        void parseCompact(const void * p, size_t len);
       };
     }
   }
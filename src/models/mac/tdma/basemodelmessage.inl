@@ -31,6 +31,10 @@
  */
 
 #include "tdmabasemodelmessage.pb.h"
+#include "emane/net.h"
+
+#include <limits>
+#include <memory>
 
 inline
 EMANE::Models::TDMA::BaseModelMessage::BaseModelMessage():
@@ -46,19 +50,35 @@ EMANE::Models::TDMA::BaseModelMessage::BaseModelMessage(std::uint64_t u64Absolut
   messages_{std::move(messages)}{}
 
 inline
-EMANE::Models::TDMA::BaseModelMessage::BaseModelMessage(const void * p, size_t len)
+EMANE::Models::TDMA::BaseModelMessage::BaseModelMessage(const void * p, size_t len):
+  u64AbsoluteSlotIndex_{},
+  u64DataRatebps_{}
+{
+  if(len && *static_cast<const std::uint8_t *>(p) == COMPACT_FORMAT_IDENTIFIER)
+    {
+      parseCompact(p,len);
+    }
+  else
+    {
+      parseProtobuf(p,len);
+    }
+}
+
+inline
+void EMANE::Models::TDMA::BaseModelMessage::parseProtobuf(const void * p, size_t len)
 {
-  EMANEMessage::TDMABaseModelMessage message;
+  // components reference the parsed message data
+  auto pMessage = std::make_shared<EMANEMessage::TDMABaseModelMessage>();
 
-  if(!message.ParseFromArray(p, len))
+  if(!pMessage->ParseFromArray(p, len))
     {
       throw SerializationException("unable to deserialize TDMABaseModelMessage");
     }
 
-  u64AbsoluteSlotIndex_ = message.absslotindex();
-  u64DataRatebps_ = message.dataratebps();
+  u64AbsoluteSlotIndex_ = pMessage->absslotindex();
+  u64DataRatebps_ = pMessage->dataratebps();
 
-  for(const auto & msg : message.messages())
+  for(const auto & msg : pMessage->messages())
     {
       MessageComponent::Type type;
 
@@ -86,7 +106,8 @@ EMANE::Models::TDMA::BaseModelMessage::BaseModelMessage(const void * p, size_t l
                 fragment.index(),
                   fragment.offset(),
                   fragment.sequence(),
-                  fragment.more()});
+                  fragment.more(),
+                  pMessage});
         }
       else
         {
@@ -94,7 +115,115 @@ EMANE::Models::TDMA::BaseModelMessage::BaseModelMessage(const void * p, size_t l
                 static_cast<NEMId>(msg.destination()),
                 static_cast<Priority>(msg.priority()),
                   {Utils::make_iovec(const_cast<char *>(msg.data().c_str()),
-                                     msg.data().size())}});
+                                     msg.data().size())},
+                  pMessage});
+        }
+    }
+}
+
+inline
+void EMANE::Models::TDMA::BaseModelMessage::parseCompact(const void * p, size_t len)
+{
+  if(len < sizeof(CompactHeader))
+    {
+      throw SerializationException("TDMABaseModelMessage compact header too short");
+    }
+
+  // single copy of the message, components reference their payloads
+  auto pBuffer =
+    std::make_shared<std::vector<std::uint8_t>>(static_cast<const std::uint8_t *>(p),
+                                                static_cast<const std::uint8_t *>(p) + len);
+
+  std::uint8_t * pData{pBuffer->data()};
+
+  const CompactHeader * pHeader{reinterpret_cast<const CompactHeader *>(pData)};
+
+  u64AbsoluteSlotIndex_ = NTOHLL(pHeader->u64AbsoluteSlotIndex_);
+  u64DataRatebps_ = NTOHLL(pHeader->u64DataRatebps_);
+
+  std::uint16_t u16ComponentCount{NTOHS(pHeader->u16ComponentCount_)};
+
+  size_t descriptorOffset{sizeof(CompactHeader)};
+
+  // payloads follow all descriptors, find where they start
+  size_t payloadOffset{descriptorOffset};
+
+  for(std::uint16_t i = 0; i < u16ComponentCount; ++i)
+    {
+      if(len < payloadOffset + sizeof(CompactComponent))
+        {
+          throw SerializationException("TDMABaseModelMessage compact descriptor too short");
+        }
+
+      const CompactComponent * pComponent{reinterpret_cast<const CompactComponent *>(pData + payloadOffset)};
+
+      payloadOffset += sizeof(CompactComponent);
+
+      if(pComponent->u8Flags_ & COMPACT_FLAG_FRAGMENT)
+        {
+          payloadOffset += sizeof(CompactFragment);
+        }
+    }
+
+  if(len < payloadOffset)
+    {
+      throw SerializationException("TDMABaseModelMessage compact descriptor too short");
+    }
+
+  for(std::uint16_t i = 0; i < u16ComponentCount; ++i)
+    {
+      const CompactComponent * pComponent{reinterpret_cast<const CompactComponent *>(pData + descriptorOffset)};
+
+      descriptorOffset += sizeof(CompactComponent);
+
+      MessageComponent::Type type;
+
+      switch(pComponent->u8Type_)
+        {
+        case EMANEMessage::TDMABaseModelMessage::Message::DATA:
+          type = MessageComponent::Type::DATA;
+          break;
+        case EMANEMessage::TDMABaseModelMessage::Message::CONTROL:
+          type = MessageComponent::Type::CONTROL;
+          break;
+        default:
+          throw SerializationException("TDMABaseModelMessage unkown type");
+        }
+
+      size_t length{NTOHL(pComponent->u32Length_)};
+
+      if(len < payloadOffset + length)
+        {
+          throw SerializationException("TDMABaseModelMessage compact payload too short");
+        }
+
+      Utils::VectorIO vectorIO{Utils::make_iovec(pData + payloadOffset,length)};
+
+      payloadOffset += length;
+
+      if(pComponent->u8Flags_ & COMPACT_FLAG_FRAGMENT)
+        {
+          const CompactFragment * pFragment{reinterpret_cast<const CompactFragment *>(pData + descriptorOffset)};
+
+          descriptorOffset += sizeof(CompactFragment);
+
+          messages_.push_back({type,
+                NTOHS(pComponent->u16Destination_),
+                pComponent->u8Priority_,
+                vectorIO,
+                NTOHL(pFragment->u32Index_),
+                NTOHL(pFragment->u32Offset_),
+                NTOHLL(pFragment->u64Sequence_),
+                static_cast<bool>(pComponent->u8Flags_ & COMPACT_FLAG_MORE),
+                pBuffer});
+        }
+      else
+        {
+          messages_.push_back({type,
+                NTOHS(pComponent->u16Destination_),
+                pComponent->u8Priority_,
+                vectorIO,
+                pBuffer});
         }
     }
 }
@@ -147,9 +276,14 @@ EMANE::Serialization EMANE::Models::TDMA::BaseModelMessage::serialize() const
           throw SerializationException("TDMABaseModelMessage unkown type");
         }
 
-      auto const & data = message.getData();
+      auto pPayload = pMessage->mutable_data();
 
-      pMessage->set_data(std::string(reinterpret_cast<const char *>(data.data()),data.size()));
+      pPayload->reserve(message.getDataSize());
+
+      for(const auto & entry : message.getVectorIO())
+        {
+          pPayload->append(static_cast<const char *>(entry.iov_base),entry.iov_len);
+        }
 
       if(message.isFragment())
         {
@@ -170,3 +304,90 @@ EMANE::Serialization EMANE::Models::TDMA::BaseModelMessage::serialize() const
 
   return serialization;
 }
+
+inline
+EMANE::Serialization EMANE::Models::TDMA::BaseModelMessage::serializeCompactHeader() const
+{
+  if(messages_.size() > std::numeric_limits<std::uint16_t>::max())
+    {
+      throw SerializationException("TDMABaseModelMessage too many components");
+    }
+
+  size_t size{sizeof(CompactHeader) + messages_.size() * sizeof(CompactComponent)};
+
+  for(const auto & message : messages_)
+    {
+      if(message.isFragment())
+        {
+          size += sizeof(CompactFragment);
+        }
+    }
+
+  Serialization serialization(size,'\0');
+
+  char * pData{&serialization[0]};
+
+  CompactHeader * pHeader{reinterpret_cast<CompactHeader *>(pData)};
+
+  pHeader->u8Identifier_ = COMPACT_FORMAT_IDENTIFIER;
+  pHeader->u16ComponentCount_ = HTONS(static_cast<std::uint16_t>(messages_.size()));
+  pHeader->u64AbsoluteSlotIndex_ = HTONLL(u64AbsoluteSlotIndex_);
+  pHeader->u64DataRatebps_ = HTONLL(u64DataRatebps_);
+
+  size_t offset{sizeof(CompactHeader)};
+
+  for(const auto & message : messages_)
+    {
+      CompactComponent * pComponent{reinterpret_cast<CompactComponent *>(pData + offset)};
+
+      offset += sizeof(CompactComponent);
+
+      switch(message.getType())
+        {
+        case MessageComponent::Type::DATA:
+          pComponent->u8Type_ = EMANEMessage::TDMABaseModelMessage::Message::DATA;
+          break;
+        case MessageComponent::Type::CONTROL:
+          pComponent->u8Type_ = EMANEMessage::TDMABaseModelMessage::Message::CONTROL;
+          break;
+        default:
+          throw SerializationException("TDMABaseModelMessage unkown type");
+        }
+
+      pComponent->u16Destination_ = HTONS(message.getDestination());
+      pComponent->u8Priority_ = message.getPriority();
+      pComponent->u32Length_ = HTONL(static_cast<std::uint32_t>(message.getDataSize()));
+
+      if(message.isFragment())
+        {
+          pComponent->u8Flags_ = COMPACT_FLAG_FRAGMENT |
+            (message.isMoreFragments() ? COMPACT_FLAG_MORE : 0);
+
+          CompactFragment * pFragment{reinterpret_cast<CompactFragment *>(pData + offset)};
+
+          offset += sizeof(CompactFragment);
+
+          pFragment->u32Index_ = HTONL(static_cast<std::uint32_t>(message.getFragmentIndex()));
+          pFragment->u32Offset_ = HTONL(static_cast<std::uint32_t>(message.getFragmentOffset()));
+          pFragment->u64Sequence_ = HTONLL(message.getFragmentSequence());
+        }
+    }
+
+  return serialization;
+}
+
+inline
+EMANE::Utils::VectorIO
+EMANE::Models::TDMA::BaseModelMessage::getCompactVectorIO(const Serialization & header) const
+{
+  Utils::VectorIO vectorIO{Utils::make_iovec(const_cast<char *>(header.data()),header.size())};
+
+  for(const auto & message : messages_)
+    {
+      auto componentVectorIO = message.getVectorIO();
+
+      vectorIO.insert(vectorIO.end(),componentVectorIO.begin(),componentVectorIO.end());
+    }
+
+  return vectorIO;
+}
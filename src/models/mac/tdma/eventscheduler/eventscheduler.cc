@@ -177,6 +177,8 @@ void EMANE::Models::TDMA::EventScheduler::processEvent(const EventId & eventId,
               // clear out existing schedule
               slotInfos_.clear();
 
+              slotTable_.clear();
+
               // store new structure info
               structure_ = structure;
 
@@ -187,6 +189,9 @@ void EMANE::Models::TDMA::EventScheduler::processEvent(const EventId & eventId,
               // store new schedule
               slotInfos_ = event.getSlotInfos();
 
+              // build the tx slot and slot type lookup tables
+              slotTable_.reset(slotInfos_);
+
               // will notify ScheduleUser of schedule
               bNotify = true;
             }
@@ -267,6 +272,9 @@ void EMANE::Models::TDMA::EventScheduler::processEvent(const EventId & eventId,
                   for(;indexIter != indexes.end(); ++indexIter, ++slotInfoIter)
                     {
                       slotInfos_[*indexIter] = *slotInfoIter;
+
+                      // patch the lookup tables for the changed slot
+                      slotTable_.update(*indexIter,slotInfoIter->getType());
                     }
 
                   // will notify ScheduleUser of schedule update
@@ -329,6 +337,8 @@ void EMANE::Models::TDMA::EventScheduler::flushSchedule()
   // clear out existing schedule
   slotInfos_.clear();
 
+  slotTable_.clear();
+
   // clear structure
   structure_ = {};
 
@@ -363,15 +373,16 @@ EMANE::Models::TDMA::EventScheduler::getSlotInfo(std::uint64_t u64AbsoluteSlotIn
 
   auto index = u32RelativeFrameIndex * structure_.getSlotsPerFrame() + u32RelativeSlotIndex;
 
-  const auto & info = slotInfos_[index];
+  // slot type from the run-length table, the schedule entry is not needed
+  auto type = slotTable_.getType(index);
 
   return {u64AbsoluteSlotIndex,
       index,
       u32RelativeSlotIndex,
       u32RelativeFrameIndex,
       slotter_.getSlotTime(u64AbsoluteSlotIndex),
-      info.getType() == Events::SlotInfo::Type::RX ? SlotInfo::Type::RX :
-      info.getType() == Events::SlotInfo::Type::TX ?
+      type == Events::SlotInfo::Type::RX ? SlotInfo::Type::RX :
+      type == Events::SlotInfo::Type::TX ?
       SlotInfo::Type::TX : SlotInfo::Type::IDLE};
 }
 
@@ -427,17 +438,17 @@ EMANE::Models::TDMA::EventScheduler::getRxSlotInfo(const TimePoint & timePoint)
 
   auto index = u32RelativeFrameIndex * structure_.getSlotsPerFrame() + u32RelativeSlotIndex;
 
-
-  const auto & info = slotInfos_[index];
+  // only an rx slot needs its frequency from the schedule entry
+  bool bRx{slotTable_.getType(index) == Events::SlotInfo::Type::RX};
 
   RxSlotInfo rxSlotInfo{u64AbsoluteSlotIndex,
       index,
       u32RelativeSlotIndex,
       u32RelativeFrameIndex,
       slotter_.getSlotTime(u64AbsoluteSlotIndex),
-      info.getFrequency()};
+      bRx ? slotInfos_[index].getFrequency() : 0};
 
-  return {rxSlotInfo,info.getType() == Events::SlotInfo::Type::RX};
+  return {rxSlotInfo,bRx};
 }
 
 std::pair<EMANE::Models::TDMA::TxSlotInfos,EMANE::TimePoint>
@@ -479,33 +490,41 @@ EMANE::Models::TDMA::EventScheduler::getTxSlotInfo(const TimePoint & timePoint,
 
   auto index = u32RelativeFrameIndex * structure_.getSlotsPerFrame() + u32RelativeSlotIndex;
 
+  const auto & txSlotIndexes = slotTable_.getTxSlotIndexes();
+
+  // absolute index of the first slot of the request multiframe
+  std::uint64_t u64MultiFrameSlotIndex{u64AbsoluteSlotIndex - index};
+
+  std::uint64_t u64SlotsPerMultiFrame{slotInfos_.size()};
+
   TxSlotInfos txSlotInfos{};
 
+  // the first multiframe starts at the request slot, the rest are whole
+  auto iter = slotTable_.getNextTxSlot(index);
+
   for(int i = 0; i < multiframes; ++i)
     {
-      while(index < slotInfos_.size())
+      for(; iter != txSlotIndexes.end(); ++iter)
         {
-          const auto & info = slotInfos_[index];
-
-          if(info.getType() == Events::SlotInfo::Type::TX)
-            {
-              txSlotInfos.push_back({u64AbsoluteSlotIndex,
-                    index,
-                    info.getSlotIndex(),
-                    info.getFrameIndex(),
-                    slotter_.getSlotTime(u64AbsoluteSlotIndex),
-                    info.getFrequency(),
-                    info.getDataRate(),
-                    info.getServiceClass(),
-                    info.getPower(),
-                    info.getDestination()});
-            }
-
-          ++u64AbsoluteSlotIndex;
-          ++index;
+          const auto & info = slotInfos_[*iter];
+
+          std::uint64_t u64TxAbsoluteSlotIndex{u64MultiFrameSlotIndex + *iter};
+
+          txSlotInfos.push_back({u64TxAbsoluteSlotIndex,
+                *iter,
+                info.getSlotIndex(),
+                info.getFrameIndex(),
+                slotter_.getSlotTime(u64TxAbsoluteSlotIndex),
+                info.getFrequency(),
+                info.getDataRate(),
+                info.getServiceClass(),
+                info.getPower(),
+                info.getDestination()});
         }
 
-      index = 0;
+      u64MultiFrameSlotIndex += u64SlotsPerMultiFrame;
+
+      iter = txSlotIndexes.begin();
     }
 
   return {txSlotInfos,slotter_.getMultiFrameTime(u64AbsoluteMultiFrameIndex + multiframes)};
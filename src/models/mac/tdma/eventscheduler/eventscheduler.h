@@ -38,6 +38,7 @@
 #include "emane/events/slotstructure.h"
 #include "emane/statisticnumeric.h"
 #include "eventtablepublisher.h"
+#include "slottable.h"
 #include "slotter.h"
 
 namespace EMANE
@@ -96,6 +97,7 @@ namespace EMANE
         Events::SlotStructure structure_;
         EventTablePublisher eventTablePublisher_;
         Slotter slotter_;
+        SlotTable slotTable_;
         mutable bool bWaitingFirstTxSlotInfoRequest_;
         Frequencies frequencies_;
         StatisticNumeric<std::uint64_t> * pNumScheduleRejectSlotIndexOutOfRange_;
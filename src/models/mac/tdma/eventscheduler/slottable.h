@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANEMODELSTDMASLOTTABLE_HEADER_
+#define EMANEMODELSTDMASLOTTABLE_HEADER_
+
+#include "emane/events/slotinfo.h"
+
+#include <vector>
+
+namespace EMANE
+{
+  namespace Models
+  {
+    namespace TDMA
+    {
+      /**
+       * @class SlotTable
+       *
+       * @brief Compact lookup tables built from a multiframe schedule.
+       *
+       * Holds a sorted index of the relative slot indexes of all TX
+       * slots and a run-length encoded table of slot types, so the
+       * next TX slot and the type of any slot can be found with a
+       * binary search instead of a scan of the schedule.
+       */
+      class SlotTable
+      {
+      public:
+        using TxSlotIndexes = std::vector<std::uint32_t>;
+
+        SlotTable();
+
+        /**
+         * Rebuilds the index from a full schedule
+         *
+         * @param slotInfos Multiframe schedule ordered by relative
+         * slot index
+         */
+        void reset(const Events::SlotInfos & slotInfos);
+
+        /**
+         * Clears the index
+         */
+        void clear();
+
+        /**
+         * Patches the index after a single slot changes type
+         *
+         * @param u32RelativeIndex Relative slot index in the multiframe
+         * @param type New slot type
+         */
+        void update(std::uint32_t u32RelativeIndex,
+                    Events::SlotInfo::Type type);
+
+        /**
+         * Gets the type of a slot
+         *
+         * @param u32RelativeIndex Relative slot index in the multiframe
+         *
+         * @return slot type, IDLE if out of range
+         */
+        Events::SlotInfo::Type getType(std::uint32_t u32RelativeIndex) const;
+
+        /**
+         * Gets the sorted relative indexes of all TX slots
+         */
+        const TxSlotIndexes & getTxSlotIndexes() const;
+
+        /**
+         * Gets the first TX slot at or after a relative slot index
+         *
+         * @param u32RelativeIndex Relative slot index in the multiframe
+         *
+         * @return iterator into the TX slot indexes
+         */
+        TxSlotIndexes::const_iterator getNextTxSlot(std::uint32_t u32RelativeIndex) const;
+
+      private:
+        struct Run
+        {
+          std::uint32_t u32StartIndex_;
+          Events::SlotInfo::Type type_;
+        };
+
+        using Runs = std::vector<Run>;
+
+        TxSlotIndexes txSlotIndexes_;
+        Runs runs_;
+        std::uint32_t u32SlotCount_;
+
+        Runs::iterator findRun(std::uint32_t u32RelativeIndex);
+
+        Runs::const_iterator findRun(std::uint32_t u32RelativeIndex) const;
+      };
+    }
+  }
+}
+
+#include "slottable.inl"
+
+#endif // EMANEMODELSTDMASLOTTABLE_HEADER_
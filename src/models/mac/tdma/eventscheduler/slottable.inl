@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+
+inline
+EMANE::Models::TDMA::SlotTable::SlotTable():
+  u32SlotCount_{}{}
+
+inline
+void EMANE::Models::TDMA::SlotTable::reset(const Events::SlotInfos & slotInfos)
+{
+  clear();
+
+  u32SlotCount_ = slotInfos.size();
+
+  for(std::uint32_t i = 0; i < u32SlotCount_; ++i)
+    {
+      auto type = slotInfos[i].getType();
+
+      if(type == Events::SlotInfo::Type::TX)
+        {
+          txSlotIndexes_.push_back(i);
+        }
+
+      if(runs_.empty() || runs_.back().type_ != type)
+        {
+          runs_.push_back({i,type});
+        }
+    }
+
+  txSlotIndexes_.shrink_to_fit();
+  runs_.shrink_to_fit();
+}
+
+inline
+void EMANE::Models::TDMA::SlotTable::clear()
+{
+  txSlotIndexes_.clear();
+  runs_.clear();
+  u32SlotCount_ = 0;
+}
+
+inline
+void EMANE::Models::TDMA::SlotTable::update(std::uint32_t u32RelativeIndex,
+                                            Events::SlotInfo::Type type)
+{
+  if(u32RelativeIndex >= u32SlotCount_)
+    {
+      return;
+    }
+
+  auto iter = findRun(u32RelativeIndex);
+
+  auto previousType = iter->type_;
+
+  if(previousType == type)
+    {
+      return;
+    }
+
+  // patch the tx slot index
+  auto txIter = std::lower_bound(txSlotIndexes_.begin(),
+                                 txSlotIndexes_.end(),
+                                 u32RelativeIndex);
+
+  if(type == Events::SlotInfo::Type::TX)
+    {
+      txSlotIndexes_.insert(txIter,u32RelativeIndex);
+    }
+  else if(previousType == Events::SlotInfo::Type::TX)
+    {
+      txSlotIndexes_.erase(txIter);
+    }
+
+  // split the run holding the slot into at most three runs
+  std::uint32_t u32RunEnd = std::next(iter) == runs_.end() ?
+    u32SlotCount_ : std::next(iter)->u32StartIndex_;
+
+  Run pieces[3];
+  std::size_t count{};
+
+  if(iter->u32StartIndex_ < u32RelativeIndex)
+    {
+      pieces[count++] = {iter->u32StartIndex_,previousType};
+    }
+
+  pieces[count++] = {u32RelativeIndex,type};
+
+  if(u32RelativeIndex + 1 < u32RunEnd)
+    {
+      pieces[count++] = {u32RelativeIndex + 1,previousType};
+    }
+
+  std::size_t position = std::distance(runs_.begin(),iter);
+
+  iter = runs_.erase(iter);
+
+  runs_.insert(iter,pieces,pieces + count);
+
+  // merge adjacent runs of the same type around the patched slot
+  std::size_t first = position > 0 ? position - 1 : 0;
+  std::size_t last = std::min(position + count,runs_.size() - 1);
+
+  for(std::size_t i = last; i > first; --i)
+    {
+      if(runs_[i].type_ == runs_[i - 1].type_)
+        {
+          runs_.erase(runs_.begin() + i);
+        }
+    }
+}
+
+inline
+EMANE::Events::SlotInfo::Type
+EMANE::Models::TDMA::SlotTable::getType(std::uint32_t u32RelativeIndex) const
+{
+  if(u32RelativeIndex >= u32SlotCount_)
+    {
+      return Events::SlotInfo::Type::IDLE;
+    }
+
+  return findRun(u32RelativeIndex)->type_;
+}
+
+inline
+const EMANE::Models::TDMA::SlotTable::TxSlotIndexes &
+EMANE::Models::TDMA::SlotTable::getTxSlotIndexes() const
+{
+  return txSlotIndexes_;
+}
+
+inline
+EMANE::Models::TDMA::SlotTable::TxSlotIndexes::const_iterator
+EMANE::Models::TDMA::SlotTable::getNextTxSlot(std::uint32_t u32RelativeIndex) const
+{
+  return std::lower_bound(txSlotIndexes_.begin(),
+                          txSlotIndexes_.end(),
+                          u32RelativeIndex);
+}
+
+inline
+EMANE::Models::TDMA::SlotTable::Runs::iterator
+EMANE::Models::TDMA::SlotTable::findRun(std::uint32_t u32RelativeIndex)
+{
+  // last run starting at or before the index
+  return std::prev(std::upper_bound(runs_.begin(),
+                                    runs_.end(),
+                                    u32RelativeIndex,
+                                    [](std::uint32_t u32Index, const Run & run)
+                                    {
+                                      return u32Index < run.u32StartIndex_;
+                                    }));
+}
+
+inline
+EMANE::Models::TDMA::SlotTable::Runs::const_iterator
+EMANE::Models::TDMA::SlotTable::findRun(std::uint32_t u32RelativeIndex) const
+{
+  return std::prev(std::upper_bound(runs_.begin(),
+                                    runs_.end(),
+                                    u32RelativeIndex,
+                                    [](std::uint32_t u32Index, const Run & run)
+                                    {
+                                      return u32Index < run.u32StartIndex_;
+                                    }));
+}
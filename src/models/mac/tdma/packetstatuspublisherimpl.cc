@@ -33,6 +33,8 @@
 #include "packetstatuspublisherimpl.h"
 #include "priority.h"
 
+#include <algorithm>
+
 namespace
 {
   const EMANE::StatisticTableLabels PacketAcceptLabels =
@@ -63,7 +65,8 @@ namespace
       "Long",
       "Freq",
       "Slot Error",
-      "Miss Fragment"
+      "Miss Fragment",
+      "Tx Prepared"
     };
 
   enum PacketDropColumn
@@ -80,7 +83,8 @@ namespace
       DROP_COLUMN_TOO_LONG = 9,
       DROP_COLUMN_FREQUENCY = 10,
       DROP_COLUMN_SLOT_ERROR = 11,
-      DROP_COLUMN_MISS_FRAGMENT = 12
+      DROP_COLUMN_MISS_FRAGMENT = 12,
+      DROP_COLUMN_TX_PREPARED = 13
     };
 
 }
@@ -90,51 +94,54 @@ EMANE::Models::TDMA::PacketStatusPublisherImpl::~PacketStatusPublisherImpl(){}
 
 void EMANE::Models::TDMA::PacketStatusPublisherImpl::registerStatistics(StatisticRegistrar & statisticRegistrar)
 {
+  auto acceptMaterializer = [](const NEMId & src, const PacketAcceptRow & row)
+    {
+      return std::vector<Any>{Any{src},
+          Any{row.u64BytesTx},
+            Any{row.u64BytesRx}};
+    };
+
+  auto dropMaterializer = [](const NEMId & src, const PacketDropRow & row)
+    {
+      std::vector<Any> anys{Any{src}};
+
+      for(const auto & bytes : row)
+        {
+          anys.push_back(Any{bytes});
+        }
+
+      return anys;
+    };
+
   for(int queueIndex = 0; queueIndex < QUEUE_COUNT; ++queueIndex)
     {
       broadcastAcceptTables_[queueIndex] =
-        statisticRegistrar.registerTable<NEMId>("BroadcastByteAcceptTable" + std::to_string(queueIndex),
-                                                PacketAcceptLabels,
-                                                [this,queueIndex](StatisticTablePublisher * pTable)
-                                                {
-                                                  std::lock_guard<std::mutex> m(mutexBroadcastPacketAcceptTable_);
-                                                  broadcastAcceptInfos_[queueIndex].clear();
-                                                  pTable->clear();
-                                                },
-                                                "Broadcast bytes accepted");
+        statisticRegistrar.registerLazyTable<NEMId,PacketAcceptRow>("BroadcastByteAcceptTable" + std::to_string(queueIndex),
+                                                                    PacketAcceptLabels,
+                                                                    acceptMaterializer,
+                                                                    StatisticProperties::CLEARABLE,
+                                                                    "Broadcast bytes accepted");
 
       unicastAcceptTables_[queueIndex] =
-        statisticRegistrar.registerTable<NEMId>("UnicastByteAcceptTable" + std::to_string(queueIndex),
-                                                PacketAcceptLabels,
-                                                [this,queueIndex](StatisticTablePublisher * pTable)
-                                                {
-                                                  std::lock_guard<std::mutex> m(mutexUnicastPacketAcceptTable_);
-                                                  unicastAcceptInfos_[queueIndex].clear();
-                                                  pTable->clear();
-                                                },
-                                                "Unicast bytes accepted");
+        statisticRegistrar.registerLazyTable<NEMId,PacketAcceptRow>("UnicastByteAcceptTable" + std::to_string(queueIndex),
+                                                                    PacketAcceptLabels,
+                                                                    acceptMaterializer,
+                                                                    StatisticProperties::CLEARABLE,
+                                                                    "Unicast bytes accepted");
 
       broadcastDropTables_[queueIndex] =
-        statisticRegistrar.registerTable<NEMId>("BroadcastByteDropTable" + std::to_string(queueIndex),
-                                                PacketDropLabels,
-                                                [this,queueIndex](StatisticTablePublisher * pTable)
-                                                {
-                                                  std::lock_guard<std::mutex> m(mutexBroadcastPacketDropTable_);
-                                                  broadcastDropInfos_[queueIndex].clear();
-                                                  pTable->clear();
-                                                },
-                                                "Broadcast bytes dropped");
+        statisticRegistrar.registerLazyTable<NEMId,PacketDropRow>("BroadcastByteDropTable" + std::to_string(queueIndex),
+                                                                  PacketDropLabels,
+                                                                  dropMaterializer,
+                                                                  StatisticProperties::CLEARABLE,
+                                                                  "Broadcast bytes dropped");
 
       unicastDropTables_[queueIndex] =
-        statisticRegistrar.registerTable<NEMId>("UnicastByteDropTable" + std::to_string(queueIndex),
-                                                PacketDropLabels,
-                                                [this,queueIndex](StatisticTablePublisher * pTable)
-                                                {
-                                                  std::lock_guard<std::mutex> m(mutexUnicastPacketDropTable_);
-                                                  unicastDropInfos_[queueIndex].clear();
-                                                  pTable->clear();
-                                                },
-                                                "Unicast bytes dropped");
+        statisticRegistrar.registerLazyTable<NEMId,PacketDropRow>("UnicastByteDropTable" + std::to_string(queueIndex),
+                                                                  PacketDropLabels,
+                                                                  dropMaterializer,
+                                                                  StatisticProperties::CLEARABLE,
+                                                                  "Unicast bytes dropped");
     }
 }
 
@@ -145,7 +152,7 @@ void EMANE::Models::TDMA::PacketStatusPublisherImpl::inbound(NEMId src,
   inbound(src,
           component.getDestination(),
           component.getPriority(),
-          component.getData().size(),
+          component.getDataSize(),
           action);
 }
 
@@ -158,7 +165,7 @@ void  EMANE::Models::TDMA::PacketStatusPublisherImpl::inbound(NEMId src,
       inbound(src,
               component.getDestination(),
               component.getPriority(),
-              component.getData().size(),
+              component.getDataSize(),
               action);
     }
 }
@@ -171,204 +178,78 @@ void EMANE::Models::TDMA::PacketStatusPublisherImpl::inbound(NEMId src,
                                                              size_t size,
                                                              InboundAction action)
 {
-  TableArray * pAcceptTables{};
-  TableArray * pDropTables{};
-
-  AcceptInfoArrary * pAcceptInfos{};
-  DropInfoArrary  * pDropInfos{};
-
-  std::mutex * pMutexAcceptTable = {};
-  std::mutex * pMutexDropTable = {};
-
-  if(dst == NEM_BROADCAST_MAC_ADDRESS)
-    {
-      pAcceptTables = &broadcastAcceptTables_;
-      pDropTables = &broadcastDropTables_;
-
-      pAcceptInfos = &broadcastAcceptInfos_;
-      pDropInfos = &broadcastDropInfos_;
-
-      pMutexAcceptTable = &mutexBroadcastPacketAcceptTable_;
-      pMutexDropTable = &mutexBroadcastPacketDropTable_;
-    }
-  else
-    {
-      pAcceptTables = &unicastAcceptTables_;
-      pDropTables = &unicastDropTables_;
-
-      pAcceptInfos = &unicastAcceptInfos_;
-      pDropInfos = &unicastDropInfos_;
-
-      pMutexAcceptTable = &mutexUnicastPacketAcceptTable_;
-      pMutexDropTable = &mutexUnicastPacketDropTable_;
-    }
+  bool bBroadcast{dst == NEM_BROADCAST_MAC_ADDRESS};
 
   // detetmine the relevant queue based on priority
   std::uint8_t u8QueueIndex{priorityToQueue(priority)};
 
   if(action == InboundAction::ACCEPT_GOOD)
     {
-      std::lock_guard<std::mutex> m(*pMutexAcceptTable);
-
-      auto iter = (*pAcceptInfos)[u8QueueIndex].find(src);
-
-      if(iter == (*pAcceptInfos)[u8QueueIndex].end())
-        {
-          iter = (*pAcceptInfos)[u8QueueIndex].insert({src,{}}).first;
-
-
-          (*pAcceptTables)[u8QueueIndex]->addRow(src,
-                                                 {Any{src},
-                                                     Any{0L},
-                                                       Any{0L}});
-        }
+      auto & tables = bBroadcast ? broadcastAcceptTables_ : unicastAcceptTables_;
 
-      auto & bytes = std::get<ACCEPT_COLUMN_NUM_BYTES_RX-1>(iter->second);
-
-      bytes += size;
-
-      (*pAcceptTables)[u8QueueIndex]->setCell(src,
-                                              ACCEPT_COLUMN_NUM_BYTES_RX,
-                                              Any{bytes});
+      tables[u8QueueIndex]->updateRow(src,
+                                      [size](PacketAcceptRow & row)
+                                      {
+                                        row.u64BytesRx += size;
+                                      });
     }
   else
     {
-      std::lock_guard<std::mutex> m(*pMutexDropTable);
-
-      auto iter = (*pDropInfos)[u8QueueIndex].find(src);
-
-      if(iter == (*pDropInfos)[u8QueueIndex].end())
-        {
-          iter = (*pDropInfos)[u8QueueIndex].insert({src,{}}).first;
-
-          (*pDropTables)[u8QueueIndex]->addRow(src,
-                                               {Any{src},
-                                                   Any{0L},
-                                                     Any{0L},
-                                                       Any{0L},
-                                                         Any{0L},
-                                                           Any{0L},
-                                                             Any{0L},
-                                                               Any{0L},
-                                                                 Any{0L},
-                                                                   Any{0L},
-                                                                     Any{0L},
-                                                                       Any{0L},
-                                                                         Any{0L}});
-        }
+      int iColumn{};
 
       switch(action)
         {
         case InboundAction::DROP_BAD_CONTROL:
-          {
-            auto & bytes = std::get<DROP_COLUMN_BAD_CONTROL-1>(iter->second);
-
-            bytes += size;
-
-            (*pDropTables)[u8QueueIndex]->setCell(src,
-                                                  DROP_COLUMN_BAD_CONTROL,
-                                                  Any{bytes});
-          }
+          iColumn = DROP_COLUMN_BAD_CONTROL;
           break;
 
         case InboundAction::DROP_SLOT_NOT_RX:
         case InboundAction::DROP_SLOT_MISSED_RX:
-          {
-            auto & bytes = std::get<DROP_COLUMN_SLOT_ERROR-1>(iter->second);
-
-            bytes += size;
-
-            (*pDropTables)[u8QueueIndex]->setCell(src,
-                                                  DROP_COLUMN_SLOT_ERROR,
-                                                  Any{bytes});
-          }
+          iColumn = DROP_COLUMN_SLOT_ERROR;
           break;
 
         case InboundAction::DROP_MISS_FRAGMENT:
-          {
-            auto & bytes = std::get<DROP_COLUMN_MISS_FRAGMENT-1>(iter->second);
-
-            bytes += size;
-
-            (*pDropTables)[u8QueueIndex]->setCell(src,
-                                                  DROP_COLUMN_MISS_FRAGMENT,
-                                                  Any{bytes});
-          }
+          iColumn = DROP_COLUMN_MISS_FRAGMENT;
           break;
 
         case InboundAction::DROP_SPECTRUM_SERVICE:
-          {
-            auto & bytes = std::get<DROP_COLUMN_BAD_SPECTRUM_QUERY-1>(iter->second);
-
-            bytes += size;
-
-            (*pDropTables)[u8QueueIndex]->setCell(src,
-                                                  DROP_COLUMN_BAD_SPECTRUM_QUERY,
-                                                  Any{bytes});
-          }
+          iColumn = DROP_COLUMN_BAD_SPECTRUM_QUERY;
           break;
 
         case InboundAction::DROP_SINR:
-          {
-            auto & bytes = std::get<DROP_COLUMN_SINR-1>(iter->second);
-
-            bytes += size;
-
-            (*pDropTables)[u8QueueIndex]->setCell(src,
-                                                  DROP_COLUMN_SINR,
-                                                  Any{bytes});
-          }
+          iColumn = DROP_COLUMN_SINR;
           break;
 
         case InboundAction::DROP_REGISTRATION_ID:
-          {
-            auto & bytes = std::get<DROP_COLUMN_REG_ID-1>(iter->second);
-
-            bytes += size;
-
-            (*pDropTables)[u8QueueIndex]->setCell(src,
-                                                  DROP_COLUMN_REG_ID,
-                                                  Any{bytes});
-          }
+          iColumn = DROP_COLUMN_REG_ID;
           break;
 
         case InboundAction::DROP_DESTINATION_MAC:
-          {
-            auto & bytes = std::get<DROP_COLUMN_DST_MAC-1>(iter->second);
-
-            bytes += size;
-
-            (*pDropTables)[u8QueueIndex]->setCell(src,
-                                                  DROP_COLUMN_DST_MAC,
-                                                  Any{bytes});
-          }
+          iColumn = DROP_COLUMN_DST_MAC;
           break;
-        case InboundAction::DROP_TOO_LONG:
-          {
-            auto & bytes = std::get<DROP_COLUMN_TOO_LONG-1>(iter->second);
-
-            bytes += size;
 
-            (*pDropTables)[u8QueueIndex]->setCell(src,
-                                                  DROP_COLUMN_TOO_LONG,
-                                                  Any{bytes});
-          }
+        case InboundAction::DROP_TOO_LONG:
+          iColumn = DROP_COLUMN_TOO_LONG;
           break;
-        case InboundAction::DROP_FREQUENCY:
-          {
-            auto & bytes = std::get<DROP_COLUMN_FREQUENCY-1>(iter->second);
 
-            bytes += size;
-
-            (*pDropTables)[u8QueueIndex]->setCell(src,
-                                                  DROP_COLUMN_FREQUENCY,
-                                                  Any{bytes});
-          }
+        case InboundAction::DROP_FREQUENCY:
+          iColumn = DROP_COLUMN_FREQUENCY;
           break;
 
         default:
           break;
         }
+
+      auto & tables = bBroadcast ? broadcastDropTables_ : unicastDropTables_;
+
+      tables[u8QueueIndex]->updateRow(src,
+                                      [size,iColumn](PacketDropRow & row)
+                                      {
+                                        if(iColumn)
+                                          {
+                                            row[iColumn-1] += size;
+                                          }
+                                      });
     }
 }
 
@@ -379,132 +260,70 @@ void EMANE::Models::TDMA::PacketStatusPublisherImpl::outbound(NEMId src,
                                                               size_t size,
                                                               OutboundAction action)
 {
-  TableArray * pAcceptTables{};
-  TableArray * pDropTables{};
-
-  AcceptInfoArrary * pAcceptInfos{};
-  DropInfoArrary  * pDropInfos{};
-
-  std::mutex * pMutexAcceptTable = {};
-  std::mutex * pMutexDropTable = {};
-
-  if(dst == NEM_BROADCAST_MAC_ADDRESS)
-    {
-      pAcceptTables = &broadcastAcceptTables_;
-      pDropTables = &broadcastDropTables_;
-
-      pAcceptInfos = &broadcastAcceptInfos_;
-      pDropInfos = &broadcastDropInfos_;
-
-      pMutexAcceptTable = &mutexBroadcastPacketAcceptTable_;
-      pMutexDropTable = &mutexBroadcastPacketDropTable_;
-    }
-  else
-    {
-      pAcceptTables = &unicastAcceptTables_;
-      pDropTables = &unicastDropTables_;
-
-      pAcceptInfos = &unicastAcceptInfos_;
-      pDropInfos = &unicastDropInfos_;
-
-      pMutexAcceptTable = &mutexUnicastPacketAcceptTable_;
-      pMutexDropTable = &mutexUnicastPacketDropTable_;
-    }
+  bool bBroadcast{dst == NEM_BROADCAST_MAC_ADDRESS};
 
   // detetmine the relevant queue based on priority
   std::uint8_t u8QueueIndex{priorityToQueue(priority)};
 
-
   if(action == OutboundAction::ACCEPT_GOOD)
     {
-      std::lock_guard<std::mutex> m(*pMutexAcceptTable);
-
-      auto iter = (*pAcceptInfos)[u8QueueIndex].find(src);
-
-      if(iter == (*pAcceptInfos)[u8QueueIndex].end())
-        {
-          iter = (*pAcceptInfos)[u8QueueIndex].insert({src,{}}).first;
-
-
-          (*pAcceptTables)[u8QueueIndex]->addRow(src,
-                                                 {Any{src},
-                                                     Any{0L},
-                                                       Any{0L}});
-        }
-
-      auto & bytes = std::get<ACCEPT_COLUMN_NUM_BYTES_TX-1>(iter->second);
+      auto & tables = bBroadcast ? broadcastAcceptTables_ : unicastAcceptTables_;
 
-      bytes += size;
-
-      (*pAcceptTables)[u8QueueIndex]->setCell(src,
-                                              ACCEPT_COLUMN_NUM_BYTES_TX,
-                                              Any{bytes});
+      tables[u8QueueIndex]->updateRow(src,
+                                      [size](PacketAcceptRow & row)
+                                      {
+                                        row.u64BytesTx += size;
+                                      });
     }
   else
     {
-      std::lock_guard<std::mutex> m(*pMutexDropTable);
-
-      auto iter = (*pDropInfos)[u8QueueIndex].find(src);
-
-      if(iter == (*pDropInfos)[u8QueueIndex].end())
-        {
-          iter = (*pDropInfos)[u8QueueIndex].insert({src,{}}).first;
-
-          (*pDropTables)[u8QueueIndex]->addRow(src,
-                                               {Any{src},
-                                                   Any{0L},
-                                                     Any{0L},
-                                                       Any{0L},
-                                                         Any{0L},
-                                                           Any{0L},
-                                                             Any{0L},
-                                                               Any{0L},
-                                                                 Any{0L},
-                                                                   Any{0L},
-                                                                     Any{0L},
-                                                                       Any{0L},
-                                                                         Any{0L}});
-        }
+      int iColumn{};
 
       switch(action)
         {
         case OutboundAction::DROP_TOO_BIG:
-          {
-            auto & bytes = std::get<DROP_COLUMN_TOO_BIG-1>(iter->second);
-
-            bytes += size;
-
-            (*pDropTables)[u8QueueIndex]->setCell(src,
-                                                  DROP_COLUMN_TOO_BIG,
-                                                  Any{bytes});
-          }
+          iColumn = DROP_COLUMN_TOO_BIG;
           break;
-        case OutboundAction::DROP_OVERFLOW:
-          {
-            auto & bytes = std::get<DROP_COLUMN_QUEUE_OVERFLOW-1>(iter->second);
 
-            bytes += size;
-
-            (*pDropTables)[u8QueueIndex]->setCell(src,
-                                                  DROP_COLUMN_QUEUE_OVERFLOW,
-                                                  Any{bytes});
-          }
+        case OutboundAction::DROP_OVERFLOW:
+          iColumn = DROP_COLUMN_QUEUE_OVERFLOW;
           break;
-        case OutboundAction::DROP_FLOW_CONTROL:
-          {
-            auto & bytes = std::get<DROP_COLUMN_FLOW_CONTROL-1>(iter->second);
 
-            bytes += size;
+        case OutboundAction::DROP_FLOW_CONTROL:
+          iColumn = DROP_COLUMN_FLOW_CONTROL;
+          break;
 
-            (*pDropTables)[u8QueueIndex]->setCell(src,
-                                                  DROP_COLUMN_FLOW_CONTROL,
-                                                  Any{bytes});
+        case OutboundAction::DROP_TX_PREPARED:
+          {
+            iColumn = DROP_COLUMN_TX_PREPARED;
+
+            // bytes were accepted when dequeued for the prepared
+            // transmission, tables may have been cleared since
+            auto & tables = bBroadcast ? broadcastAcceptTables_ : unicastAcceptTables_;
+
+            tables[u8QueueIndex]->updateRow(src,
+                                            [size](PacketAcceptRow & row)
+                                            {
+                                              row.u64BytesTx -= std::min(row.u64BytesTx,
+                                                                         static_cast<std::uint64_t>(size));
+                                            });
           }
           break;
 
         default:
           break;
         }
+
+      auto & tables = bBroadcast ? broadcastDropTables_ : unicastDropTables_;
+
+      tables[u8QueueIndex]->updateRow(src,
+                                      [size,iColumn](PacketDropRow & row)
+                                      {
+                                        if(iColumn)
+                                          {
+                                            row[iColumn-1] += size;
+                                          }
+                                      });
     }
 }
 
@@ -517,7 +336,7 @@ void EMANE::Models::TDMA::PacketStatusPublisherImpl::outbound(NEMId src,
       outbound(src,
                component.getDestination(),
                component.getPriority(),
-               component.getData().size(),
+               component.getDataSize(),
                action);
     }
 }
@@ -34,9 +34,9 @@
 #include "emane/configurationexception.h"
 #include "emane/utils/parameterconvert.h"
 
-#include <cmath>
 #include <cstdlib>
-#include <limits>
+#include <map>
+#include <set>
 
 #include <libxml/parser.h>
 #include <libxml/xmlschemas.h>
@@ -121,10 +121,23 @@ namespace
 }
 
 EMANE::Models::TDMA::PORManager::PORManager():
-  u64DefaultCurveDataRate_{},
-  modifierLengthBytes_{}{}
+  pDefaultCurve_{}{}
 
 void EMANE::Models::TDMA::PORManager::load(const std::string & sPCRFileName)
+{
+  pCurveTable_ = Utils::loadPCRCurveTable("tdmabasemodel-pcr",
+                                          sPCRFileName,
+                                          [&sPCRFileName]()
+                                          {
+                                            return parse(sPCRFileName);
+                                          });
+
+  // first curve defined serves as the default curve
+  pDefaultCurve_ = pCurveTable_->getCurve(pCurveTable_->getKeys().front());
+}
+
+EMANE::Utils::PCRCurveTable
+EMANE::Models::TDMA::PORManager::parse(const std::string & sPCRFileName)
 {
   xmlDocPtr pSchemaDoc{xmlReadMemory(pzSchema,
                                      strlen(pzSchema),
@@ -171,10 +184,14 @@ void EMANE::Models::TDMA::PORManager::load(const std::string & sPCRFileName)
 
   xmlChar * pPacketSize = xmlGetProp(pRoot,BAD_CAST "packetsize");
 
-  modifierLengthBytes_ = Utils::ParameterConvert(reinterpret_cast<const char *>(pPacketSize)).toUINT16();
+  size_t modifierLengthBytes{Utils::ParameterConvert(reinterpret_cast<const char *>(pPacketSize)).toUINT16()};
 
   xmlFree(pPacketSize);
 
+  std::set<std::uint64_t> dataRates{};
+
+  Utils::PCRCurveTable::Curves curves{};
+
   for(xmlNodePtr pDataRateNode = pRoot->children;
       pDataRateNode != nullptr;
       pDataRateNode = pDataRateNode->next)
@@ -188,14 +205,7 @@ void EMANE::Models::TDMA::PORManager::load(const std::string & sPCRFileName)
 
           xmlFree(pDataRatebps);
 
-          if(dataRateTable_.empty())
-            {
-              u64DefaultCurveDataRate_ = u64DataRatebps;
-            }
-
-          Curve curve{};
-          std::int32_t i32MinScaledSINR{std::numeric_limits<std::int32_t>::max()};
-          std::int32_t i32MaxScaledSINR{std::numeric_limits<std::int32_t>::lowest()};
+          std::map<std::int32_t,float> curve{}; // scaled sinr, por
 
           for(xmlNodePtr pEntryNode = pDataRateNode->children;
               pEntryNode != nullptr;
@@ -223,57 +233,32 @@ void EMANE::Models::TDMA::PORManager::load(const std::string & sPCRFileName)
 
                   xmlFree(pSINR);
                   xmlFree(pPOR);
-
-                  i32MinScaledSINR = std::min(i32ScaledSINR,i32MinScaledSINR);
-                  i32MaxScaledSINR = std::max(i32ScaledSINR,i32MaxScaledSINR);
                 }
             }
 
-          Curve interpolation{};
-
-          auto iter = curve.begin();
-
-          while(iter != curve.end())
+          if(!dataRates.insert(u64DataRatebps).second)
             {
-              auto x0 = iter->first;
-              auto y0 = iter->second;
-
-              ++iter;
-
-              if(iter != curve.end())
-                {
-                  auto x1 = iter->first;
-                  auto y1 = iter->second;
-
-                  auto slope = (y1 - y0) / (x1 - x0);
-
-                  for(auto i = x0; i < x1; ++i)
-                    {
-                      interpolation.insert({i,y1 - (x1 - i) * slope});
-                    }
-                }
+              throw makeException<ConfigurationException>("duplicate PCR datarate: %zu in %s",
+                                                          u64DataRatebps,
+                                                          sPCRFileName.c_str());
             }
 
-          curve.insert(interpolation.begin(),interpolation.end());
-
-          auto ret = dataRateTable_.insert(std::make_pair(u64DataRatebps,
-                                                          std::make_tuple(i32MinScaledSINR,
-                                                                          i32MaxScaledSINR,
-                                                                          curve)));
+          Utils::PCRCurve::Points points{};
 
-          if(!ret.second)
+          for(const auto & entry : curve)
             {
-              throw makeException<ConfigurationException>("duplicate PCR datarate: %zu in %s",
-                                                          u64DataRatebps,
-                                                          sPCRFileName.c_str());
+              points.push_back({entry.first / 100.0f,entry.second});
             }
 
+          curves.push_back({u64DataRatebps,points});
         }
     }
 
   xmlFreeDoc(pSchemaDoc);
 
   xmlFreeDoc(pDoc);
+
+  return {curves,modifierLengthBytes};
 }
 
 
@@ -281,44 +266,14 @@ float EMANE::Models::TDMA::PORManager::getPOR(std::uint64_t u64DataRatebps,
                                               float fSINR,
                                               size_t packetLengthBytes)
 {
-  auto iter = dataRateTable_.find(u64DataRatebps);
-
-  if(iter == dataRateTable_.end())
-    {
-      iter = dataRateTable_.find(u64DefaultCurveDataRate_);
-    }
-
-  std::int32_t i32MinScaledSINR = std::get<0>(iter->second);
-  std::int32_t i32MaxScaledSINR = std::get<1>(iter->second);
-  Curve & curve = std::get<2>(iter->second);
-
-  std::int32_t i32Scaled{static_cast<std::int32_t>(fSINR * 100)};
-
-  if(i32Scaled < i32MinScaledSINR)
-    {
-      return 0;
-    }
+  auto pCurve = pCurveTable_->getCurve(u64DataRatebps);
 
-  if(i32Scaled > i32MaxScaledSINR)
+  if(!pCurve)
     {
-      return 1;
+      pCurve = pDefaultCurve_;
     }
 
-  auto curveIter = curve.find(i32Scaled);
-
-  if(curveIter != curve.end())
-    {
-      auto por = curveIter->second;
-
-      if(modifierLengthBytes_)
-        {
-          por = powf(por, packetLengthBytes / static_cast<float>(modifierLengthBytes_));
-        }
-
-      return por;
-    }
-
-  return 0;
+  return pCurveTable_->getPOR(*pCurve,fSINR,packetLengthBytes);
 }
 
 EMANE::Models::TDMA::PORManager::CurveDumps
@@ -326,16 +281,20 @@ EMANE::Models::TDMA::PORManager::PORManager::dump()
 {
   CurveDumps ret{};
 
-  for(const auto & dataRateEntry : dataRateTable_)
+  for(const auto & u64DataRatebps : pCurveTable_->getKeys())
     {
       CurveDump entries{};
 
-      for(const auto & porEntry : std::get<2>(dataRateEntry.second))
+      auto pCurve = pCurveTable_->getCurve(u64DataRatebps);
+
+      auto i32ScaledSINR = pCurve->getMinScaledSINR();
+
+      for(const auto & por : pCurve->getPORs())
         {
-          entries.insert({porEntry.first / 100.0, porEntry.second});
+          entries.insert({i32ScaledSINR++ / 100.0, por});
         }
 
-      ret.insert({dataRateEntry.first,entries});
+      ret.insert({u64DataRatebps,entries});
     }
 
   return ret;
@@ -33,9 +33,10 @@
 #ifndef EMANEMODELSTDMAPORMANAGER_HEADER_
 #define EMANEMODELSTDMAPORMANAGER_HEADER_
 
+#include "emane/utils/pcrcurve.h"
+
 #include <string>
 #include <map>
-#include <tuple>
 #include <cstdint>
 
 namespace EMANE
@@ -53,6 +54,9 @@ namespace EMANE
        * PCR curves are defined per data rate, with the first curve
        * defined also serving as the default curve used when a POR is
        * requested for an undefined data rate.
+       *
+       * Curves are compiled into fixed-step interpolated arrays and
+       * shared by all instances loading the same file.
        */
       class PORManager
       {
@@ -70,14 +74,10 @@ namespace EMANE
         CurveDumps dump();
 
       private:
-        using Curve =  std::map<std::int32_t,float>; // sinr, por
-        using DataRateTable = std::map<std::uint64_t, // data rate
-                                       std::tuple<std::int32_t, // min SINR
-                                                  std::int32_t, // max SINR
-                                                  Curve>>;
-        DataRateTable dataRateTable_;
-        std::uint64_t u64DefaultCurveDataRate_;
-        size_t modifierLengthBytes_;
+        Utils::PCRCurveTablePtr pCurveTable_;
+        const Utils::PCRCurve * pDefaultCurve_;
+
+        static Utils::PCRCurveTable parse(const std::string & sPCRFileName);
       };
     }
   }
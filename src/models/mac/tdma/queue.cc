@@ -159,6 +159,10 @@ std::tuple<EMANE::Models::TDMA::MessageComponents,
                     }
                   else
                     {
+                      // the component takes ownership of the packet and
+                      // references its data instead of copying it
+                      std::shared_ptr<const void> pStorage{pPacket};
+
                       components.push_back({bIsControl_ ?
                             MessageComponent::Type::CONTROL :
                             MessageComponent::Type::DATA,
@@ -168,10 +172,14 @@ std::tuple<EMANE::Models::TDMA::MessageComponents,
                             pMetaInfo->index_,
                             pMetaInfo->offset_,
                             entry->first,
-                            false});
+                            false,
+                            std::move(pStorage)});
 
 
                       totalBytes += pPacket->length() - pMetaInfo->offset_;
+
+                      // ownership transferred, nothing to delete below
+                      pPacket = nullptr;
                     }
 
                   delete pPacket;
@@ -259,6 +267,10 @@ std::tuple<EMANE::Models::TDMA::MessageComponents,
                 }
               else
                 {
+                  // the component takes ownership of the packet and
+                  // references its data instead of copying it
+                  std::shared_ptr<const void> pStorage{pPacket};
+
                   components.push_back({bIsControl_ ?
                         MessageComponent::Type::CONTROL :
                         MessageComponent::Type::DATA,
@@ -268,9 +280,13 @@ std::tuple<EMANE::Models::TDMA::MessageComponents,
                         pMetaInfo->index_,
                         pMetaInfo->offset_,
                         entry->first,
-                        false});
+                        false,
+                        std::move(pStorage)});
 
                   totalBytes += pPacket->length() - pMetaInfo->offset_;
+
+                  // ownership transferred, nothing to delete below
+                  pPacket = nullptr;
                 }
 
               delete pPacket;
@@ -339,7 +355,7 @@ std::tuple<EMANE::Models::TDMA::MessageComponents,
   // already accounted for
   currentBytes_ -= totalBytes;
 
-  return std::make_tuple(components,totalBytes,std::move(dropped));
+  return std::make_tuple(std::move(components),totalBytes,std::move(dropped));
 }
 
 std::pair<EMANE::Models::TDMA::MessageComponent,size_t>
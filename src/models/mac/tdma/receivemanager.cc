@@ -284,8 +284,6 @@ EMANE::Models::TDMA::ReceiveManager::process(std::uint64_t u64AbsoluteSlotIndex)
              (dst == id_) ||
              (dst == NEM_BROADCAST_MAC_ADDRESS))
             {
-              const auto & data = message.getData();
-
               if(message.isFragment())
                 {
                   LOGGER_VERBOSE_LOGGING(*pLogService_,
@@ -298,7 +296,7 @@ EMANE::Models::TDMA::ReceiveManager::process(std::uint64_t u64AbsoluteSlotIndex)
                                          pktInfo.getDestination(),
                                          message.getFragmentIndex(),
                                          message.getFragmentOffset(),
-                                         data.size(),
+                                         message.getDataSize(),
                                          message.isMoreFragments() ? "yes" : "no");
 
 
@@ -404,13 +402,12 @@ EMANE::Models::TDMA::ReceiveManager::process(std::uint64_t u64AbsoluteSlotIndex)
                                          pktInfo.getDestination());
 
 
-                  auto data = message.getData();
-
+                  // single copy from the component data into the packet
                   UpstreamPacket pkt{{pktInfo.getSource(),
                         dst,
                         priority,
                         pktInfo.getCreationTime(),
-                        pktInfo.getUUID()},&data[0],data.size()};
+                        pktInfo.getUUID()},message.getVectorIO()};
 
 
                   pPacketStatusPublisher_->inbound(pktInfo.getSource(),
@@ -323,7 +323,14 @@ void EMANE::Models::CommEffect::Shim::processUpstreamPacket(UpstreamPacket & pkt
 
   const PacketInfo & pktInfo = pkt.getPacketInfo();
 
-  CommonPHYHeader commonPHYHeader(pkt);
+  auto pCommonPHYHeader = pkt.stripCommonPHYHeader();
+
+  if(!pCommonPHYHeader)
+    {
+      pCommonPHYHeader = std::make_shared<const CommonPHYHeader>(pkt);
+    }
+
+  const CommonPHYHeader & commonPHYHeader{*pCommonPHYHeader};
 
   // check phy type
   if(commonPHYHeader.getRegistrationId() != REGISTERED_EMANE_PHY_COMM_EFFECT)
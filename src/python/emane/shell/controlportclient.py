@@ -153,6 +153,8 @@ class ControlPortClient:
 
         self._eventMap = {}
         self._responseMap = {}
+        self._subscriptionMap = {}
+        self._pendingSubscriptionMap = {}
         self._sequence = 0
         self._lock = threading.Lock()
         self._read,self._write = os.pipe()
@@ -362,17 +364,94 @@ class ControlPortClient:
 
 
 
-    def _sendMessage(self,request):
+    def subscribe(self,interval,callback,statistics = {},tables = {},maxValues = 0):
+        """Subscribe to statistic element and table changes.
+
+        statistics and tables map a buildId to a sequence of names,
+        an empty sequence selects all. interval is in
+        milliseconds. callback is called from the receive thread
+        with (subscriptionId,statistics,tables,complete) where
+        statistics maps buildId to {name:value} and tables maps
+        buildId to {name:(labels,rows)} for changed values only.
+        """
+        request = remotecontrolportapi_pb2.Request()
+        request.type = remotecontrolportapi_pb2.Request.TYPE_REQUEST_SUBSCRIBE
+        request.subscribe.intervalMilliseconds = interval
+        request.subscribe.maxValues = maxValues
+
+        for buildId,names in list(statistics.items()):
+            statistic = request.subscribe.statistics.add()
+            statistic.buildId = buildId
+            for name in names:
+                statistic.names.append(name)
+
+        for buildId,names in list(tables.items()):
+            table = request.subscribe.statisticTables.add()
+            table.buildId = buildId
+            for name in names:
+                table.names.append(name)
+
+        response = self._sendMessage(request,callback)
+
+        if response.type == remotecontrolportapi_pb2.Response.TYPE_RESPONSE_SUBSCRIBE:
+            return response.subscribe.subscriptionId
+        else:
+            raise ControlPortException('malformed subscribe response')
+
+
+    def unsubscribe(self,subscriptionId):
+        request = remotecontrolportapi_pb2.Request()
+        request.type = remotecontrolportapi_pb2.Request.TYPE_REQUEST_UNSUBSCRIBE
+        request.unsubscribe.subscriptionId = subscriptionId
+
+        response = self._sendMessage(request)
+
+        if response.type == remotecontrolportapi_pb2.Response.TYPE_RESPONSE_UNSUBSCRIBE:
+            self._lock.acquire()
+
+            if subscriptionId in self._subscriptionMap:
+                del self._subscriptionMap[subscriptionId]
+
+            self._lock.release()
+        else:
+            raise ControlPortException('malformed unsubscribe response')
+
+
+    def _publish(self,callback,publish):
+        statistics = {}
+        for statistic in publish.statistics:
+            elements = statistics.setdefault(statistic.buildId,{})
+            for element in statistic.elements:
+                elements[element.name] = fromAny(element.value)
+
+        tables = {}
+        for statisticTable in publish.statisticTables:
+            entries = tables.setdefault(statisticTable.buildId,{})
+            for table in statisticTable.tables:
+                tableData = []
+                for row in table.rows:
+                    tableData.append(tuple([fromAny(value) for value in row.values]))
+                entries[table.name] = (tuple(table.labels),tuple(tableData))
+
+        callback(publish.subscriptionId,statistics,tables,publish.complete)
+
+
+    def _sendMessage(self,request,callback=None):
         self._lock.acquire()
 
         if not self._connected:
             self._lock.release()
             raise ControlPortException('connection terminated by server',True)
 
-        sequence = ++self._sequence
+        self._sequence += 1
+
+        sequence = self._sequence
 
         request.sequence = sequence
 
+        if callback:
+            self._pendingSubscriptionMap[sequence] = callback
+
         msg = request.SerializeToString()
 
         self._sock.send(struct.pack("!L%ds" % len(msg),len(msg),msg))
@@ -394,6 +473,8 @@ class ControlPortClient:
 
             del self._eventMap[sequence]
 
+            self._pendingSubscriptionMap.pop(sequence,None)
+
             self._lock.release()
 
             if response.type == remotecontrolportapi_pb2.Response.TYPE_RESPONSE_ERROR:
@@ -444,12 +525,26 @@ class ControlPortClient:
 
                             self._lock.acquire()
 
-                            if response.reference in self._eventMap:
+                            callback = None
+
+                            if response.type == remotecontrolportapi_pb2.Response.TYPE_RESPONSE_PUBLISH:
+                                callback = self._subscriptionMap.get(response.publish.subscriptionId)
+
+                            elif response.reference in self._eventMap:
+                                # register the callback before any publication is processed
+                                if response.type == remotecontrolportapi_pb2.Response.TYPE_RESPONSE_SUBSCRIBE and \
+                                   response.reference in self._pendingSubscriptionMap:
+                                    self._subscriptionMap[response.subscribe.subscriptionId] = \
+                                        self._pendingSubscriptionMap[response.reference]
+
                                 self._responseMap[response.reference] = response
                                 self._eventMap[response.reference].set()
 
                             self._lock.release()
 
+                            if callback:
+                                self._publish(callback,response.publish)
+
                             messageLengthBytes = 0
                             buffer = bytes() if sys.version_info >= (3,0) else ""
 
@@ -41,7 +41,11 @@ EMANE::Transports::Ethernet::EthernetTransport::EthernetTransport(NEMId id,
   Transport(id, pPlatformService),
   bBroadcastMode_(false),
   bArpCacheMode_(true),
-  u8EtherTypeARPPriority_{}
+  u8EtherTypeARPPriority_{},
+  flowCache_{},
+  u64FlowCacheGeneration_{1},
+  pNumFlowCacheHits_{},
+  pNumFlowCacheMisses_{}
 { }
 
 
@@ -49,6 +53,20 @@ EMANE::Transports::Ethernet::EthernetTransport::~EthernetTransport()
 { }
 
 
+void EMANE::Transports::Ethernet::EthernetTransport::registerStatistics(StatisticRegistrar & statisticRegistrar)
+{
+  pNumFlowCacheHits_ =
+    statisticRegistrar.registerNumeric<std::uint64_t>("numFlowCacheHits",
+                                                      StatisticProperties::CLEARABLE,
+                                                      "Number of downstream frames classified from the flow cache.");
+
+  pNumFlowCacheMisses_ =
+    statisticRegistrar.registerNumeric<std::uint64_t>("numFlowCacheMisses",
+                                                      StatisticProperties::CLEARABLE,
+                                                      "Number of downstream frames requiring full classification.");
+}
+
+
 int EMANE::Transports::Ethernet::EthernetTransport::verifyFrame(const void * buf, size_t len)
 {
    // check min header len
@@ -168,6 +186,65 @@ int EMANE::Transports::Ethernet::EthernetTransport::verifyFrame(const void * buf
 int EMANE::Transports::Ethernet::EthernetTransport::parseFrame(const Utils::EtherHeader *pEthHeader,
                                                                NEMId & rNemDestination,
                                                                std::uint8_t & rDspc)
+{
+  // eth protocol
+  const std::uint16_t u16ethProtocol = Utils::get_protocol(pEthHeader);
+
+  std::uint8_t u8TrafficClass{};
+
+  if(u16ethProtocol == Utils::ETH_P_IPV4)
+    {
+      u8TrafficClass = Utils::get_dscp((Utils::Ip4Header*) ((Utils::EtherHeader*) pEthHeader + 1));
+    }
+  else if(u16ethProtocol == Utils::ETH_P_IPV6)
+    {
+      u8TrafficClass = Utils::get_dscp((Utils::Ip6Header*) ((Utils::EtherHeader*) pEthHeader + 1));
+    }
+
+  // read before classifying so that a mapping learned meanwhile
+  // leaves the new entry stale
+  const std::uint64_t u64Generation{u64FlowCacheGeneration_.load(std::memory_order_acquire)};
+
+  const std::uint32_t u32Key = (static_cast<std::uint32_t>(pEthHeader->dst.words.word3) << 16 |
+                                pEthHeader->dst.words.word2) ^
+    (static_cast<std::uint32_t>(u16ethProtocol) << 8 | u8TrafficClass);
+
+  FlowCacheEntry & entry = flowCache_[(u32Key * 0x9E3779B1U) >> 24];
+
+  if(entry.u64Generation_ == u64Generation &&
+     entry.u16EtherType_ == u16ethProtocol &&
+     entry.u8TrafficClass_ == u8TrafficClass &&
+     !memcmp(&entry.dst_, &pEthHeader->dst, Utils::ETH_ALEN))
+    {
+      ++*pNumFlowCacheHits_;
+
+      rNemDestination = entry.nemDestination_;
+
+      rDspc = entry.u8Priority_;
+
+      return entry.iResult_;
+    }
+
+  ++*pNumFlowCacheMisses_;
+
+  const int iResult{classifyFrame(pEthHeader, rNemDestination, rDspc)};
+
+  entry.dst_ = pEthHeader->dst;
+  entry.u16EtherType_ = u16ethProtocol;
+  entry.u8TrafficClass_ = u8TrafficClass;
+  entry.u8Priority_ = rDspc;
+  entry.nemDestination_ = rNemDestination;
+  entry.iResult_ = iResult;
+  entry.u64Generation_ = u64Generation;
+
+  return iResult;
+}
+
+
+
+int EMANE::Transports::Ethernet::EthernetTransport::classifyFrame(const Utils::EtherHeader *pEthHeader,
+                                                                  NEMId & rNemDestination,
+                                                                  std::uint8_t & rDspc)
 {
    // eth protocol
   const std::uint16_t u16ethProtocol = Utils::get_protocol(pEthHeader);
@@ -372,6 +449,9 @@ void EMANE::Transports::Ethernet::EthernetTransport::addEntry(const Utils::Ether
     {
       macCache_.insert(std::make_pair(addr, nemId));
 
+      // invalidate memoized destinations
+      u64FlowCacheGeneration_.fetch_add(1, std::memory_order_release);
+
       LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
                              DEBUG_LEVEL,
                              "TRANSPORTI %03d ARPCache::%s added cache entry %s to nem %hu",
@@ -393,6 +473,9 @@ void EMANE::Transports::Ethernet::EthernetTransport::addEntry(const Utils::Ether
                                 iter->second, nemId);
          // updated nem id
          iter->second = nemId;
+
+         // invalidate memoized destinations
+         u64FlowCacheGeneration_.fetch_add(1, std::memory_order_release);
        }
     }
 }
@@ -36,10 +36,14 @@
 #define ETHERNETTRANSPORT_HEADER_
 
 #include "emane/transport.h"
+#include "emane/statisticnumeric.h"
+#include "emane/statisticregistrar.h"
 #include "emane/utils/netutils.h"
 
 #include <mutex>
 #include <map>
+#include <array>
+#include <atomic>
 
 namespace EMANE
 {
@@ -61,6 +65,24 @@ namespace EMANE
         ~EthernetTransport();
 
       protected:
+        /**
+         * Registers the flow cache statistics
+         *
+         * @param statisticRegistrar Statistic registrar
+         */
+        void registerStatistics(StatisticRegistrar & statisticRegistrar);
+
+        /**
+         * Gets the NEM destination and priority of a frame. Results
+         * are memoized by destination address, ethertype and DSCP
+         * until the ARP cache learns or changes a mapping.
+         *
+         * @param pEthHeader Frame
+         * @param dst NEM destination
+         * @param dscp Priority
+         *
+         * @return 0 for a known ethertype, 1 for an unknown ethertype
+         */
         virtual int parseFrame(const Utils::EtherHeader *pEthHeader,
                                EMANE::NEMId & dst,
                                std::uint8_t & dscp);
@@ -106,6 +128,32 @@ namespace EMANE
         using EthAddrMap = std::map<Utils::EtherAddr, EMANE::NEMId, ltmacaddr>;
 
         EthAddrMap macCache_;
+
+        struct FlowCacheEntry
+        {
+          Utils::EtherAddr dst_;
+          std::uint16_t u16EtherType_;
+          std::uint8_t u8TrafficClass_;
+          std::uint8_t u8Priority_;
+          EMANE::NEMId nemDestination_;
+          int iResult_;
+          std::uint64_t u64Generation_;
+        };
+
+        static constexpr std::size_t FLOW_CACHE_SIZE{256};
+
+        // only used by the device read thread
+        std::array<FlowCacheEntry,FLOW_CACHE_SIZE> flowCache_;
+
+        // entries from an older generation are stale, 0 is never valid
+        std::atomic<std::uint64_t> u64FlowCacheGeneration_;
+
+        StatisticNumeric<std::uint64_t> * pNumFlowCacheHits_;
+        StatisticNumeric<std::uint64_t> * pNumFlowCacheMisses_;
+
+        int classifyFrame(const Utils::EtherHeader *pEthHeader,
+                          EMANE::NEMId & dst,
+                          std::uint8_t & dscp);
       };
     }
   }
@@ -0,0 +1,436 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "packetring.h"
+
+#include "emane/startexception.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include <net/if.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <linux/if_ether.h>
+#include <linux/if_packet.h>
+
+namespace
+{
+  // receive frame slot size used to size the TPACKET_V3 request,
+  // frames themselves are variable length within a block
+  const std::uint32_t RX_FRAME_SIZE{2048};
+
+  // longest wait for a transmit slot to be released by the kernel
+  const int TX_SLOT_WAIT_MILLISECONDS{100};
+
+  // 802.1Q tag length and its offset within an ethernet frame, used
+  // to re-insert tags stripped by receive VLAN offload
+  const std::uint32_t VLAN_TAG_LEN{4};
+  const std::uint32_t VLAN_OFFSET{2 * ETH_ALEN};
+
+  // offset of frame data within a TPACKET_V2 transmit slot
+  const std::size_t TX_DATA_OFFSET{TPACKET2_HDRLEN - sizeof(sockaddr_ll)};
+
+  std::uint32_t alignUp(std::uint32_t u32Value, std::uint32_t u32Alignment)
+  {
+    return (u32Value + u32Alignment - 1) / u32Alignment * u32Alignment;
+  }
+}
+
+EMANE::Transports::Raw::PacketRing::PacketRing():
+  iRxSocket_{-1},
+  iTxSocket_{-1},
+  pRxRing_{},
+  rxRingSize_{},
+  u32RxBlockSize_{},
+  u32RxBlockCount_{},
+  u32RxBlockIndex_{},
+  pTxRing_{},
+  txRingSize_{},
+  u32TxFrameSize_{},
+  u32TxFrameCount_{},
+  u32TxFrameIndex_{}{}
+
+EMANE::Transports::Raw::PacketRing::~PacketRing()
+{
+  close();
+}
+
+void EMANE::Transports::Raw::PacketRing::open(const std::string & sDevice,
+                                              const Parameters & parameters)
+{
+  close();
+
+  unsigned int uiIndex{if_nametoindex(sDevice.c_str())};
+
+  if(!uiIndex)
+    {
+      throw makeException<StartException>("PacketRing: unknown device %s: %s",
+                                          sDevice.c_str(),
+                                          strerror(errno));
+    }
+
+  auto fail = [this,&sDevice](const char * pzWhat)
+    {
+      int iError{errno};
+
+      close();
+
+      return makeException<StartException>("PacketRing: unable to %s on device %s: %s",
+                                           pzWhat,
+                                           sDevice.c_str(),
+                                           strerror(iError));
+    };
+
+  // receive ring
+  if((iRxSocket_ = socket(AF_PACKET,SOCK_RAW,htons(ETH_P_ALL))) < 0)
+    {
+      throw fail("create receive socket");
+    }
+
+  int iVersion{TPACKET_V3};
+
+  if(setsockopt(iRxSocket_,SOL_PACKET,PACKET_VERSION,&iVersion,sizeof(iVersion)) < 0)
+    {
+      throw fail("set TPACKET_V3");
+    }
+
+  // headroom ahead of each frame for a re-inserted VLAN tag, as
+  // done by libpcap
+  unsigned int uiReserve{VLAN_TAG_LEN};
+
+  if(setsockopt(iRxSocket_,SOL_PACKET,PACKET_RESERVE,&uiReserve,sizeof(uiReserve)) < 0)
+    {
+      throw fail("set receive frame reserve");
+    }
+
+#ifdef PACKET_IGNORE_OUTGOING
+  // best effort, outgoing frames are also skipped when reading
+  int iIgnoreOutgoing{1};
+
+  setsockopt(iRxSocket_,SOL_PACKET,PACKET_IGNORE_OUTGOING,&iIgnoreOutgoing,sizeof(iIgnoreOutgoing));
+#endif
+
+  u32RxBlockSize_ = alignUp(parameters.u32RxBlockSize_,getpagesize());
+  u32RxBlockCount_ = parameters.u32RxBlockCount_;
+
+  tpacket_req3 rxRequest{};
+  rxRequest.tp_block_size = u32RxBlockSize_;
+  rxRequest.tp_block_nr = u32RxBlockCount_;
+  rxRequest.tp_frame_size = RX_FRAME_SIZE;
+  rxRequest.tp_frame_nr = u32RxBlockSize_ / RX_FRAME_SIZE * u32RxBlockCount_;
+  rxRequest.tp_retire_blk_tov = parameters.u32RxBlockTimeoutMilliseconds_;
+
+  if(setsockopt(iRxSocket_,SOL_PACKET,PACKET_RX_RING,&rxRequest,sizeof(rxRequest)) < 0)
+    {
+      throw fail("create receive ring");
+    }
+
+  rxRingSize_ = static_cast<std::size_t>(u32RxBlockSize_) * u32RxBlockCount_;
+
+  void * pRing{mmap(nullptr,rxRingSize_,PROT_READ | PROT_WRITE,MAP_SHARED,iRxSocket_,0)};
+
+  if(pRing == MAP_FAILED)
+    {
+      rxRingSize_ = 0;
+      throw fail("map receive ring");
+    }
+
+  pRxRing_ = static_cast<std::uint8_t *>(pRing);
+
+  sockaddr_ll rxAddress{};
+  rxAddress.sll_family = AF_PACKET;
+  rxAddress.sll_protocol = htons(ETH_P_ALL);
+  rxAddress.sll_ifindex = uiIndex;
+
+  if(bind(iRxSocket_,reinterpret_cast<sockaddr *>(&rxAddress),sizeof(rxAddress)) < 0)
+    {
+      throw fail("bind receive socket");
+    }
+
+  packet_mreq membership{};
+  membership.mr_ifindex = uiIndex;
+  membership.mr_type = PACKET_MR_PROMISC;
+
+  if(setsockopt(iRxSocket_,SOL_PACKET,PACKET_ADD_MEMBERSHIP,&membership,sizeof(membership)) < 0)
+    {
+      throw fail("enable promiscuous mode");
+    }
+
+  // transmit ring, on a socket bound without a protocol so that it
+  // never receives
+  if((iTxSocket_ = socket(AF_PACKET,SOCK_RAW,0)) < 0)
+    {
+      throw fail("create transmit socket");
+    }
+
+  iVersion = TPACKET_V2;
+
+  if(setsockopt(iTxSocket_,SOL_PACKET,PACKET_VERSION,&iVersion,sizeof(iVersion)) < 0)
+    {
+      throw fail("set TPACKET_V2");
+    }
+
+  if(parameters.bQdiscBypass_)
+    {
+#ifdef PACKET_QDISC_BYPASS
+      int iBypass{1};
+
+      if(setsockopt(iTxSocket_,SOL_PACKET,PACKET_QDISC_BYPASS,&iBypass,sizeof(iBypass)) < 0)
+        {
+          throw fail("enable qdisc bypass");
+        }
+#else
+      errno = ENOTSUP;
+      throw fail("enable qdisc bypass");
+#endif
+    }
+
+  u32TxFrameSize_ = alignUp(std::max(parameters.u32TxFrameSize_,
+                                     static_cast<std::uint32_t>(TPACKET2_HDRLEN)),
+                            TPACKET_ALIGNMENT);
+
+  std::uint32_t u32TxBlockSize{alignUp(u32TxFrameSize_,getpagesize())};
+
+  std::uint32_t u32FramesPerBlock{u32TxBlockSize / u32TxFrameSize_};
+
+  std::uint32_t u32TxBlockCount{(parameters.u32TxFrameCount_ + u32FramesPerBlock - 1) / u32FramesPerBlock};
+
+  u32TxFrameCount_ = u32FramesPerBlock * u32TxBlockCount;
+
+  tpacket_req txRequest{};
+  txRequest.tp_block_size = u32TxBlockSize;
+  txRequest.tp_block_nr = u32TxBlockCount;
+  txRequest.tp_frame_size = u32TxFrameSize_;
+  txRequest.tp_frame_nr = u32TxFrameCount_;
+
+  if(setsockopt(iTxSocket_,SOL_PACKET,PACKET_TX_RING,&txRequest,sizeof(txRequest)) < 0)
+    {
+      throw fail("create transmit ring");
+    }
+
+  txRingSize_ = static_cast<std::size_t>(u32TxBlockSize) * u32TxBlockCount;
+
+  pRing = mmap(nullptr,txRingSize_,PROT_READ | PROT_WRITE,MAP_SHARED,iTxSocket_,0);
+
+  if(pRing == MAP_FAILED)
+    {
+      txRingSize_ = 0;
+      throw fail("map transmit ring");
+    }
+
+  pTxRing_ = static_cast<std::uint8_t *>(pRing);
+
+  sockaddr_ll txAddress{};
+  txAddress.sll_family = AF_PACKET;
+  txAddress.sll_ifindex = uiIndex;
+
+  if(bind(iTxSocket_,reinterpret_cast<sockaddr *>(&txAddress),sizeof(txAddress)) < 0)
+    {
+      throw fail("bind transmit socket");
+    }
+}
+
+void EMANE::Transports::Raw::PacketRing::close()
+{
+  if(pRxRing_)
+    {
+      munmap(pRxRing_,rxRingSize_);
+      pRxRing_ = nullptr;
+      rxRingSize_ = 0;
+    }
+
+  if(pTxRing_)
+    {
+      munmap(pTxRing_,txRingSize_);
+      pTxRing_ = nullptr;
+      txRingSize_ = 0;
+    }
+
+  if(iRxSocket_ >= 0)
+    {
+      ::close(iRxSocket_);
+      iRxSocket_ = -1;
+    }
+
+  if(iTxSocket_ >= 0)
+    {
+      ::close(iTxSocket_);
+      iTxSocket_ = -1;
+    }
+
+  u32RxBlockIndex_ = 0;
+  u32TxFrameIndex_ = 0;
+}
+
+bool EMANE::Transports::Raw::PacketRing::isOpen() const
+{
+  return pRxRing_ && pTxRing_;
+}
+
+int EMANE::Transports::Raw::PacketRing::read(const FrameHandler & handler)
+{
+  auto pBlock =
+    reinterpret_cast<tpacket_block_desc *>(pRxRing_ +
+                                           static_cast<std::size_t>(u32RxBlockIndex_) * u32RxBlockSize_);
+
+  while(!(__atomic_load_n(&pBlock->hdr.bh1.block_status,__ATOMIC_ACQUIRE) & TP_STATUS_USER))
+    {
+      pollfd pfd{iRxSocket_,POLLIN | POLLERR,0};
+
+      // blocks here
+      if(poll(&pfd,1,-1) < 0 && errno != EINTR)
+        {
+          return -1;
+        }
+    }
+
+  auto pHeader =
+    reinterpret_cast<tpacket3_hdr *>(reinterpret_cast<std::uint8_t *>(pBlock) +
+                                     pBlock->hdr.bh1.offset_to_first_pkt);
+
+  for(std::uint32_t i = 0; i < pBlock->hdr.bh1.num_pkts; ++i)
+    {
+      auto pAddress =
+        reinterpret_cast<const sockaddr_ll *>(reinterpret_cast<const std::uint8_t *>(pHeader) +
+                                              TPACKET_ALIGN(sizeof(tpacket3_hdr)));
+
+      // inbound only
+      if(pAddress->sll_pkttype != PACKET_OUTGOING)
+        {
+          std::uint8_t * pFrame{reinterpret_cast<std::uint8_t *>(pHeader) + pHeader->tp_mac};
+
+          std::size_t length{pHeader->tp_snaplen};
+
+#ifdef TP_STATUS_VLAN_VALID
+          // re-insert a tag stripped by receive VLAN offload into the
+          // reserved headroom so frames match those seen using pcap
+          if((pHeader->hv1.tp_vlan_tci || (pHeader->tp_status & TP_STATUS_VLAN_VALID)) &&
+             length >= VLAN_OFFSET)
+            {
+              std::uint16_t u16TPID{ETH_P_8021Q};
+
+#ifdef TP_STATUS_VLAN_TPID_VALID
+              if((pHeader->tp_status & TP_STATUS_VLAN_TPID_VALID) && pHeader->hv1.tp_vlan_tpid)
+                {
+                  u16TPID = pHeader->hv1.tp_vlan_tpid;
+                }
+#endif
+              pFrame -= VLAN_TAG_LEN;
+
+              memmove(pFrame,pFrame + VLAN_TAG_LEN,VLAN_OFFSET);
+
+              std::uint16_t tag[2]{htons(u16TPID),htons(pHeader->hv1.tp_vlan_tci)};
+
+              memcpy(pFrame + VLAN_OFFSET,tag,sizeof(tag));
+
+              length += VLAN_TAG_LEN;
+            }
+#endif
+
+          handler(pFrame,length);
+        }
+
+      pHeader =
+        reinterpret_cast<tpacket3_hdr *>(reinterpret_cast<std::uint8_t *>(pHeader) +
+                                         pHeader->tp_next_offset);
+    }
+
+  // return the block to the kernel
+  __atomic_store_n(&pBlock->hdr.bh1.block_status,TP_STATUS_KERNEL,__ATOMIC_RELEASE);
+
+  u32RxBlockIndex_ = (u32RxBlockIndex_ + 1) % u32RxBlockCount_;
+
+  return 0;
+}
+
+int EMANE::Transports::Raw::PacketRing::send(const void * pBuf, std::size_t len)
+{
+  if(len > u32TxFrameSize_ - TX_DATA_OFFSET)
+    {
+      // too large for a slot, the receive socket has no transmit
+      // ring so it can write the frame directly. A blocking kick
+      // first waits for every pending slot to be sent so the frame
+      // cannot overtake them.
+      if(::send(iTxSocket_,nullptr,0,0) < 0)
+        {
+          return -1;
+        }
+
+      return ::send(iRxSocket_,pBuf,len,0) < 0 ? -1 : 0;
+    }
+
+  auto pHeader =
+    reinterpret_cast<tpacket2_hdr *>(pTxRing_ +
+                                     static_cast<std::size_t>(u32TxFrameIndex_) * u32TxFrameSize_);
+
+  std::uint32_t u32Status{__atomic_load_n(&pHeader->tp_status,__ATOMIC_ACQUIRE)};
+
+  if(u32Status != TP_STATUS_AVAILABLE && u32Status != TP_STATUS_WRONG_FORMAT)
+    {
+      // ring is full, wait for the kernel to complete a send
+      pollfd pfd{iTxSocket_,POLLOUT,0};
+
+      if(poll(&pfd,1,TX_SLOT_WAIT_MILLISECONDS) < 0)
+        {
+          return -1;
+        }
+
+      u32Status = __atomic_load_n(&pHeader->tp_status,__ATOMIC_ACQUIRE);
+
+      if(u32Status != TP_STATUS_AVAILABLE && u32Status != TP_STATUS_WRONG_FORMAT)
+        {
+          errno = ENOBUFS;
+          return -1;
+        }
+    }
+
+  memcpy(reinterpret_cast<std::uint8_t *>(pHeader) + TX_DATA_OFFSET,pBuf,len);
+
+  pHeader->tp_len = len;
+
+  __atomic_store_n(&pHeader->tp_status,TP_STATUS_SEND_REQUEST,__ATOMIC_RELEASE);
+
+  u32TxFrameIndex_ = (u32TxFrameIndex_ + 1) % u32TxFrameCount_;
+
+  // a previous kick may still be draining the ring
+  if(::send(iTxSocket_,nullptr,0,MSG_DONTWAIT) < 0 && errno != EAGAIN && errno != ENOBUFS)
+    {
+      return -1;
+    }
+
+  return 0;
+}
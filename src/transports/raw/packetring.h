@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANETRANSPORTSRAWPACKETRING_HEADER_
+#define EMANETRANSPORTSRAWPACKETRING_HEADER_
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <functional>
+
+namespace EMANE
+{
+  namespace Transports
+  {
+    namespace Raw
+    {
+      /**
+       * @class PacketRing
+       *
+       * @brief AF_PACKET memory mapped ring pair used as an alternative
+       * to libpcap for raw device access.
+       *
+       * Frames are received using a TPACKET_V3 PACKET_RX_RING, where the
+       * kernel fills whole blocks of frames that are handed to the
+       * caller with a single wakeup. Frames are transmitted using a
+       * PACKET_TX_RING on a second socket. Outgoing frames seen on the
+       * device are not delivered, matching the pcap PCAP_D_IN
+       * direction filter, and VLAN tags stripped by receive offload
+       * are re-inserted as libpcap does.
+       *
+       * @note read and send may be called from different threads, but
+       * each must only be called from one thread at a time.
+       */
+      class PacketRing
+      {
+      public:
+        /**
+         * @brief Ring sizing parameters
+         */
+        struct Parameters
+        {
+          std::uint32_t u32RxBlockSize_; /**< Receive block size in bytes, a page size multiple*/
+          std::uint32_t u32RxBlockCount_; /**< Number of receive blocks*/
+          std::uint32_t u32RxBlockTimeoutMilliseconds_; /**< Partially filled block retire timeout*/
+          std::uint32_t u32TxFrameSize_; /**< Transmit frame slot size in bytes*/
+          std::uint32_t u32TxFrameCount_; /**< Number of transmit frame slots*/
+          bool bQdiscBypass_; /**< Transmit without the device queuing discipline*/
+        };
+
+        using FrameHandler = std::function<void(const std::uint8_t *, std::size_t)>;
+
+        PacketRing();
+
+        ~PacketRing();
+
+        /**
+         * Opens the receive and transmit rings on a device and places
+         * the device in promiscuous mode
+         *
+         * @param sDevice Device name
+         * @param parameters Ring sizing parameters
+         *
+         * @throw StartException when a socket or ring cannot be created
+         */
+        void open(const std::string & sDevice,
+                  const Parameters & parameters);
+
+        /**
+         * Closes both rings
+         */
+        void close();
+
+        /**
+         * Determines if the rings are open
+         *
+         * @return boolean flag
+         */
+        bool isOpen() const;
+
+        /**
+         * Blocks until the next receive block is ready and passes each
+         * inbound frame in the block to a handler. The block is
+         * returned to the kernel once all frames are handled.
+         *
+         * @param handler Frame handler
+         *
+         * @return 0 on success, -1 on error with errno set
+         */
+        int read(const FrameHandler & handler);
+
+        /**
+         * Copies a frame into the next transmit slot and asks the
+         * kernel to send all pending slots without waiting for
+         * completion. Frames larger than a slot are sent using a
+         * regular socket write once all pending slots are sent.
+         *
+         * @param pBuf Frame
+         * @param len Frame length in bytes
+         *
+         * @return 0 on success, -1 on error with errno set
+         */
+        int send(const void * pBuf, std::size_t len);
+
+      private:
+        int iRxSocket_;
+        int iTxSocket_;
+        std::uint8_t * pRxRing_;
+        std::size_t rxRingSize_;
+        std::uint32_t u32RxBlockSize_;
+        std::uint32_t u32RxBlockCount_;
+        std::uint32_t u32RxBlockIndex_;
+        std::uint8_t * pTxRing_;
+        std::size_t txRingSize_;
+        std::uint32_t u32TxFrameSize_;
+        std::uint32_t u32TxFrameCount_;
+        std::uint32_t u32TxFrameIndex_;
+      };
+    }
+  }
+}
+
+#endif // EMANETRANSPORTSRAWPACKETRING_HEADER_
@@ -1,6 +1,6 @@
 /*
- * Copyright (c) 2013-2014,2016,2023 - Adjacent Link LLC, Bridgewater,
- *  New Jersey
+ * Copyright (c) 2013-2014,2016,2023,2026 - Adjacent Link LLC,
+ *  Bridgewater, New Jersey
  * Copyright (c) 2008-2010 - DRS CenGen, LLC, Columbia, Maryland
  * All rights reserved.
  *
@@ -40,11 +40,13 @@
 #include "emane/startexception.h"
 
 #include "emane/utils/threadutils.h"
+#include "emane/utils/threadplacement.h"
 #include "emane/utils/parameterconvert.h"
 
 #include "emane/controls/serializedcontrolmessage.h"
 
 #include <sstream>
+#include <cstring>
 
 namespace
 {
@@ -76,7 +78,10 @@ EMANE::Transports::Raw::RawTransport::RawTransport(NEMId id,
   thread_{},
   pPcapHandle_{},
   pBitPool_{},
-  u64BitRate_{}
+  u64BitRate_{},
+  backend_{Backend::PCAP},
+  ringParameters_{},
+  packetRing_{}
 {
   memset(&macAddr_, 0x0, sizeof(macAddr_));
 }
@@ -154,6 +159,60 @@ void EMANE::Transports::Raw::RawTransport::initialize(Registrar & registrar)
                                                 " used for IP) to use when an ARP Ethernet"
                                                 " frame is encountered during downstream"
                                                 " processing.");
+
+  configRegistrar.registerNonNumeric<std::string>("backend",
+                                                  ConfigurationProperties::DEFAULT,
+                                                  {"pcap"},
+                                                  "Defines the device access method: pcap or"
+                                                  " ring. The ring backend uses AF_PACKET memory"
+                                                  " mapped TPACKET_V3 receive and PACKET_TX_RING"
+                                                  " transmit rings.",
+                                                  1,
+                                                  1,
+                                                  "^(pcap|ring)$");
+
+  configRegistrar.registerNumeric<std::uint32_t>("ring.rx.blocksize",
+                                                 ConfigurationProperties::DEFAULT,
+                                                 {262144},
+                                                 "Ring backend receive block size in bytes. Rounded"
+                                                 " up to a page size multiple.",
+                                                 4096);
+
+  configRegistrar.registerNumeric<std::uint32_t>("ring.rx.blockcount",
+                                                 ConfigurationProperties::DEFAULT,
+                                                 {64},
+                                                 "Ring backend number of receive blocks.",
+                                                 1);
+
+  configRegistrar.registerNumeric<std::uint32_t>("ring.rx.blocktimeout",
+                                                 ConfigurationProperties::DEFAULT,
+                                                 {1},
+                                                 "Ring backend time in milliseconds after which a"
+                                                 " partially filled receive block is handed to the"
+                                                 " transport.",
+                                                 1);
+
+  configRegistrar.registerNumeric<std::uint32_t>("ring.tx.framesize",
+                                                 ConfigurationProperties::DEFAULT,
+                                                 {2048},
+                                                 "Ring backend transmit slot size in bytes. Frames"
+                                                 " that do not fit in a slot are written directly"
+                                                 " to the device socket.",
+                                                 128);
+
+  configRegistrar.registerNumeric<std::uint32_t>("ring.tx.framecount",
+                                                 ConfigurationProperties::DEFAULT,
+                                                 {1024},
+                                                 "Ring backend number of transmit slots.",
+                                                 1);
+
+  configRegistrar.registerNumeric<bool>("ring.tx.qdiscbypass",
+                                        ConfigurationProperties::DEFAULT,
+                                        {false},
+                                        "Ring backend transmit without the device queuing"
+                                        " discipline (PACKET_QDISC_BYPASS).");
+
+  registerStatistics(registrar.statisticRegistrar());
 }
 
 
@@ -250,6 +309,67 @@ void EMANE::Transports::Raw::RawTransport::configure(const ConfigurationUpdate &
 
             }
         }
+      else if(item.first == "backend")
+        {
+          backend_ = item.second[0].asString() == "ring" ? Backend::RING : Backend::PCAP;
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "TRANSPORTI %03hu RawTransport::%s %s: %s",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  item.second[0].asString().c_str());
+        }
+      else if(item.first == "ring.rx.blocksize" ||
+              item.first == "ring.rx.blockcount" ||
+              item.first == "ring.rx.blocktimeout" ||
+              item.first == "ring.tx.framesize" ||
+              item.first == "ring.tx.framecount")
+        {
+          std::uint32_t u32Value{item.second[0].asUINT32()};
+
+          if(item.first == "ring.rx.blocksize")
+            {
+              ringParameters_.u32RxBlockSize_ = u32Value;
+            }
+          else if(item.first == "ring.rx.blockcount")
+            {
+              ringParameters_.u32RxBlockCount_ = u32Value;
+            }
+          else if(item.first == "ring.rx.blocktimeout")
+            {
+              ringParameters_.u32RxBlockTimeoutMilliseconds_ = u32Value;
+            }
+          else if(item.first == "ring.tx.framesize")
+            {
+              ringParameters_.u32TxFrameSize_ = u32Value;
+            }
+          else
+            {
+              ringParameters_.u32TxFrameCount_ = u32Value;
+            }
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "TRANSPORTI %03hu RawTransport::%s %s: %u",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  u32Value);
+        }
+      else if(item.first == "ring.tx.qdiscbypass")
+        {
+          ringParameters_.bQdiscBypass_ = item.second[0].asBool();
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "TRANSPORTI %03hu RawTransport::%s %s: %d",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  ringParameters_.bQdiscBypass_);
+        }
       else
         {
           throw makeException<ConfigureException>("RawTransport: "
@@ -339,6 +459,18 @@ void EMANE::Transports::Raw::RawTransport::start()
       throw StartException(ssDescription.str());
     }
 
+  pBitPool_->setMaxSize(u64BitRate_);
+
+  if(backend_ == Backend::RING)
+    {
+      packetRing_.open(sDeviceName,ringParameters_);
+
+      // start ring read thread
+      thread_ = std::thread(&RawTransport::readDevice,this);
+
+      return;
+    }
+
   // create pcap handle
   if((pPcapHandle_ = pcap_create(sDeviceName.c_str(), errbuf)) == NULL)
     {
@@ -395,8 +527,6 @@ void EMANE::Transports::Raw::RawTransport::start()
       throw StartException(ssDescription.str());
     }
 
-  pBitPool_->setMaxSize(u64BitRate_);
-
   // start pcap read thread
   thread_ = std::thread(&RawTransport::readDevice,this);
 }
@@ -417,7 +547,11 @@ void EMANE::Transports::Raw::RawTransport::stop()
 
 void EMANE::Transports::Raw::RawTransport::destroy()
   throw()
-{}
+{
+  // the transport queue thread is joined after stop and before
+  // destroy, so the transmit ring is no longer in use
+  packetRing_.close();
+}
 
 
 
@@ -426,7 +560,7 @@ void EMANE::Transports::Raw::RawTransport::processUpstreamPacket(UpstreamPacket
 {
   // we are not in the running state - the infrastructure should protect
   // against this but currently it does not for transports.
-  if(!pPcapHandle_)
+  if(!pPcapHandle_ && !packetRing_.isOpen())
     {
       return;
     }
@@ -453,7 +587,21 @@ void EMANE::Transports::Raw::RawTransport::processUpstreamPacket(UpstreamPacket
   updateArpCache(pEtherHeader, pktInfo.getSource());
 
   // send packet
-  if(pcap_sendpacket(pPcapHandle_, (const std::uint8_t*) pkt.get(), pkt.length()) < 0)
+  if(backend_ == Backend::RING)
+    {
+      if(packetRing_.send(pkt.get(), pkt.length()) < 0)
+        {
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  ERROR_LEVEL,
+                                  "TRANSPORTI %03d RawTransport %s ring send error %s",
+                                  id_,
+                                  __func__,
+                                  strerror(errno));
+
+          return;
+        }
+    }
+  else if(pcap_sendpacket(pPcapHandle_, (const std::uint8_t*) pkt.get(), pkt.length()) < 0)
     {
       LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
                               ERROR_LEVEL,
@@ -461,32 +609,32 @@ void EMANE::Transports::Raw::RawTransport::processUpstreamPacket(UpstreamPacket
                               id_,
                               __func__,
                               pcap_geterr(pPcapHandle_));
+
+      return;
     }
-  else
+
+  LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
+                         DEBUG_LEVEL,
+                         "TRANSPORTI %03d RawTransport %s src %hu, dst %hu, dscp %hhu, length %zu",
+                         id_,
+                         __func__,
+                         pktInfo.getSource(),
+                         pktInfo.getDestination(),
+                         pktInfo.getPriority(),
+                         pkt.length());
+
+  // drain the bit pool converting bytes to bits
+  const size_t sizePending = pBitPool_->get(pkt.length() * 8);
+
+  // check for bitpool error
+  if(sizePending != 0)
     {
-      LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
-                             DEBUG_LEVEL,
-                             "TRANSPORTI %03d RawTransport %s src %hu, dst %hu, dscp %hhu, length %zu",
-                             id_,
-                             __func__,
-                             pktInfo.getSource(),
-                             pktInfo.getDestination(),
-                             pktInfo.getPriority(),
-                             pkt.length());
-
-      // drain the bit pool converting bytes to bits
-      const size_t sizePending = pBitPool_->get(pkt.length() * 8);
-
-      // check for bitpool error
-      if(sizePending != 0)
-        {
-          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
-                                  ERROR_LEVEL,
-                                  "TRANSPORTI %03d RawTransport %s bitpool request error %zd of %zd",
-                                  id_,
-                                  __func__,
-                                  sizePending, pkt.length() * 8);
-        }
+      LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                              ERROR_LEVEL,
+                              "TRANSPORTI %03d RawTransport %s bitpool request error %zd of %zd",
+                              id_,
+                              __func__,
+                              sizePending, pkt.length() * 8);
     }
 }
 
@@ -535,6 +683,22 @@ void EMANE::Transports::Raw::RawTransport::handleUpstreamControl(const ControlMe
 
 
 void EMANE::Transports::Raw::RawTransport::readDevice()
+{
+  Utils::ThreadPlacement::Scope placement{Utils::ThreadPlacement::ThreadClass::TRANSPORT,id_};
+
+  if(backend_ == Backend::RING)
+    {
+      readDeviceRing();
+    }
+  else
+    {
+      readDevicePcap();
+    }
+}
+
+
+
+void EMANE::Transports::Raw::RawTransport::readDevicePcap()
 {
   const std::uint8_t* buf = NULL;
 
@@ -568,64 +732,91 @@ void EMANE::Transports::Raw::RawTransport::readDevice()
       // success
       else if(iPcapResult == 1)
         {
-          // frame sanity check
-          if(verifyFrame(buf, pcap_hdr->caplen) < 0)
+          processDeviceFrame(buf, pcap_hdr->caplen);
+        }
+    }
+}
+
+
+
+void EMANE::Transports::Raw::RawTransport::readDeviceRing()
+{
+  auto handler = std::bind(&RawTransport::processDeviceFrame,
+                           this,
+                           std::placeholders::_1,
+                           std::placeholders::_2);
+
+  // each read hands over a block of frames, blocks here
+  while(packetRing_.read(handler) == 0){}
+
+  LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                          ERROR_LEVEL,
+                          "TRANSPORTI %03d RawTransport %s ring read error %s",
+                          id_,
+                          __func__,
+                          strerror(errno));
+}
+
+
+
+void EMANE::Transports::Raw::RawTransport::processDeviceFrame(const std::uint8_t * buf, std::size_t len)
+{
+  // frame sanity check
+  if(verifyFrame(buf, len) < 0)
+    {
+      LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                              ERROR_LEVEL,
+                              "TRANSPORTI %03d RawTransport %s frame error",
+                              id_,
+                              __func__);
+    }
+  else
+    {
+      const Utils::EtherHeader *pEtherHeader = (const Utils::EtherHeader *) buf;
+
+      NEMId nemDestination;
+
+      std::uint8_t dscp{};
+
+      // get dst and dscp values from frame
+      if(parseFrame(pEtherHeader, nemDestination, dscp) < 0)
+        {
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  ERROR_LEVEL,
+                                  "TRANSPORTI %03d RawTransport %s frame parse error",
+                                  id_,
+                                  __func__);
+        }
+      else
+        {
+          LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
+                                 DEBUG_LEVEL,
+                                 "TRANSPORTI %03d RawTransport %s src %hu, dst %hu, dscp %hhu, length %zu",
+                                 id_,
+                                 __func__,
+                                 id_,
+                                 nemDestination,
+                                 dscp,
+                                 len);
+
+          // create downstream packet with packet info
+          DownstreamPacket pkt(PacketInfo (id_, nemDestination, dscp,Clock::now()), buf, len);
+
+          sendDownstreamPacket(pkt);
+
+          // drain the bit pool converting bytes to bits
+          const size_t sizePending = pBitPool_->get(len * 8);
+
+          // check for bitpool error
+          if(sizePending != 0)
             {
               LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
                                       ERROR_LEVEL,
-                                      "TRANSPORTI %03d RawTransport %s frame error",
+                                      "TRANSPORTI %03d RawTransport %s bitpool request error %zd of %zu",
                                       id_,
-                                      __func__);
-            }
-          else
-            {
-              const Utils::EtherHeader *pEtherHeader = (const Utils::EtherHeader *) buf;
-
-              NEMId nemDestination;
-
-              std::uint8_t dscp{};
-
-              // get dst and dscp values from frame
-              if(parseFrame(pEtherHeader, nemDestination, dscp) < 0)
-                {
-                  LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
-                                          ERROR_LEVEL,
-                                          "TRANSPORTI %03d RawTransport %s frame parse error",
-                                          id_,
-                                          __func__);
-                }
-              else
-                {
-                  LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
-                                         DEBUG_LEVEL,
-                                         "TRANSPORTI %03d RawTransport %s src %hu, dst %hu, dscp %hhu, length %u",
-                                         id_,
-                                         __func__,
-                                         id_,
-                                         nemDestination,
-                                         dscp,
-                                         pcap_hdr->caplen);
-
-                  // create downstream packet with packet info
-                  DownstreamPacket pkt(PacketInfo (id_, nemDestination, dscp,Clock::now()), buf, pcap_hdr->caplen);
-
-                  sendDownstreamPacket(pkt);
-
-                  // drain the bit pool converting bytes to bits
-                  const size_t sizePending = pBitPool_->get(pcap_hdr->caplen * 8);
-
-                  // check for bitpool error
-                  if(sizePending != 0)
-                    {
-                      LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
-                                              ERROR_LEVEL,
-                                              "TRANSPORTI %03d RawTransport %s bitpool request error %zd of %u",
-                                              id_,
-                                              __func__,
-                                              sizePending,
-                                              pcap_hdr->caplen * 8);
-                    }
-                }
+                                      __func__,
+                                      sizePending,
+                                      len * 8);
             }
         }
     }
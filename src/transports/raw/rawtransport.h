@@ -38,6 +38,7 @@
 #include <memory.h>
 
 #include "ethernettransport.h"
+#include "packetring.h"
 #include "emane/utils/netutils.h"
 #include "emane/utils/bitpool.h"
 
@@ -93,6 +94,18 @@ namespace EMANE
 
         std::uint64_t u64BitRate_;
 
+        enum class Backend
+          {
+            PCAP,
+            RING,
+          };
+
+        Backend backend_;
+
+        PacketRing::Parameters ringParameters_;
+
+        PacketRing packetRing_;
+
         /**
          *
          * @brief read device method reads from raw device and sends packets downstream.
@@ -102,6 +115,11 @@ namespace EMANE
          */
         void readDevice();
 
+        void readDevicePcap();
+
+        void readDeviceRing();
+
+        void processDeviceFrame(const std::uint8_t * buf, std::size_t len);
 
         void handleUpstreamControl(const ControlMessages & msgs);
       };
@@ -0,0 +1,511 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "tcpoffload.h"
+
+#include "emane/utils/netutils.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+  const std::uint16_t ETH_TYPE_VLAN{0x8100};
+  const std::uint8_t IP_PROTO_TCP{6};
+  const std::uint8_t TCP_FLAG_FIN{0x01};
+  const std::uint8_t TCP_FLAG_PSH{0x08};
+  const std::uint8_t TCP_FLAG_ACK{0x10};
+  const std::uint8_t TCP_FLAG_CWR{0x80};
+  const std::size_t TCP_HEADER_LEN{20};
+  const std::size_t TCP_CHECKSUM_OFFSET{16};
+  const std::size_t UDP_CHECKSUM_OFFSET{6};
+
+  std::uint16_t read16(const std::uint8_t * p)
+  {
+    std::uint16_t u16Value;
+    memcpy(&u16Value,p,sizeof(u16Value));
+    return ntohs(u16Value);
+  }
+
+  std::uint32_t read32(const std::uint8_t * p)
+  {
+    std::uint32_t u32Value;
+    memcpy(&u32Value,p,sizeof(u32Value));
+    return ntohl(u32Value);
+  }
+
+  void write16(std::uint8_t * p, std::uint16_t u16Value)
+  {
+    u16Value = htons(u16Value);
+    memcpy(p,&u16Value,sizeof(u16Value));
+  }
+
+  void write32(std::uint8_t * p, std::uint32_t u32Value)
+  {
+    u32Value = htonl(u32Value);
+    memcpy(p,&u32Value,sizeof(u32Value));
+  }
+
+  // stores a checksum already in network order as summed by inet_cksum
+  void writeChecksum(std::uint8_t * p, std::uint16_t u16Checksum)
+  {
+    memcpy(p,&u16Checksum,sizeof(u16Checksum));
+  }
+
+  struct TCPLayout
+  {
+    std::size_t l3Offset_;
+    std::size_t l4Offset_;
+    std::size_t payloadOffset_;
+    std::size_t end_;
+    bool bIPv6_;
+  };
+
+  // locates the headers of an unfragmented TCP over IPv4 or IPv6
+  // frame, end_ is taken from the IP length so that Ethernet padding
+  // is excluded
+  bool parseTCP(const std::uint8_t * pFrame, std::size_t len, TCPLayout & layout)
+  {
+    std::size_t offset{EMANE::Utils::ETH_HEADER_LEN};
+
+    if(len < offset)
+      {
+        return false;
+      }
+
+    std::uint16_t u16Type{read16(pFrame + offset - 2)};
+
+    if(u16Type == ETH_TYPE_VLAN)
+      {
+        offset += 4;
+
+        if(len < offset)
+          {
+            return false;
+          }
+
+        u16Type = read16(pFrame + offset - 2);
+      }
+
+    const std::uint8_t * pIP{pFrame + offset};
+
+    if(u16Type == EMANE::Utils::ETH_P_IPV4)
+      {
+        if(len < offset + EMANE::Utils::IPV4_HEADER_LEN)
+          {
+            return false;
+          }
+
+        std::size_t headerLength = (pIP[0] & 0x0F) * 4;
+
+        std::size_t totalLength{read16(pIP + 2)};
+
+        // TCP, no fragment offset and no more fragments
+        if(headerLength < EMANE::Utils::IPV4_HEADER_LEN ||
+           pIP[9] != IP_PROTO_TCP ||
+           (read16(pIP + 6) & 0x3FFF) ||
+           totalLength < headerLength + TCP_HEADER_LEN ||
+           offset + totalLength > len)
+          {
+            return false;
+          }
+
+        layout.l4Offset_ = offset + headerLength;
+        layout.end_ = offset + totalLength;
+        layout.bIPv6_ = false;
+      }
+    else if(u16Type == EMANE::Utils::ETH_P_IPV6)
+      {
+        if(len < offset + EMANE::Utils::IPV6_HEADER_LEN)
+          {
+            return false;
+          }
+
+        std::size_t payloadLength{read16(pIP + 4)};
+
+        // TCP without extension headers
+        if(pIP[6] != IP_PROTO_TCP ||
+           payloadLength < TCP_HEADER_LEN ||
+           offset + EMANE::Utils::IPV6_HEADER_LEN + payloadLength > len)
+          {
+            return false;
+          }
+
+        layout.l4Offset_ = offset + EMANE::Utils::IPV6_HEADER_LEN;
+        layout.end_ = layout.l4Offset_ + payloadLength;
+        layout.bIPv6_ = true;
+      }
+    else
+      {
+        return false;
+      }
+
+    std::size_t tcpHeaderLength = (pFrame[layout.l4Offset_ + 12] >> 4) * 4;
+
+    if(tcpHeaderLength < TCP_HEADER_LEN ||
+       layout.l4Offset_ + tcpHeaderLength > layout.end_)
+      {
+        return false;
+      }
+
+    layout.l3Offset_ = offset;
+    layout.payloadOffset_ = layout.l4Offset_ + tcpHeaderLength;
+
+    return true;
+  }
+
+  // TCP pseudo header sum, not complemented
+  std::uint16_t pseudoHeaderSum(const std::uint8_t * pIP,
+                                bool bIPv6,
+                                std::uint32_t u32TCPLength)
+  {
+    std::uint8_t buf[40]{};
+
+    if(bIPv6)
+      {
+        memcpy(buf,pIP + 8,32);
+        write32(buf + 32,u32TCPLength);
+        buf[39] = IP_PROTO_TCP;
+        return EMANE::Utils::inet_cksum(buf,40);
+      }
+    else
+      {
+        memcpy(buf,pIP + 12,8);
+        buf[9] = IP_PROTO_TCP;
+        write16(buf + 10,u32TCPLength);
+        return EMANE::Utils::inet_cksum(buf,12);
+      }
+  }
+
+  // sets the IP length fields for a frame ending at end and refreshes
+  // the IPv4 header checksum
+  void updateIPLength(std::uint8_t * pFrame,
+                      const TCPLayout & layout,
+                      std::size_t end)
+  {
+    std::uint8_t * pIP{pFrame + layout.l3Offset_};
+
+    if(layout.bIPv6_)
+      {
+        write16(pIP + 4,end - layout.l4Offset_);
+      }
+    else
+      {
+        write16(pIP + 2,end - layout.l3Offset_);
+        write16(pIP + 10,0);
+        writeChecksum(pIP + 10,
+                      ~EMANE::Utils::inet_cksum(pIP,layout.l4Offset_ - layout.l3Offset_));
+      }
+  }
+}
+
+bool EMANE::Transports::Virtual::completeChecksum(const VirtioNetHeader & hdr,
+                                                  std::uint8_t * pFrame,
+                                                  std::size_t len)
+{
+  if(!(hdr.u8Flags & VIRTIO_NET_HEADER_F_NEEDS_CSUM))
+    {
+      return true;
+    }
+
+  std::size_t start{hdr.u16ChecksumStart};
+
+  std::size_t offset{hdr.u16ChecksumOffset};
+
+  if(start + offset + 2 > len)
+    {
+      return false;
+    }
+
+  // the checksum field holds the pseudo header sum
+  std::uint16_t u16Checksum = ~Utils::inet_cksum(pFrame + start,len - start);
+
+  // a zero UDP checksum means no checksum
+  if(!u16Checksum && offset == UDP_CHECKSUM_OFFSET)
+    {
+      u16Checksum = 0xFFFF;
+    }
+
+  writeChecksum(pFrame + start + offset,u16Checksum);
+
+  return true;
+}
+
+EMANE::Transports::Virtual::TCPSegmenter::TCPSegmenter():
+  segment_(Utils::IP_MAX_PACKET + Utils::ETH_HEADER_LEN + 4){}
+
+bool EMANE::Transports::Virtual::TCPSegmenter::segment(const VirtioNetHeader & hdr,
+                                                       const std::uint8_t * pFrame,
+                                                       std::size_t len,
+                                                       const FrameHandler & handler)
+{
+  std::uint8_t u8Type = hdr.u8GSOType & ~VIRTIO_NET_HEADER_GSO_ECN;
+
+  TCPLayout layout{};
+
+  if((u8Type != VIRTIO_NET_HEADER_GSO_TCPV4 && u8Type != VIRTIO_NET_HEADER_GSO_TCPV6) ||
+     !hdr.u16GSOSize ||
+     !parseTCP(pFrame,len,layout) ||
+     layout.bIPv6_ != (u8Type == VIRTIO_NET_HEADER_GSO_TCPV6) ||
+     layout.end_ > segment_.size())
+    {
+      return false;
+    }
+
+  const std::size_t headerLength{layout.payloadOffset_};
+  const std::size_t tcpHeaderLength{layout.payloadOffset_ - layout.l4Offset_};
+  const std::size_t payloadLength{layout.end_ - headerLength};
+  const std::size_t segmentSize{hdr.u16GSOSize};
+
+  const std::uint8_t * pTCP{pFrame + layout.l4Offset_};
+  const std::uint32_t u32Sequence{read32(pTCP + 4)};
+  const std::uint16_t u16Id{read16(pFrame + layout.l3Offset_ + 4)};
+  const std::uint8_t u8Flags{pTCP[13]};
+
+  std::uint8_t * pSegment{segment_.data()};
+  std::uint8_t * pSegmentTCP{pSegment + layout.l4Offset_};
+
+  memcpy(pSegment,pFrame,headerLength);
+
+  std::size_t offset{};
+
+  for(std::uint16_t i = 0; offset < payloadLength || !i; ++i)
+    {
+      std::size_t chunk{std::min(segmentSize,payloadLength - offset)};
+
+      bool bLast{offset + chunk == payloadLength};
+
+      memcpy(pSegment + headerLength,pFrame + headerLength + offset,chunk);
+
+      std::size_t end{headerLength + chunk};
+
+      if(!layout.bIPv6_)
+        {
+          write16(pSegment + layout.l3Offset_ + 4,u16Id + i);
+        }
+
+      updateIPLength(pSegment,layout,end);
+
+      write32(pSegmentTCP + 4,u32Sequence + offset);
+
+      std::uint8_t u8SegmentFlags{u8Flags};
+
+      // FIN and PSH belong to the last segment, CWR to the first
+      if(!bLast)
+        {
+          u8SegmentFlags &= ~(TCP_FLAG_FIN | TCP_FLAG_PSH);
+        }
+
+      if(i)
+        {
+          u8SegmentFlags &= ~TCP_FLAG_CWR;
+        }
+
+      pSegmentTCP[13] = u8SegmentFlags;
+
+      write16(pSegmentTCP + TCP_CHECKSUM_OFFSET,0);
+
+      std::uint16_t u16Sum{pseudoHeaderSum(pSegment + layout.l3Offset_,
+                                           layout.bIPv6_,
+                                           tcpHeaderLength + chunk)};
+
+      writeChecksum(pSegmentTCP + TCP_CHECKSUM_OFFSET,
+                    ~Utils::inet_cksum(pSegmentTCP,tcpHeaderLength + chunk,u16Sum));
+
+      if(!handler(pSegment,end))
+        {
+          return false;
+        }
+
+      offset += chunk;
+    }
+
+  return true;
+}
+
+EMANE::Transports::Virtual::TCPCoalescer::TCPCoalescer(FrameWriter writer):
+  writer_{writer},
+  l3Offset_{},
+  l4Offset_{},
+  payloadOffset_{},
+  bIPv6_{},
+  u16SegmentSize_{},
+  u16LastSegmentSize_{},
+  u32NextSequence_{},
+  segments_{}
+{
+  pending_.reserve(Utils::IP_MAX_PACKET + Utils::ETH_HEADER_LEN + 4);
+}
+
+bool EMANE::Transports::Virtual::TCPCoalescer::add(const std::uint8_t * pFrame, std::size_t len)
+{
+  TCPLayout layout{};
+
+  if(!parseTCP(pFrame,len,layout))
+    {
+      flush();
+      return false;
+    }
+
+  const std::uint8_t * pTCP{pFrame + layout.l4Offset_};
+
+  std::size_t payloadLength{layout.end_ - layout.payloadOffset_};
+
+  // data segments with only ACK and optionally PSH set
+  if((pTCP[13] & ~TCP_FLAG_PSH) != TCP_FLAG_ACK || !payloadLength)
+    {
+      flush();
+      return false;
+    }
+
+  std::uint32_t u32Sequence{read32(pTCP + 4)};
+
+  bool bMerge{false};
+
+  if(!pending_.empty() &&
+     layout.l3Offset_ == l3Offset_ &&
+     layout.l4Offset_ == l4Offset_ &&
+     layout.payloadOffset_ == payloadOffset_ &&
+     layout.bIPv6_ == bIPv6_ &&
+     u16LastSegmentSize_ == u16SegmentSize_ &&
+     payloadLength <= u16SegmentSize_ &&
+     u32Sequence == u32NextSequence_ &&
+     pending_.size() - l3Offset_ + payloadLength <= Utils::IP_MAX_PACKET)
+    {
+      const std::uint8_t * pPending{pending_.data()};
+      const std::uint8_t * pPendingTCP{pPending + l4Offset_};
+
+      // IPv4 length, id and checksum or IPv6 payload length may
+      // differ, as may the TCP sequence number, PSH and checksum
+      bool bIPMatch{};
+
+      if(bIPv6_)
+        {
+          bIPMatch = !memcmp(pPending,pFrame,l3Offset_ + 4) &&
+            !memcmp(pPending + l3Offset_ + 6,pFrame + l3Offset_ + 6,l4Offset_ - l3Offset_ - 6);
+        }
+      else
+        {
+          bIPMatch = !memcmp(pPending,pFrame,l3Offset_ + 2) &&
+            !memcmp(pPending + l3Offset_ + 6,pFrame + l3Offset_ + 6,4) &&
+            !memcmp(pPending + l3Offset_ + 12,pFrame + l3Offset_ + 12,l4Offset_ - l3Offset_ - 12);
+        }
+
+      bMerge = bIPMatch &&
+        !memcmp(pPendingTCP,pTCP,4) &&
+        !memcmp(pPendingTCP + 8,pTCP + 8,5) &&
+        (pPendingTCP[13] & ~TCP_FLAG_PSH) == (pTCP[13] & ~TCP_FLAG_PSH) &&
+        !memcmp(pPendingTCP + 14,pTCP + 14,2) &&
+        !memcmp(pPendingTCP + 18,pTCP + 18,payloadOffset_ - l4Offset_ - 18);
+    }
+
+  if(bMerge)
+    {
+      pending_.insert(pending_.end(),
+                      pFrame + layout.payloadOffset_,
+                      pFrame + layout.end_);
+
+      pending_[l4Offset_ + 13] |= pTCP[13] & TCP_FLAG_PSH;
+
+      ++segments_;
+    }
+  else
+    {
+      flush();
+
+      pending_.assign(pFrame,pFrame + layout.end_);
+
+      l3Offset_ = layout.l3Offset_;
+      l4Offset_ = layout.l4Offset_;
+      payloadOffset_ = layout.payloadOffset_;
+      bIPv6_ = layout.bIPv6_;
+      u16SegmentSize_ = payloadLength;
+      segments_ = 1;
+    }
+
+  u16LastSegmentSize_ = payloadLength;
+  u32NextSequence_ = u32Sequence + payloadLength;
+
+  // PSH ends the burst, and a frame without room for another full
+  // segment will not grow
+  if((pTCP[13] & TCP_FLAG_PSH) ||
+     u16LastSegmentSize_ != u16SegmentSize_ ||
+     pending_.size() - l3Offset_ + u16SegmentSize_ > Utils::IP_MAX_PACKET)
+    {
+      flush();
+    }
+
+  return true;
+}
+
+void EMANE::Transports::Virtual::TCPCoalescer::flush()
+{
+  if(pending_.empty())
+    {
+      return;
+    }
+
+  VirtioNetHeader hdr{};
+
+  if(segments_ > 1)
+    {
+      std::uint8_t * pPending{pending_.data()};
+
+      TCPLayout layout{l3Offset_,l4Offset_,payloadOffset_,pending_.size(),bIPv6_};
+
+      updateIPLength(pPending,layout,pending_.size());
+
+      // the kernel completes the checksum from the pseudo header sum
+      writeChecksum(pPending + l4Offset_ + TCP_CHECKSUM_OFFSET,
+                    pseudoHeaderSum(pPending + l3Offset_,
+                                    bIPv6_,
+                                    pending_.size() - l4Offset_));
+
+      hdr.u8Flags = VIRTIO_NET_HEADER_F_NEEDS_CSUM;
+      hdr.u8GSOType = bIPv6_ ? VIRTIO_NET_HEADER_GSO_TCPV6 : VIRTIO_NET_HEADER_GSO_TCPV4;
+      hdr.u16GSOSize = u16SegmentSize_;
+      hdr.u16HeaderLength = payloadOffset_;
+      hdr.u16ChecksumStart = l4Offset_;
+      hdr.u16ChecksumOffset = TCP_CHECKSUM_OFFSET;
+    }
+
+  writer_(hdr,pending_.data(),pending_.size());
+
+  pending_.clear();
+
+  segments_ = 0;
+}
+
+bool EMANE::Transports::Virtual::TCPCoalescer::isPending() const
+{
+  return !pending_.empty();
+}
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef EMANETRANSPORTSVIRTUALTCPOFFLOAD_HEADER_
+#define EMANETRANSPORTSVIRTUALTCPOFFLOAD_HEADER_
+
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace EMANE
+{
+  namespace Transports
+  {
+    namespace Virtual
+    {
+      /**
+       * @struct VirtioNetHeader
+       *
+       * @brief Header preceding each frame read from or written to a
+       * virtual device opened with IFF_VNET_HDR (struct
+       * virtio_net_hdr). Fields are in host byte order.
+       */
+      struct VirtioNetHeader
+      {
+        std::uint8_t u8Flags;
+        std::uint8_t u8GSOType;
+        std::uint16_t u16HeaderLength;
+        std::uint16_t u16GSOSize;
+        std::uint16_t u16ChecksumStart;
+        std::uint16_t u16ChecksumOffset;
+      } __attribute__((packed));
+
+      const std::uint8_t VIRTIO_NET_HEADER_F_NEEDS_CSUM = 0x01;
+
+      const std::uint8_t VIRTIO_NET_HEADER_GSO_NONE = 0x00;
+      const std::uint8_t VIRTIO_NET_HEADER_GSO_TCPV4 = 0x01;
+      const std::uint8_t VIRTIO_NET_HEADER_GSO_TCPV6 = 0x04;
+      const std::uint8_t VIRTIO_NET_HEADER_GSO_ECN = 0x80;
+
+      /**
+       * Completes a partial checksum requested by a virtio net header
+       * with VIRTIO_NET_HEADER_F_NEEDS_CSUM set
+       *
+       * @param hdr Virtio net header read with the frame
+       * @param pFrame Ethernet frame
+       * @param len Frame length in bytes
+       *
+       * @return true if the checksum was completed or not needed,
+       * false if the checksum location is outside the frame
+       */
+      bool completeChecksum(const VirtioNetHeader & hdr,
+                            std::uint8_t * pFrame,
+                            std::size_t len);
+
+      /**
+       * @class TCPSegmenter
+       *
+       * @brief Splits a TCP GSO frame read from a virtual device with
+       * IFF_VNET_HDR into the MSS sized frames the kernel would have
+       * sent had segmentation offload been disabled.
+       */
+      class TCPSegmenter
+      {
+      public:
+        /**
+         * Segment handler, return false to stop segmenting
+         */
+        using FrameHandler = std::function<bool(const std::uint8_t *, std::size_t)>;
+
+        TCPSegmenter();
+
+        /**
+         * Segments a GSO frame
+         *
+         * @param hdr Virtio net header read with the frame
+         * @param pFrame Ethernet frame
+         * @param len Frame length in bytes
+         * @param handler Handler called once for each segment in order
+         *
+         * @return false if the frame is not a supported TCP GSO frame
+         * or the handler stopped segmentation
+         */
+        bool segment(const VirtioNetHeader & hdr,
+                     const std::uint8_t * pFrame,
+                     std::size_t len,
+                     const FrameHandler & handler);
+
+      private:
+        std::vector<std::uint8_t> segment_;
+      };
+
+      /**
+       * @class TCPCoalescer
+       *
+       * @brief Merges consecutive in-order TCP segments of the same
+       * flow into a single GSO frame for one write to a virtual device
+       * with IFF_VNET_HDR.
+       *
+       * Segments are merged while they carry the same headers other
+       * than sequence number and PSH, arrive in sequence and every
+       * segment but the last is full sized. A segment with PSH set
+       * completes the merged frame.
+       */
+      class TCPCoalescer
+      {
+      public:
+        /**
+         * Frame writer
+         */
+        using FrameWriter = std::function<void(const VirtioNetHeader &,
+                                               const std::uint8_t *,
+                                               std::size_t)>;
+
+        /**
+         * Creates an instance
+         *
+         * @param writer Writer used for completed frames
+         */
+        explicit TCPCoalescer(FrameWriter writer);
+
+        /**
+         * Adds a frame
+         *
+         * @param pFrame Ethernet frame
+         * @param len Frame length in bytes
+         *
+         * @return true if the frame was taken. false if it can not be
+         * merged, in which case any pending frame has already been
+         * written and the caller writes the frame itself.
+         */
+        bool add(const std::uint8_t * pFrame, std::size_t len);
+
+        /**
+         * Writes the pending frame, if any
+         */
+        void flush();
+
+        /**
+         * Determines if a frame is pending
+         *
+         * @return boolean flag
+         */
+        bool isPending() const;
+
+      private:
+        FrameWriter writer_;
+        std::vector<std::uint8_t> pending_;
+        std::size_t l3Offset_;
+        std::size_t l4Offset_;
+        std::size_t payloadOffset_;
+        bool bIPv6_;
+        std::uint16_t u16SegmentSize_;
+        std::uint16_t u16LastSegmentSize_;
+        std::uint32_t u32NextSequence_;
+        std::size_t segments_;
+      };
+    }
+  }
+}
+
+#endif // EMANETRANSPORTSVIRTUALTCPOFFLOAD_HEADER_
@@ -77,7 +77,9 @@ EMANE::Transports::Virtual::TunTap::~TunTap()
 
 
 int
-EMANE::Transports::Virtual::TunTap::open(const char *sDevicePath, const char *sDeviceName)
+EMANE::Transports::Virtual::TunTap::open(const char *sDevicePath,
+                                         const char *sDeviceName,
+                                         bool bOffloadEnable)
 {
   int result;
 
@@ -106,6 +108,12 @@ EMANE::Transports::Virtual::TunTap::open(const char *sDevicePath, const char *sD
   // set flags no proto info and tap mode
   ifr.ifr_flags = IFF_NO_PI | IFF_TAP;
 
+  if(bOffloadEnable)
+    {
+      // frames are prefixed with a virtio net header
+      ifr.ifr_flags |= IFF_VNET_HDR;
+    }
+
   // set tun flags
   if(ioctl(tunHandle_, TUNSETIFF, &ifr) < 0)
     {
@@ -119,6 +127,20 @@ EMANE::Transports::Virtual::TunTap::open(const char *sDevicePath, const char *sD
       return -1;
     }
 
+  // accept partial checksums and TCP segmentation offload
+  if(bOffloadEnable &&
+     ioctl(tunHandle_, TUNSETOFFLOAD, TUN_F_CSUM | TUN_F_TSO4 | TUN_F_TSO6 | TUN_F_TSO_ECN) < 0)
+    {
+      LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                              ABORT_LEVEL,
+                              "TunTap::%s:offload:error %s",
+                              __func__,
+                              strerror(errno));
+
+      // fail
+      return -1;
+    }
+
   // clear ifr
   memset(&ifr, 0, sizeof(ifr));
 
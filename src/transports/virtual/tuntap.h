@@ -94,10 +94,12 @@ namespace EMANE
          *
          * @param sDevicePath path to device
          * @param sDeviceName name of device
+         * @param bOffloadEnable prefix frames with a virtio net header
+         * and enable checksum and TCP segmentation offload
          *
          * @return 0 on success, -1 on error
          */
-        int open(const char *, const char *);
+        int open(const char *, const char *, bool bOffloadEnable = false);
 
         /**
          * Closes tuntap handle
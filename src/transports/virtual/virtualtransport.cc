@@ -41,6 +41,7 @@
 
 #include "emane/utils/netutils.h"
 #include "emane/utils/threadutils.h"
+#include "emane/utils/threadplacement.h"
 #include "emane/utils/parameterconvert.h"
 
 #include "emane/controls/serializedcontrolmessage.h"
@@ -75,7 +76,23 @@ EMANE::Transports::Virtual::VirtualTransport::VirtualTransport(NEMId id,
   bCanceled_{},
   flowControlClient_{*this},
   bFlowControlEnable_{},
-  commonLayerStatistics_{STATISTIC_TABLE_LABELS}
+  commonLayerStatistics_{STATISTIC_TABLE_LABELS},
+  bOffloadEnable_{},
+  offloadCoalesceTimeout_{},
+  offloadFlushTimedEventId_{},
+  segmenter_{},
+  coalescer_{[this](const VirtioNetHeader & hdr, const std::uint8_t * buf, std::size_t len)
+             {
+               if(writeDevice(hdr, buf, len) < 0)
+                 {
+                   LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                           ERROR_LEVEL,
+                                           "TRANSPORTI %03hu VirtualTransport::%s coalesced write %s",
+                                           id_,
+                                           __func__,
+                                           strerror(errno));
+                 }
+             }}
 {}
 
 EMANE::Transports::Virtual::VirtualTransport::~VirtualTransport()
@@ -182,10 +199,27 @@ void EMANE::Transports::Virtual::VirtualTransport::initialize(Registrar & regist
                                                 " frame is encountered during downstream"
                                                 " processing.");
 
+  configRegistrar.registerNumeric<bool>("offloadenable",
+                                        ConfigurationProperties::DEFAULT,
+                                        {false},
+                                        "Open the virtual device with IFF_VNET_HDR and enable checksum"
+                                        " and TCP segmentation offload. Large TCP frames read from the"
+                                        " device are segmented by the transport and consecutive TCP"
+                                        " segments of a flow are coalesced into one device write.");
+
+  configRegistrar.registerNumeric<std::uint32_t>("offload.coalesce.timeout",
+                                                 ConfigurationProperties::DEFAULT,
+                                                 {100},
+                                                 "Maximum time in microseconds a TCP segment is held"
+                                                 " waiting for the next segment of its flow when"
+                                                 " offload is enabled.");
+
   auto & statisticRegistrar = registrar.statisticRegistrar();
 
   commonLayerStatistics_.registerStatistics(statisticRegistrar);
 
+  registerStatistics(statisticRegistrar);
+
 }
 
 
@@ -340,6 +374,30 @@ void EMANE::Transports::Virtual::VirtualTransport::configure(const Configuration
 
             }
         }
+      else if(item.first == "offloadenable")
+        {
+          bOffloadEnable_ = item.second[0].asBool();
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "TRANSPORTI %03hu VirtualTransport::%s %s: %d",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  bOffloadEnable_);
+        }
+      else if(item.first == "offload.coalesce.timeout")
+        {
+          offloadCoalesceTimeout_ = Microseconds{item.second[0].asUINT32()};
+
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  INFO_LEVEL,
+                                  "TRANSPORTI %03hu VirtualTransport::%s %s: %ju",
+                                  id_,
+                                  __func__,
+                                  item.first.c_str(),
+                                  offloadCoalesceTimeout_.count());
+        }
       else
         {
           throw makeException<ConfigureException>("VirtualTransport: "
@@ -353,7 +411,7 @@ void EMANE::Transports::Virtual::VirtualTransport::configure(const Configuration
 
 void EMANE::Transports::Virtual::VirtualTransport::start()
 {
-  if(pTunTap_->open(sDevicePath_.c_str(), sDeviceName_.c_str()) < 0)
+  if(pTunTap_->open(sDevicePath_.c_str(), sDeviceName_.c_str(), bOffloadEnable_) < 0)
     {
       std::stringstream ssDescription;
       ssDescription << "could not open tuntap device path "
@@ -438,16 +496,31 @@ void EMANE::Transports::Virtual::VirtualTransport::stop()
 
       thread_.join();
     }
-
-  pTunTap_->deactivate();
-
-  pTunTap_->close();
 }
 
 
 void EMANE::Transports::Virtual::VirtualTransport::destroy()
   throw()
-{}
+{
+  // the transport queue thread, which owns the coalescer and runs
+  // the flush timer, is joined after stop and before destroy
+  if(offloadFlushTimedEventId_)
+    {
+      pPlatformService_->timerService().cancelTimedEvent(offloadFlushTimedEventId_);
+
+      offloadFlushTimedEventId_ = 0;
+    }
+
+  if(pTunTap_->get_handle() != -1)
+    {
+      // write any held segments before the device goes away
+      coalescer_.flush();
+
+      pTunTap_->deactivate();
+
+      pTunTap_->close();
+    }
+}
 
 
 void EMANE::Transports::Virtual::VirtualTransport::processUpstreamPacket(UpstreamPacket & pkt,
@@ -476,12 +549,36 @@ void EMANE::Transports::Virtual::VirtualTransport::processUpstreamPacket(Upstrea
   // update arp cache
   updateArpCache(pEtherHeader, pktInfo.getSource());
 
-  iovec iov;
+  int iResult{};
 
-  iov.iov_base = const_cast<char*>(reinterpret_cast<const char*>(pkt.get()));
-  iov.iov_len  = pkt.length();
+  if(bOffloadEnable_)
+    {
+      // consecutive TCP segments of a flow are held and written as
+      // one frame
+      if(!coalescer_.add(static_cast<const std::uint8_t *>(pkt.get()), pkt.length()))
+        {
+          iResult = writeDevice(VirtioNetHeader{}, pkt.get(), pkt.length());
+        }
+      else if(coalescer_.isPending() && !offloadFlushTimedEventId_)
+        {
+          offloadFlushTimedEventId_ =
+            pPlatformService_->timerService().schedule([this](const TimePoint &,
+                                                              const TimePoint &,
+                                                              const TimePoint &)
+                                                       {
+                                                         offloadFlushTimedEventId_ = 0;
+
+                                                         coalescer_.flush();
+                                                       },
+                                                       beginTime + offloadCoalesceTimeout_);
+        }
+    }
+  else
+    {
+      iResult = writeDevice(VirtioNetHeader{}, pkt.get(), pkt.length());
+    }
 
-  if(pTunTap_->writev(&iov, 1) < 0)
+  if(iResult < 0)
     {
       LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
                               ERROR_LEVEL,
@@ -733,21 +830,31 @@ void EMANE::Transports::Virtual::VirtualTransport::handleUpstreamControl(const C
 
 void EMANE::Transports::Virtual::VirtualTransport::readDevice()
 {
-  std::uint8_t buf[Utils::IP_MAX_PACKET];
+  Utils::ThreadPlacement::Scope placement{Utils::ThreadPlacement::ThreadClass::TRANSPORT,id_};
+
+  // large enough for a GSO frame when offload is enabled
+  std::uint8_t buf[Utils::IP_MAX_PACKET + Utils::ETH_HEADER_LEN + 4];
+
+  VirtioNetHeader hdr{};
+
+  auto handler = std::bind(&VirtualTransport::processDeviceFrame,
+                           this,
+                           std::placeholders::_1,
+                           std::placeholders::_2);
 
   while(!bCanceled_)
     {
       ssize_t len{};
 
-      memset(buf, 0x0, sizeof(buf));
+      iovec iov[2];
 
-      iovec iov;
+      iov[0].iov_base = reinterpret_cast<char*>(&hdr);
+      iov[0].iov_len  = sizeof(hdr);
+      iov[1].iov_base = reinterpret_cast<char*>(buf);
+      iov[1].iov_len  = sizeof(buf);
 
-      iov.iov_base = reinterpret_cast<char*>(buf);
-      iov.iov_len  = sizeof(buf);
-
-      // read from tuntap
-      if((len = pTunTap_->readv(&iov, 1)) < 0)
+      // read from tuntap, with a virtio net header when offload is enabled
+      if((len = bOffloadEnable_ ? pTunTap_->readv(iov, 2) : pTunTap_->readv(&iov[1], 1)) < 0)
         {
           LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
                                   ERROR_LEVEL,
@@ -758,109 +865,181 @@ void EMANE::Transports::Virtual::VirtualTransport::readDevice()
 
           break;
         }
-      else
+
+      if(bOffloadEnable_)
         {
-          const TimePoint beginTime{Clock::now()};
+          len -= std::min<ssize_t>(len, sizeof(hdr));
 
-          // frame sanity check
-          if(verifyFrame(buf, len) < 0)
+          if(hdr.u8GSOType != VIRTIO_NET_HEADER_GSO_NONE)
+            {
+              bool bContinue{true};
+
+              // one read, many frames on the air
+              if(!segmenter_.segment(hdr,
+                                     buf,
+                                     len,
+                                     [&bContinue,&handler](const std::uint8_t * pFrame, std::size_t frameLength)
+                                     {
+                                       return bContinue = handler(pFrame,frameLength);
+                                     }) && bContinue)
+                {
+                  LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                          ERROR_LEVEL,
+                                          "TRANSPORTI %03hu VirtualTransport::%s unsupported gso type %hhu",
+                                          id_,
+                                          __func__,
+                                          hdr.u8GSOType);
+                }
+
+              if(!bContinue)
+                {
+                  break;
+                }
+
+              continue;
+            }
+          else if(!completeChecksum(hdr, buf, len))
             {
               LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
                                       ERROR_LEVEL,
-                                      "TRANSPORTI %03hu VirtualTransport::%s frame error",
+                                      "TRANSPORTI %03hu VirtualTransport::%s checksum offset error",
                                       id_,
                                       __func__);
+
+              continue;
             }
-          else
-            {
-              // NEM destination
-              NEMId nemDestination;
+        }
 
-              // pkt tos/qos converted to dscp
-              std::uint8_t dscp{};
+      if(!handler(buf, len))
+        {
+          break;
+        }
+    }
+}
+
+
+
+bool EMANE::Transports::Virtual::VirtualTransport::processDeviceFrame(const std::uint8_t * buf,
+                                                                      std::size_t len)
+{
+  const TimePoint beginTime{Clock::now()};
+
+  // frame sanity check
+  if(verifyFrame(buf, len) < 0)
+    {
+      LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                              ERROR_LEVEL,
+                              "TRANSPORTI %03hu VirtualTransport::%s frame error",
+                              id_,
+                              __func__);
+    }
+  else
+    {
+      // NEM destination
+      NEMId nemDestination;
+
+      // pkt tos/qos converted to dscp
+      std::uint8_t dscp{};
+
+      // get dst and dscp values
+      if(parseFrame((const Utils::EtherHeader *)buf, nemDestination, dscp) < 0)
+        {
+          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                  ERROR_LEVEL,
+                                  "TRANSPORTI %03hu VirtualTransport::%s frame parse error",
+                                  id_,
+                                  __func__);
+        }
+      else
+        {
+          LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
+                                 DEBUG_LEVEL,
+                                 "TRANSPORTI %03hu VirtualTransport::%s src %hu, dst %hu, dscp %hhu, length %zu",
+                                 id_,
+                                 __func__,
+                                 id_,
+                                 nemDestination,
+                                 dscp,
+                                 len);
+
+          // create downstream packet with packet info
+          DownstreamPacket pkt(PacketInfo (id_, nemDestination, dscp,Clock::now()), buf, len);
 
-              // get dst and dscp values
-              if(parseFrame((const Utils::EtherHeader *)buf, nemDestination, dscp) < 0)
+          commonLayerStatistics_.processInbound(pkt);
+
+          // check flow control
+          if(bFlowControlEnable_)
+            {
+              auto status = flowControlClient_.removeToken();
+
+              // block and wait for an available flow control token
+              if(!status.second)
                 {
-                  LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
-                                          ERROR_LEVEL,
-                                          "TRANSPORTI %03hu VirtualTransport::%s frame parse error",
-                                          id_,
-                                          __func__);
+                  LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
+                                         ERROR_LEVEL,
+                                         "TRANSPORTI %03hu VirtualTransport::%s failed to remove token (tokens:%hu)",
+                                         id_,
+                                         __func__,
+                                         status.first);
+                  // done
+                  return false;
                 }
               else
                 {
                   LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
                                          DEBUG_LEVEL,
-                                         "TRANSPORTI %03hu VirtualTransport::%s src %hu, dst %hu, dscp %hhu, length %zd",
+                                         "TRANSPORTI %03hu VirtualTransport::%s removed token (tokens:%hu)",
                                          id_,
                                          __func__,
-                                         id_,
-                                         nemDestination,
-                                         dscp,
-                                         len);
-
-                  // create downstream packet with packet info
-                  DownstreamPacket pkt(PacketInfo (id_, nemDestination, dscp,Clock::now()), buf, len);
-
-                  commonLayerStatistics_.processInbound(pkt);
+                                         status.first);
+                }
+            }
 
-                  // check flow control
-                  if(bFlowControlEnable_)
-                    {
-                      auto status = flowControlClient_.removeToken();
-
-                      // block and wait for an available flow control token
-                      if(!status.second)
-                        {
-                          LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
-                                                 ERROR_LEVEL,
-                                                 "TRANSPORTI %03hu VirtualTransport::%s failed to remove token (tokens:%hu)",
-                                                 id_,
-                                                 __func__,
-                                                 status.first);
-                          // done
-                          break;
-                        }
-                      else
-                        {
-                          LOGGER_VERBOSE_LOGGING(pPlatformService_->logService(),
-                                                 DEBUG_LEVEL,
-                                                 "TRANSPORTI %03hu VirtualTransport::%s removed token (tokens:%hu)",
-                                                 id_,
-                                                 __func__,
-                                                 status.first);
-                        }
-                    }
+          commonLayerStatistics_.processOutbound(pkt,
+                                                 std::chrono::duration_cast<Microseconds>(Clock::now() - beginTime));
 
-                  commonLayerStatistics_.processOutbound(pkt,
-                                                         std::chrono::duration_cast<Microseconds>(Clock::now() - beginTime));
+          // send to downstream transport
+          sendDownstreamPacket(pkt);
 
-                  // send to downstream transport
-                  sendDownstreamPacket(pkt);
+          if(u64BitRate_)
+            {
+              // drain the bit pool
+              std::uint64_t sizePending {pBitPool_->get(len * 8)};
 
-                  if(u64BitRate_)
-                    {
-                      // drain the bit pool
-                      std::uint64_t sizePending {pBitPool_->get(len * 8)};
-
-                      // check for bitpool error
-                      if(sizePending > 0)
-                        {
-                          LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
-                                                  ERROR_LEVEL,
-                                                  "TRANSPORTI %03hu VirtualTransport::%s bitpool "
-                                                  "request error %jd of %zd",
-                                                  id_,
-                                                  __func__,
-                                                  sizePending,
-                                                  len * 8);
-                        }
-                    }
+              // check for bitpool error
+              if(sizePending > 0)
+                {
+                  LOGGER_STANDARD_LOGGING(pPlatformService_->logService(),
+                                          ERROR_LEVEL,
+                                          "TRANSPORTI %03hu VirtualTransport::%s bitpool "
+                                          "request error %jd of %zd",
+                                          id_,
+                                          __func__,
+                                          sizePending,
+                                          len * 8);
                 }
             }
         }
     }
+
+  return true;
+}
+
+
+
+int EMANE::Transports::Virtual::VirtualTransport::writeDevice(const VirtioNetHeader & hdr,
+                                                              const void * buf,
+                                                              std::size_t len)
+{
+  iovec iov[2];
+
+  iov[0].iov_base = const_cast<VirtioNetHeader *>(&hdr);
+  iov[0].iov_len  = sizeof(hdr);
+  iov[1].iov_base = const_cast<void *>(buf);
+  iov[1].iov_len  = len;
+
+  // the virtio net header is only present when offload is enabled
+  return bOffloadEnable_ ? pTunTap_->writev(iov, 2) : pTunTap_->writev(&iov[1], 1);
 }
 
 
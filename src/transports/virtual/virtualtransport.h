@@ -44,6 +44,7 @@
 #include "emane/utils/commonlayerstatistics.h"
 
 #include "tuntap.h"
+#include "tcpoffload.h"
 
 #include <thread>
 
@@ -111,8 +112,22 @@ namespace EMANE
 
         Utils::CommonLayerStatistics commonLayerStatistics_;
 
+        bool bOffloadEnable_;
+
+        Microseconds offloadCoalesceTimeout_;
+
+        TimerEventId offloadFlushTimedEventId_;
+
+        TCPSegmenter segmenter_;
+
+        TCPCoalescer coalescer_;
+
         void readDevice();
 
+        bool processDeviceFrame(const std::uint8_t * buf, std::size_t len);
+
+        int writeDevice(const VirtioNetHeader & hdr, const void * buf, std::size_t len);
+
         void handleUpstreamControl(const ControlMessages & msgs);
       };
     }
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "emane/utils/duplicatedetector.h"
+#include "emane/exception.h"
+
+#include <iostream>
+#include <cstdlib>
+#include <functional>
+#include <vector>
+
+namespace
+{
+  using Check = std::pair<const char *,std::function<bool()>>;
+
+  const EMANE::TimePoint START{std::chrono::seconds{1000}};
+}
+
+int main()
+{
+  std::vector<Check> checks =
+    {
+     {"first reception is not a duplicate, a repeat is",
+      []()
+      {
+        EMANE::Utils::DuplicateDetector detector{16};
+
+        return !detector.isDuplicate(1,100,START) &&
+          detector.isDuplicate(1,100,START);
+      }},
+
+     {"unseen sequence inside the window is accepted once",
+      []()
+      {
+        EMANE::Utils::DuplicateDetector detector{16};
+
+        detector.isDuplicate(1,100,START);
+
+        return !detector.isDuplicate(1,90,START) &&
+          detector.isDuplicate(1,90,START) &&
+          detector.isDuplicate(1,100,START);
+      }},
+
+     {"sequence older than the window is never a duplicate",
+      []()
+      {
+        EMANE::Utils::DuplicateDetector detector{16};
+
+        detector.isDuplicate(1,100,START);
+
+        detector.isDuplicate(1,116,START);
+
+        return !detector.isDuplicate(1,100,START) &&
+          !detector.isDuplicate(1,101,START) &&
+          detector.isDuplicate(1,116,START);
+      }},
+
+     {"slide clears positions reused by newer sequences",
+      []()
+      {
+        // a window of 16 uses 64 bitmap positions
+        EMANE::Utils::DuplicateDetector detector{16};
+
+        detector.isDuplicate(1,10,START);
+
+        detector.isDuplicate(1,20,START);
+
+        // advance of 54 clears positions 21 through 63 and 0 through 10
+        detector.isDuplicate(1,74,START);
+
+        return !detector.isDuplicate(1,70,START) &&
+          !detector.isDuplicate(1,73,START) &&
+          detector.isDuplicate(1,74,START);
+      }},
+
+     {"slide beyond all positions clears the window",
+      []()
+      {
+        EMANE::Utils::DuplicateDetector detector{16};
+
+        detector.isDuplicate(1,5,START);
+
+        detector.isDuplicate(1,68,START);
+
+        // same position as 68
+        detector.isDuplicate(1,132,START);
+
+        return !detector.isDuplicate(1,131,START) &&
+          detector.isDuplicate(1,132,START);
+      }},
+
+     {"window follows the sequence number across wrap",
+      []()
+      {
+        EMANE::Utils::DuplicateDetector detector{16};
+
+        for(std::uint16_t u16Sequence = 65530; u16Sequence != 6; ++u16Sequence)
+          {
+            if(detector.isDuplicate(1,u16Sequence,START))
+              {
+                return false;
+              }
+          }
+
+        return detector.isDuplicate(1,65533,START) &&
+          detector.isDuplicate(1,0,START) &&
+          detector.isDuplicate(1,5,START) &&
+          !detector.isDuplicate(1,65529,START);
+      }},
+
+     {"sequence half the space ahead slides the window",
+      []()
+      {
+        EMANE::Utils::DuplicateDetector detector{16};
+
+        detector.isDuplicate(1,0,START);
+
+        return !detector.isDuplicate(1,0x8000,START) &&
+          !detector.isDuplicate(1,0,START);
+      }},
+
+     {"entry expires after the validity interval",
+      []()
+      {
+        EMANE::Utils::DuplicateDetector detector{16,std::chrono::seconds{5}};
+
+        detector.isDuplicate(1,1,START);
+
+        // keep the source active
+        for(std::uint16_t i = 1; i <= 6; ++i)
+          {
+            detector.isDuplicate(1,1 + i,START + std::chrono::seconds{i});
+          }
+
+        return !detector.isDuplicate(1,1,START + std::chrono::seconds{6}) &&
+          detector.isDuplicate(1,7,START + std::chrono::seconds{6});
+      }},
+
+     {"silent source is reset after the validity interval",
+      []()
+      {
+        EMANE::Utils::DuplicateDetector detector{16,std::chrono::seconds{5}};
+
+        detector.isDuplicate(1,100,START);
+
+        // older than the previous highest but accepted as a new anchor
+        return !detector.isDuplicate(1,50,START + std::chrono::seconds{6}) &&
+          detector.isDuplicate(1,50,START + std::chrono::seconds{6}) &&
+          !detector.isDuplicate(1,100,START + std::chrono::seconds{6});
+      }},
+
+     {"sources are independent",
+      []()
+      {
+        EMANE::Utils::DuplicateDetector detector{16};
+
+        detector.isDuplicate(1,100,START);
+
+        return !detector.isDuplicate(2,100,START) &&
+          !detector.isDuplicate(65535,100,START) &&
+          detector.isDuplicate(1,100,START) &&
+          detector.isDuplicate(2,100,START);
+      }},
+
+     {"window size change clears all sources",
+      []()
+      {
+        EMANE::Utils::DuplicateDetector detector{16};
+
+        detector.isDuplicate(1,100,START);
+
+        detector.setWindowSize(1024);
+
+        return !detector.isDuplicate(1,100,START) &&
+          !detector.isDuplicate(1,100 - 1000,START) &&
+          detector.isDuplicate(1,100 - 1000,START);
+      }},
+
+     {"window size out of range is rejected",
+      []()
+      {
+        for(std::uint16_t u16WindowSize : {0,32769})
+          {
+            try
+              {
+                EMANE::Utils::DuplicateDetector detector{u16WindowSize};
+
+                return false;
+              }
+            catch(EMANE::ConfigurationException &)
+              {}
+          }
+
+        EMANE::Utils::DuplicateDetector detector{32768};
+
+        detector.isDuplicate(1,0,START);
+
+        return !detector.isDuplicate(1,32767,START) &&
+          detector.isDuplicate(1,0,START);
+      }},
+    };
+
+  int iFailures{};
+
+  for(const auto & check : checks)
+    {
+      bool bPass{check.second()};
+
+      std::cout<<(bPass ? "PASS" : "FAIL")<<" "<<check.first<<std::endl;
+
+      if(!bPass)
+        {
+          ++iFailures;
+        }
+    }
+
+  return iFailures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "eventservice.h"
+#include "multicastsocket.h"
+#include "logservice.h"
+#include "event.pb.h"
+
+#include "emane/serializationexception.h"
+#include "emane/net.h"
+#include "emane/events/locationevent.h"
+#include "emane/utils/parameterconvert.h"
+
+#include <iostream>
+#include <cstdlib>
+#include <atomic>
+#include <thread>
+#include <getopt.h>
+#include <uuid.h>
+
+namespace
+{
+  const EMANE::BuildId buildId{1};
+
+  void usage();
+
+  class CountingEventServiceUser : public EMANE::EventServiceUser
+  {
+  public:
+    std::atomic<std::uint64_t> u64Received_{};
+    std::atomic<EMANE::Clock::rep> lastReceiveTime_{};
+
+    void processEvent(const EMANE::EventId &,
+                      const EMANE::Serialization &) override
+    {
+      received();
+    }
+
+    void processDecodedEvent(const EMANE::EventId &,
+                             const std::shared_ptr<const EMANE::Event> &,
+                             const EMANE::Serialization &) override
+    {
+      received();
+    }
+
+  private:
+    void received()
+    {
+      lastReceiveTime_ = EMANE::Clock::now().time_since_epoch().count();
+      ++u64Received_;
+    }
+  };
+
+  std::string createEventMessage(std::size_t locationCount);
+}
+
+int main(int argc, char * argv[])
+{
+  option options[] =
+    {
+     {"help",0,nullptr,'h'},
+     {"group",1,nullptr,'g'},
+     {"device",1,nullptr,'d'},
+     {"count",1,nullptr,'c'},
+     {"locations",1,nullptr,'l'},
+     {"burst",1,nullptr,'b'},
+     {0, 0,nullptr,0},
+    };
+
+  int iOption{};
+  int iOptionIndex{};
+  std::string sGroup{"224.1.2.8:45703"};
+  std::string sDevice{"lo"};
+  std::uint64_t u64Count{10000};
+  std::uint16_t u16Locations{100};
+  std::uint16_t u16Burst{16};
+
+  while((iOption = getopt_long(argc,argv,"hg:d:c:l:b:", &options[0],&iOptionIndex)) != -1)
+    {
+      switch(iOption)
+        {
+        case 'h':
+          // --help
+          usage();
+          return 0;
+
+        case 'g':
+          // --group
+          sGroup = optarg;
+          break;
+
+        case 'd':
+          // --device
+          sDevice = optarg;
+          break;
+
+        case 'c':
+          // --count
+          u64Count = EMANE::Utils::ParameterConvert{optarg}.toUINT64(1);
+          break;
+
+        case 'l':
+          // --locations
+          u16Locations = EMANE::Utils::ParameterConvert{optarg}.toUINT16(1);
+          break;
+
+        case 'b':
+          // --burst
+          u16Burst = EMANE::Utils::ParameterConvert{optarg}.toUINT16(1);
+          break;
+
+        case ':':
+          // missing arguement
+          std::cerr<<"-"<<static_cast<char>(iOption)<<"requires an argument"<<std::endl;
+          return EXIT_FAILURE;
+
+        default:
+          std::cerr<<"Unknown option: "<<static_cast<char>(iOption)<<std::endl;
+          return EXIT_FAILURE;
+        }
+    }
+
+  try
+    {
+      EMANE::LogService::instance()->setLogLevel(EMANE::ERROR_LEVEL);
+
+      EMANE::INETAddr groupAddress{EMANE::Utils::ParameterConvert{sGroup}.toINETAddr()};
+
+      CountingEventServiceUser user{};
+
+      auto pEventService = EMANE::EventServiceSingleton::instance();
+
+      pEventService->registerEventServiceUser(buildId,&user);
+
+      pEventService->registerEvent(buildId,EMANE::Events::LocationEvent::IDENTIFIER);
+
+      uuid_t uuid;
+      uuid_generate(uuid);
+
+      pEventService->open(groupAddress,sDevice,1,true,uuid);
+
+      EMANE::MulticastSocket socket{groupAddress,true,sDevice,1,true};
+
+      std::string sMessage{createEventMessage(u16Locations)};
+
+      std::uint16_t u16Length = EMANE::HTONS(sMessage.size());
+
+      iovec iov[2] =
+        {{reinterpret_cast<char *>(&u16Length),sizeof(u16Length)},
+         {const_cast<char *>(sMessage.c_str()),sMessage.size()}};
+
+      auto start = EMANE::Clock::now();
+
+      for(std::uint64_t i = 0; i < u64Count; ++i)
+        {
+          if(socket.send(iov,2) == -1)
+            {
+              std::cerr<<"unable to send event message"<<std::endl;
+              return EXIT_FAILURE;
+            }
+
+          // let the receiver drain between bursts to limit socket drops
+          if(!((i + 1) % u16Burst))
+            {
+              std::this_thread::yield();
+            }
+        }
+
+      // wait until all events are received or reception stalls
+      std::uint64_t u64LastReceived{};
+
+      do
+        {
+          u64LastReceived = user.u64Received_;
+
+          std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        }
+      while(user.u64Received_ != u64Count && user.u64Received_ != u64LastReceived);
+
+      if(!user.u64Received_)
+        {
+          std::cerr<<"no events received on "<<sGroup<<" device "<<sDevice<<std::endl;
+          return EXIT_FAILURE;
+        }
+
+      EMANE::TimePoint end{EMANE::Clock::duration{user.lastReceiveTime_}};
+
+      double dElapsedSeconds{std::chrono::duration_cast<EMANE::DoubleSeconds>(end - start).count()};
+
+      std::uint64_t u64Received{user.u64Received_};
+
+      std::cout<<"message bytes: "<<sMessage.size() + sizeof(u16Length)<<std::endl;
+      std::cout<<"sent: "<<u64Count<<std::endl;
+      std::cout<<"received: "<<u64Received<<std::endl;
+      std::cout<<"elapsed seconds: "<<dElapsedSeconds<<std::endl;
+      std::cout<<"received events/second: "<<u64Received / dElapsedSeconds<<std::endl;
+    }
+  catch(EMANE::Exception & exp)
+    {
+      std::cerr<<exp.what()<<std::endl;
+      return EXIT_FAILURE;
+    }
+
+  return EXIT_SUCCESS;
+}
+
+namespace
+{
+  void usage()
+  {
+    std::cout<<"usage: eventchannelspeed [OPTIONS]..."<<std::endl;
+    std::cout<<std::endl;
+    std::cout<<"Sends location events over the event channel to a local event service"<<std::endl;
+    std::cout<<"and reports the event reception rate."<<std::endl;
+    std::cout<<std::endl;
+    std::cout<<"options:"<<std::endl;
+    std::cout<<"  -h, --help                     Print this message and exit."<<std::endl;
+    std::cout<<"  -g, --group ENDPOINT           Event channel multicast endpoint."<<std::endl;
+    std::cout<<"                                   default: 224.1.2.8:45703"<<std::endl;
+    std::cout<<"  -d, --device DEVICE            Event channel multicast device."<<std::endl;
+    std::cout<<"                                   default: lo"<<std::endl;
+    std::cout<<"  -c, --count COUNT              Number of event messages to send."<<std::endl;
+    std::cout<<"                                   default: 10000"<<std::endl;
+    std::cout<<"  -l, --locations COUNT          Number of NEM locations per event."<<std::endl;
+    std::cout<<"                                   default: 100"<<std::endl;
+    std::cout<<"  -b, --burst COUNT              Event messages sent between yields."<<std::endl;
+    std::cout<<"                                   default: 16"<<std::endl;
+    std::cout<<std::endl;
+  }
+
+  std::string createEventMessage(std::size_t locationCount)
+  {
+    EMANE::Events::Locations locations{};
+
+    for(std::size_t i = 1; i <= locationCount; ++i)
+      {
+        locations.emplace_back(static_cast<EMANE::NEMId>(i),
+                               EMANE::Position{40.025495 + i * 0.0001,-74.315441,3.0},
+                               std::make_pair(EMANE::Orientation{0,32,30},true),
+                               std::make_pair(EMANE::Velocity{60,-20,10},true));
+      }
+
+    EMANEMessage::Event msg;
+
+    auto pSerialization = msg.mutable_data()->add_serializations();
+
+    pSerialization->set_nemid(0);
+
+    pSerialization->set_eventid(EMANE::Events::LocationEvent::IDENTIFIER);
+
+    pSerialization->set_data(EMANE::Events::LocationEvent{locations}.serialize());
+
+    // a remote event channel source
+    uuid_t uuid;
+    uuid_generate(uuid);
+
+    msg.set_uuid(reinterpret_cast<const char *>(uuid),sizeof(uuid));
+
+    msg.set_sequencenumber(1);
+
+    std::string sSerialization;
+
+    if(!msg.SerializeToString(&sSerialization))
+      {
+        throw EMANE::SerializationException("unable to serialize event message");
+      }
+
+    return sSerialization;
+  }
+}
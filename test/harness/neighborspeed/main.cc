@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "neighborstatistics.h"
+#include "neighborentry.h"
+#include "msgtypes.h"
+
+#include "emane/utils/loglinearhistogram.h"
+#include "emane/utils/parameterconvert.h"
+#include "emane/exception.h"
+
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include <map>
+#include <random>
+#include <getopt.h>
+
+namespace
+{
+  void usage();
+
+  using NeighborEntryMap = std::map<EMANE::NEMId, EMANE::Models::IEEE80211ABG::NeighborEntry>;
+
+  EMANE::Models::IEEE80211ABG::NbrSet createOneHopNeighbors(EMANE::NEMId id,
+                                                            std::uint16_t u16Neighbors,
+                                                            double dConnectivity,
+                                                            std::mt19937 & generator);
+}
+
+int main(int argc, char * argv[])
+{
+  option options[] =
+    {
+     {"help",0,nullptr,'h'},
+     {"nbrs",1,nullptr,'n'},
+     {"connectivity",1,nullptr,'c'},
+     {"intervals",1,nullptr,'i'},
+     {"queries",1,nullptr,'q'},
+     {"changes",1,nullptr,'t'},
+     {"output",1,nullptr,'o'},
+     {0, 0,nullptr,0},
+    };
+
+  int iOption{};
+  int iOptionIndex{};
+  std::uint16_t u16Neighbors{250};
+  double dConnectivity{1};
+  std::uint32_t u32Intervals{100};
+  std::uint32_t u32Queries{100};
+  std::uint16_t u16Changes{};
+  std::string sOutputFile{};
+
+  try
+    {
+      while((iOption = getopt_long(argc,argv,"hn:c:i:q:t:o:", &options[0],&iOptionIndex)) != -1)
+        {
+          switch(iOption)
+            {
+            case 'h':
+              // --help
+              usage();
+              return 0;
+
+            case 'n':
+              // --nbrs
+              u16Neighbors = EMANE::Utils::ParameterConvert{optarg}.toUINT16(2);
+              break;
+
+            case 'c':
+              // --connectivity
+              dConnectivity = EMANE::Utils::ParameterConvert{optarg}.toDouble(0,1);
+              break;
+
+            case 'i':
+              // --intervals
+              u32Intervals = EMANE::Utils::ParameterConvert{optarg}.toUINT32(1);
+              break;
+
+            case 'q':
+              // --queries
+              u32Queries = EMANE::Utils::ParameterConvert{optarg}.toUINT32();
+              break;
+
+            case 't':
+              // --changes
+              u16Changes = EMANE::Utils::ParameterConvert{optarg}.toUINT16();
+              break;
+
+            case 'o':
+              // --output
+              sOutputFile = optarg;
+              break;
+
+            default:
+              std::cerr<<"unknown option, see --help"<<std::endl;
+              return EXIT_FAILURE;
+            }
+        }
+    }
+  catch(EMANE::Exception & exp)
+    {
+      std::cerr<<exp.what()<<std::endl;
+      return EXIT_FAILURE;
+    }
+
+  std::mt19937 generator{};
+
+  std::uniform_int_distribution<std::uint32_t> durationDistribution{100,3000};
+
+  std::uniform_real_distribution<float> probabilityDistribution{0.0f,1.0f};
+
+  std::uniform_int_distribution<EMANE::NEMId> neighborDistribution{1,u16Neighbors};
+
+  const EMANE::NEMId id{1};
+
+  NeighborEntryMap neighbors{};
+
+  for(EMANE::NEMId nbr = 1; nbr <= u16Neighbors; ++nbr)
+    {
+      neighbors[nbr].setOneHopNeighbors(createOneHopNeighbors(nbr,
+                                                              u16Neighbors,
+                                                              dConnectivity,
+                                                              generator));
+    }
+
+  EMANE::Models::IEEE80211ABG::NeighborStatistics statistics{id};
+
+  // interval and query cost in nanoseconds
+  EMANE::Utils::LogLinearHistogram intervalHistogram{};
+
+  EMANE::Utils::LogLinearHistogram queryHistogram{};
+
+  const EMANE::Microseconds deltaTMicroseconds{100000};
+
+  for(std::uint32_t u32Interval = 0; u32Interval < u32Intervals; ++u32Interval)
+    {
+      // nbrs reporting a new one hop nbr list since the last interval
+      for(std::uint16_t i = 0; i < u16Changes; ++i)
+        {
+          EMANE::NEMId nbr{neighborDistribution(generator)};
+
+          neighbors[nbr].setOneHopNeighbors(createOneHopNeighbors(nbr,
+                                                                  u16Neighbors,
+                                                                  dConnectivity,
+                                                                  generator));
+          statistics.invalidate(nbr);
+        }
+
+      // one data message from each nbr during the interval
+      EMANE::Microseconds totalUtilizationMicroseconds{};
+
+      for(auto & entry : neighbors)
+        {
+          EMANE::Microseconds durationMicroseconds{durationDistribution(generator)};
+
+          entry.second.updateChannelActivity(durationMicroseconds,
+                                             EMANE::Models::IEEE80211ABG::MSG_TYPE_UNICAST_DATA,
+                                             EMANE::Clock::now(),
+                                             probabilityDistribution(generator) * 1e-6f);
+
+          entry.second.storeUtilization();
+
+          totalUtilizationMicroseconds += durationMicroseconds;
+        }
+
+      auto start = EMANE::Clock::now();
+
+      statistics.reset();
+
+      for(auto & entry : neighbors)
+        {
+          statistics.addNeighbor(entry.first,entry.second);
+        }
+
+      statistics.calculate(totalUtilizationMicroseconds / neighbors.size(),deltaTMicroseconds);
+
+      intervalHistogram.record(std::chrono::duration_cast<std::chrono::nanoseconds>(EMANE::Clock::now() - start).count());
+
+      for(std::uint32_t u32Query = 0; u32Query < u32Queries; ++u32Query)
+        {
+          EMANE::NEMId src{neighborDistribution(generator)};
+
+          float fRandom{probabilityDistribution(generator)};
+
+          start = EMANE::Clock::now();
+
+          statistics.getRandomRxPowerCommonNodesMilliWatts(src,fRandom);
+
+          statistics.getRandomRxPowerHiddenNodesMilliWatts(src,fRandom);
+
+          queryHistogram.record(std::chrono::duration_cast<std::chrono::nanoseconds>(EMANE::Clock::now() - start).count());
+        }
+    }
+
+  auto toMicroseconds = [](std::uint64_t u64Nanoseconds)
+                        {
+                          return u64Nanoseconds / 1000.0;
+                        };
+
+  std::cout<<"nbrs: "<<u16Neighbors<<std::endl;
+  std::cout<<"connectivity: "<<dConnectivity<<std::endl;
+  std::cout<<"intervals: "<<u32Intervals<<std::endl;
+  std::cout<<"changes/interval: "<<u16Changes<<std::endl;
+  std::cout<<"interval microseconds p50: "<<toMicroseconds(intervalHistogram.getPercentile(50))
+           <<" p99: "<<toMicroseconds(intervalHistogram.getPercentile(99))
+           <<" max: "<<toMicroseconds(intervalHistogram.getMax())<<std::endl;
+  std::cout<<"query microseconds p50: "<<toMicroseconds(queryHistogram.getPercentile(50))
+           <<" p99: "<<toMicroseconds(queryHistogram.getPercentile(99))
+           <<" max: "<<toMicroseconds(queryHistogram.getMax())<<std::endl;
+
+  if(!sOutputFile.empty())
+    {
+      std::ofstream stream{sOutputFile,std::ios::out | std::ios::app};
+
+      if(stream)
+        {
+          if(!stream.tellp())
+            {
+              stream<<"nbrs,connectivity,changes,p50us,p99us,maxus,queryp50us,queryp99us"<<std::endl;
+            }
+
+          stream<<u16Neighbors<<","
+                <<dConnectivity<<","
+                <<u16Changes<<","
+                <<toMicroseconds(intervalHistogram.getPercentile(50))<<","
+                <<toMicroseconds(intervalHistogram.getPercentile(99))<<","
+                <<toMicroseconds(intervalHistogram.getMax())<<","
+                <<toMicroseconds(queryHistogram.getPercentile(50))<<","
+                <<toMicroseconds(queryHistogram.getPercentile(99))<<std::endl;
+        }
+    }
+
+  return EXIT_SUCCESS;
+}
+
+namespace
+{
+  void usage()
+  {
+    std::cout<<"usage: neighborspeed [OPTIONS]..."<<std::endl;
+    std::cout<<std::endl;
+    std::cout<<"Measures the ieee80211abg per interval one hop neighbor statistics"<<std::endl;
+    std::cout<<"cost and the common and hidden rx power query cost for a number of"<<std::endl;
+    std::cout<<"active one hop neighbors."<<std::endl;
+    std::cout<<std::endl;
+    std::cout<<"options:"<<std::endl;
+    std::cout<<"  -h, --help                     Print this message and exit."<<std::endl;
+    std::cout<<"  -n, --nbrs COUNT               Number of active one hop neighbors."<<std::endl;
+    std::cout<<"                                   default: 250"<<std::endl;
+    std::cout<<"  -c, --connectivity PROBABILITY Probability a neighbor reports another"<<std::endl;
+    std::cout<<"                                   neighbor as a one hop neighbor."<<std::endl;
+    std::cout<<"                                   default: 1"<<std::endl;
+    std::cout<<"  -i, --intervals COUNT          Number of statistic intervals."<<std::endl;
+    std::cout<<"                                   default: 100"<<std::endl;
+    std::cout<<"  -q, --queries COUNT            Rx power queries per interval."<<std::endl;
+    std::cout<<"                                   default: 100"<<std::endl;
+    std::cout<<"  -t, --changes COUNT            One hop neighbor list updates per interval."<<std::endl;
+    std::cout<<"                                   default: 0"<<std::endl;
+    std::cout<<"  -o, --output CSVFILE           Append a summary row to a CSV file."<<std::endl;
+    std::cout<<std::endl;
+  }
+
+  EMANE::Models::IEEE80211ABG::NbrSet createOneHopNeighbors(EMANE::NEMId id,
+                                                            std::uint16_t u16Neighbors,
+                                                            double dConnectivity,
+                                                            std::mt19937 & generator)
+  {
+    std::bernoulli_distribution connectedDistribution{dConnectivity};
+
+    EMANE::Models::IEEE80211ABG::NbrSet nbrs{};
+
+    for(EMANE::NEMId nbr = 1; nbr <= u16Neighbors; ++nbr)
+      {
+        if(nbr != id && connectedDistribution(generator))
+          {
+            nbrs.insert(nbr);
+          }
+      }
+
+    return nbrs;
+  }
+}
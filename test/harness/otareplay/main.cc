@@ -0,0 +1,644 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "otacaptureformat.h"
+#include "frameworkphy.h"
+#include "platformservice.h"
+#include "buildidservice.h"
+#include "configurationservice.h"
+#include "registrarproxy.h"
+#include "eventservice.h"
+#include "statisticservice.h"
+#include "controlmessageserializer.h"
+#include "logservice.h"
+#include "event.pb.h"
+
+#include "emane/upstreamtransport.h"
+#include "emane/commonphyheader.h"
+#include "emane/serializationexception.h"
+#include "emane/controls/otatransmittercontrolmessage.h"
+#include "emane/controls/serializedcontrolmessage.h"
+#include "emane/utils/loglinearhistogram.h"
+#include "emane/utils/parameterconvert.h"
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <getopt.h>
+
+namespace
+{
+  using namespace EMANE::OTACaptureFormat;
+
+  void usage();
+
+  struct Record
+  {
+    RecordType type_;
+    EMANE::TimePoint timestamp_;
+    std::vector<std::uint8_t> data_;
+  };
+
+  // reads the entire capture so file access is not part of the replay
+  std::vector<Record> loadCapture(const std::string & sFile);
+
+  // copies a header with its transmit time moved by offset
+  EMANE::CommonPHYHeader shiftTxTime(const EMANE::CommonPHYHeader & header,
+                                     const EMANE::Duration & offset);
+
+  class Stage
+  {
+  public:
+    Stage(const std::string & sName):
+      sName_{sName},
+      total_{}{}
+
+    void record(const EMANE::Clock::duration & duration)
+    {
+      auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(duration);
+
+      histogram_.record(nanoseconds.count());
+
+      total_ += nanoseconds;
+    }
+
+    void report(std::ostream & stream) const
+    {
+      double dSeconds{std::chrono::duration_cast<EMANE::DoubleSeconds>(total_).count()};
+
+      stream<<std::setiosflags(std::ios::left)
+            <<std::setw(8)<<sName_
+            <<std::resetiosflags(std::ios::left)
+            <<std::setw(12)<<histogram_.getCount()
+            <<std::setw(14)<<std::fixed<<std::setprecision(1)
+            <<(dSeconds > 0 ? histogram_.getCount() / dSeconds : 0)
+            <<std::setw(10)<<histogram_.getPercentile(50)
+            <<std::setw(10)<<histogram_.getPercentile(99)
+            <<std::setw(10)<<histogram_.getPercentile(99.9)
+            <<std::setw(12)<<histogram_.getMax()
+            <<std::endl;
+    }
+
+  private:
+    std::string sName_;
+    EMANE::Utils::LogLinearHistogram histogram_;
+    std::chrono::nanoseconds total_;
+  };
+
+  // stands in for the MAC layer, counting packets passed upstream
+  class CountingUpstreamTransport : public EMANE::UpstreamTransport
+  {
+  public:
+    std::uint64_t u64Packets_{};
+
+    void processUpstreamPacket(EMANE::UpstreamPacket &,
+                               const EMANE::ControlMessages &) override
+    {
+      ++u64Packets_;
+    }
+
+    void processUpstreamControl(const EMANE::ControlMessages &) override
+    {}
+  };
+
+  struct Node
+  {
+    EMANE::NEMId id_;
+    std::unique_ptr<EMANE::SpectrumService> pSpectrumService_;
+    EMANE::FrameworkPHY * pPHY_;
+    CountingUpstreamTransport transport_;
+  };
+
+  EMANE::FrameworkPHY * createPHY(EMANE::NEMId id, EMANE::SpectrumService * pSpectrumService);
+
+  void dumpDropTables(EMANE::BuildId buildId);
+}
+
+int main(int argc, char * argv[])
+{
+  option options[] =
+    {
+     {"help",0,nullptr,'h'},
+     {"nems",1,nullptr,'n'},
+     {"config",1,nullptr,'c'},
+     {"pace",0,nullptr,'p'},
+     {"loop",1,nullptr,'l'},
+     {"drops",0,nullptr,'d'},
+     {0, 0,nullptr,0},
+    };
+
+  int iOption{};
+  int iOptionIndex{};
+  std::vector<EMANE::NEMId> nems{1};
+  EMANE::ConfigurationUpdateRequest request{};
+  bool bPace{};
+  std::uint32_t u32Loops{1};
+  bool bDrops{};
+
+  while((iOption = getopt_long(argc,argv,"hn:c:pl:d", &options[0],&iOptionIndex)) != -1)
+    {
+      switch(iOption)
+        {
+        case 'h':
+          // --help
+          usage();
+          return 0;
+
+        case 'n':
+          // --nems
+          {
+            nems.clear();
+
+            std::stringstream ss{optarg};
+            std::string sId{};
+
+            while(std::getline(ss,sId,','))
+              {
+                nems.push_back(EMANE::Utils::ParameterConvert{sId}.toUINT16(1));
+              }
+          }
+          break;
+
+        case 'c':
+          // --config
+          {
+            std::string sItem{optarg};
+
+            auto pos = sItem.find('=');
+
+            if(pos == std::string::npos)
+              {
+                std::cerr<<"invalid configuration item: "<<sItem<<std::endl;
+                return EXIT_FAILURE;
+              }
+
+            request.push_back({sItem.substr(0,pos),{sItem.substr(pos+1)}});
+          }
+          break;
+
+        case 'p':
+          // --pace
+          bPace = true;
+          break;
+
+        case 'l':
+          // --loop
+          u32Loops = EMANE::Utils::ParameterConvert{optarg}.toUINT32(1);
+          break;
+
+        case 'd':
+          // --drops
+          bDrops = true;
+          break;
+
+        case ':':
+          // missing arguement
+          std::cerr<<"-"<<static_cast<char>(iOption)<<"requires an argument"<<std::endl;
+          return EXIT_FAILURE;
+
+        default:
+          std::cerr<<"Unknown option: "<<static_cast<char>(iOption)<<std::endl;
+          return EXIT_FAILURE;
+        }
+    }
+
+  if(optind != argc - 1)
+    {
+      std::cerr<<"missing capture file"<<std::endl;
+      return EXIT_FAILURE;
+    }
+
+  try
+    {
+      EMANE::LogService::instance()->setLogLevel(EMANE::ERROR_LEVEL);
+
+      auto records = loadCapture(argv[optind]);
+
+      if(records.empty())
+        {
+          std::cerr<<"capture contains no records"<<std::endl;
+          return EXIT_FAILURE;
+        }
+
+      std::vector<std::unique_ptr<Node>> nodes{};
+
+      for(auto id : nems)
+        {
+          std::unique_ptr<Node> pNode{new Node{}};
+
+          pNode->id_ = id;
+
+          pNode->pSpectrumService_.reset(new EMANE::SpectrumService{});
+
+          pNode->pPHY_ = createPHY(id,pNode->pSpectrumService_.get());
+
+          pNode->pPHY_->setUpstreamTransport(&pNode->transport_);
+
+          pNode->pPHY_->configure(EMANE::ConfigurationServiceSingleton::instance()->
+                                  buildUpdates(pNode->pPHY_->getBuildId(),request));
+
+          pNode->pPHY_->start();
+
+          nodes.push_back(std::move(pNode));
+        }
+
+      Stage eventStage{"event"};
+      Stage decodeStage{"decode"};
+      Stage phyStage{"phy"};
+
+      std::uint64_t u64OTARecords{};
+      std::uint64_t u64EventRecords{};
+      std::uint64_t u64Bytes{};
+
+      auto dispatchEvent = [&nodes,&eventStage](EMANE::NEMId nemId,
+                                                EMANE::EventId eventId,
+                                                const EMANE::Serialization & serialization)
+        {
+          for(auto & pNode : nodes)
+            {
+              if(!nemId || nemId == pNode->id_)
+                {
+                  auto begin = EMANE::Clock::now();
+
+                  pNode->pPHY_->processEvent(eventId,serialization);
+
+                  eventStage.record(EMANE::Clock::now() - begin);
+                }
+            }
+        };
+
+      auto captureDuration = records.back().timestamp_ - records.front().timestamp_;
+
+      auto start = EMANE::Clock::now();
+
+      for(std::uint32_t u32Loop = 0; u32Loop < u32Loops; ++u32Loop)
+        {
+          auto loopStart = EMANE::Clock::now();
+
+          // each pass follows the previous one in recorded time so
+          // receptions from different passes do not overlap
+          auto loopOffset = captureDuration * u32Loop;
+
+          for(const auto & record : records)
+            {
+              auto timestamp = record.timestamp_ + loopOffset;
+
+              if(bPace)
+                {
+                  std::this_thread::sleep_until(loopStart + (record.timestamp_ - records.front().timestamp_));
+                }
+
+              u64Bytes += record.data_.size();
+
+              if(record.type_ == RecordType::EVENT)
+                {
+                  auto pEventRecord = reinterpret_cast<const EventRecord *>(record.data_.data());
+
+                  dispatchEvent(pEventRecord->u16NEMId,
+                                pEventRecord->u16EventId,
+                                EMANE::Serialization(reinterpret_cast<const char *>(pEventRecord + 1),
+                                                     record.data_.size() - sizeof(EventRecord)));
+
+                  ++u64EventRecords;
+                }
+              else
+                {
+                  auto pOTARecord = reinterpret_cast<const OTARecord *>(record.data_.data());
+
+                  auto pPayload = reinterpret_cast<const std::uint8_t *>(pOTARecord + 1);
+
+                  if(pOTARecord->u32EventsSize)
+                    {
+                      EMANEMessage::Event::Data data;
+
+                      if(data.ParseFromArray(pPayload,pOTARecord->u32EventsSize))
+                        {
+                          for(const auto & serialization : data.serializations())
+                            {
+                              dispatchEvent(serialization.nemid(),
+                                            serialization.eventid(),
+                                            serialization.data());
+                            }
+                        }
+
+                      pPayload += pOTARecord->u32EventsSize;
+                    }
+
+                  EMANE::Controls::OTATransmitters otaTransmitters{};
+
+                  if(pOTARecord->u32ControlsSize)
+                    {
+                      EMANE::ControlMessages msgs =
+                        EMANE::ControlMessageSerializer::create(pPayload,
+                                                                pOTARecord->u32ControlsSize);
+
+                      for(const auto & pControlMessage : msgs)
+                        {
+                          if(pControlMessage->getId() == EMANE::Controls::SerializedControlMessage::IDENTIFIER)
+                            {
+                              auto pSerializedControlMessage =
+                                static_cast<const EMANE::Controls::SerializedControlMessage *>(pControlMessage);
+
+                              if(pSerializedControlMessage->getSerializedId() ==
+                                 EMANE::Controls::OTATransmitterControlMessage::IDENTIFIER)
+                                {
+                                  std::unique_ptr<EMANE::Controls::OTATransmitterControlMessage>
+                                    pOTATransmitterControlMessage(EMANE::Controls::OTATransmitterControlMessage::
+                                                                  create(pSerializedControlMessage->getSerialization()));
+
+                                  otaTransmitters = pOTATransmitterControlMessage->getOTATransmitters();
+                                }
+                            }
+
+                          delete pControlMessage;
+                        }
+
+                      pPayload += pOTARecord->u32ControlsSize;
+                    }
+
+                  uuid_t remoteUUID;
+                  uuid_copy(remoteUUID,pOTARecord->uuid);
+
+                  EMANE::PacketInfo pktInfo{pOTARecord->u16Source,
+                                            pOTARecord->u16Destination,
+                                            0,
+                                            timestamp,
+                                            remoteUUID};
+
+                  for(auto & pNode : nodes)
+                    {
+                      // a NEM does not receive its own transmission,
+                      // which matters for messages sent between
+                      // NEMs on the capturing platform
+                      if(otaTransmitters.count(pNode->id_) ||
+                         pNode->id_ == pOTARecord->u16Source)
+                        {
+                          continue;
+                        }
+
+                      auto begin = EMANE::Clock::now();
+
+                      EMANE::UpstreamPacket pkt{pktInfo,pPayload,pOTARecord->u32DataSize};
+
+                      try
+                        {
+                          EMANE::CommonPHYHeader decodedPHYHeader{pkt};
+
+                          decodeStage.record(EMANE::Clock::now() - begin);
+
+                          // later passes move the transmit time along
+                          // with the receive time
+                          EMANE::CommonPHYHeader commonPHYHeader{u32Loop ?
+                                                                 shiftTxTime(decodedPHYHeader,loopOffset) :
+                                                                 std::move(decodedPHYHeader)};
+
+                          auto decoded = EMANE::Clock::now();
+
+                          // the receive time is the recorded time so that
+                          // timing checks match the captured conditions
+                          pNode->pPHY_->processUpstreamPacket_i(timestamp,
+                                                                commonPHYHeader,
+                                                                pkt,
+                                                                {});
+
+                          phyStage.record(EMANE::Clock::now() - decoded);
+                        }
+                      catch(EMANE::SerializationException & exp)
+                        {
+                          std::cerr<<"unable to decode common PHY header: "<<exp.what()<<std::endl;
+                        }
+                    }
+
+                  ++u64OTARecords;
+                }
+            }
+        }
+
+      double dElapsedSeconds{std::chrono::duration_cast<EMANE::DoubleSeconds>(EMANE::Clock::now() - start).count()};
+
+      double dCaptureSeconds{std::chrono::duration_cast<EMANE::DoubleSeconds>(captureDuration).count()};
+
+      std::cout<<"nems: "<<nodes.size()<<std::endl;
+      std::cout<<"ota records: "<<u64OTARecords<<std::endl;
+      std::cout<<"event records: "<<u64EventRecords<<std::endl;
+      std::cout<<"capture seconds: "<<dCaptureSeconds * u32Loops<<std::endl;
+      std::cout<<"elapsed seconds: "<<dElapsedSeconds<<std::endl;
+      std::cout<<"records/second: "<<(u64OTARecords + u64EventRecords) / dElapsedSeconds<<std::endl;
+      std::cout<<"bytes/second: "<<u64Bytes / dElapsedSeconds<<std::endl;
+      std::cout<<std::endl;
+
+      std::cout<<std::setiosflags(std::ios::left)
+               <<std::setw(8)<<"stage"
+               <<std::resetiosflags(std::ios::left)
+               <<std::setw(12)<<"count"
+               <<std::setw(14)<<"ops/sec"
+               <<std::setw(10)<<"p50 ns"
+               <<std::setw(10)<<"p99 ns"
+               <<std::setw(10)<<"p99.9 ns"
+               <<std::setw(12)<<"max ns"
+               <<std::endl;
+
+      eventStage.report(std::cout);
+      decodeStage.report(std::cout);
+      phyStage.report(std::cout);
+
+      std::cout<<std::endl;
+
+      for(auto & pNode : nodes)
+        {
+          std::cout<<"nem "<<pNode->id_<<" upstream packets: "<<pNode->transport_.u64Packets_<<std::endl;
+
+          if(bDrops)
+            {
+              dumpDropTables(pNode->pPHY_->getBuildId());
+            }
+
+          pNode->pPHY_->stop();
+        }
+    }
+  catch(EMANE::Exception & exp)
+    {
+      std::cerr<<exp.what()<<std::endl;
+      return EXIT_FAILURE;
+    }
+
+  return EXIT_SUCCESS;
+}
+
+namespace
+{
+  void usage()
+  {
+    std::cout<<"usage: otareplay [OPTIONS]... CAPTUREFILE"<<std::endl;
+    std::cout<<std::endl;
+    std::cout<<"Replays an OTA capture recorded using the otamanagercapturefile platform"<<std::endl;
+    std::cout<<"parameter into in-process PHY instances and reports per stage throughput"<<std::endl;
+    std::cout<<"and latency."<<std::endl;
+    std::cout<<std::endl;
+    std::cout<<"options:"<<std::endl;
+    std::cout<<"  -h, --help                     Print this message and exit."<<std::endl;
+    std::cout<<"  -n, --nems IDS                 Comma separated NEM ids to instantiate."<<std::endl;
+    std::cout<<"                                   default: 1"<<std::endl;
+    std::cout<<"  -c, --config NAME=VALUE        PHY configuration item applied to all NEMs."<<std::endl;
+    std::cout<<"                                   May be specified multiple times."<<std::endl;
+    std::cout<<"  -p, --pace                     Replay at the recorded pace instead of"<<std::endl;
+    std::cout<<"                                   as fast as possible."<<std::endl;
+    std::cout<<"  -l, --loop COUNT               Number of times to replay the capture. Each"<<std::endl;
+    std::cout<<"                                   pass is offset in time by the capture"<<std::endl;
+    std::cout<<"                                   duration."<<std::endl;
+    std::cout<<"                                   default: 1"<<std::endl;
+    std::cout<<"  -d, --drops                    Dump PHY drop tables after the replay."<<std::endl;
+    std::cout<<std::endl;
+  }
+
+  std::vector<Record> loadCapture(const std::string & sFile)
+  {
+    std::ifstream stream{sFile,std::ios::in | std::ios::binary};
+
+    if(!stream)
+      {
+        throw EMANE::makeException<EMANE::SerializationException>("unable to open capture %s",
+                                                                  sFile.c_str());
+      }
+
+    FileHeader fileHeader{};
+
+    if(!stream.read(reinterpret_cast<char *>(&fileHeader),sizeof(fileHeader)) ||
+       fileHeader.u64Magic != MAGIC ||
+       fileHeader.u32Version != FORMAT_VERSION)
+      {
+        throw EMANE::makeException<EMANE::SerializationException>("invalid capture header %s",
+                                                                  sFile.c_str());
+      }
+
+    std::vector<Record> records{};
+
+    RecordHeader recordHeader{};
+
+    while(stream.read(reinterpret_cast<char *>(&recordHeader),sizeof(recordHeader)))
+      {
+        Record record{recordHeader.type,
+                      EMANE::TimePoint{EMANE::Microseconds{recordHeader.u64TimestampMicroseconds}},
+                      std::vector<std::uint8_t>(recordHeader.u32Length)};
+
+        // a truncated trailing record is ignored, the capture may not
+        // have been closed cleanly
+        if(!stream.read(reinterpret_cast<char *>(record.data_.data()),record.data_.size()))
+          {
+            break;
+          }
+
+        if((record.type_ == RecordType::OTA &&
+            record.data_.size() >= sizeof(OTARecord) &&
+            [&record]()
+            {
+              auto pOTARecord = reinterpret_cast<const OTARecord *>(record.data_.data());
+
+              return record.data_.size() == sizeof(OTARecord) +
+                pOTARecord->u32EventsSize +
+                pOTARecord->u32ControlsSize +
+                pOTARecord->u32DataSize;
+            }()) ||
+           (record.type_ == RecordType::EVENT &&
+            record.data_.size() >= sizeof(EventRecord)))
+          {
+            records.push_back(std::move(record));
+          }
+      }
+
+    return records;
+  }
+
+  EMANE::FrameworkPHY * createPHY(EMANE::NEMId id, EMANE::SpectrumService * pSpectrumService)
+  {
+    EMANE::PlatformService * pPlatformService{new EMANE::PlatformService{}};
+
+    EMANE::FrameworkPHY * pPHYLayer{new EMANE::FrameworkPHY{id, pPlatformService,pSpectrumService}};
+
+    EMANE::BuildId buildId{EMANE::BuildIdServiceSingleton::instance()->registerBuildable(pPHYLayer,
+                                                                                         EMANE::COMPONENT_PHYILAYER,
+                                                                                         "")};
+
+    EMANE::ConfigurationServiceSingleton::instance()->registerRunningStateMutable(buildId,
+                                                                                  pPHYLayer);
+
+    pPlatformService->setPlatformServiceUser(buildId,pPHYLayer);
+
+    EMANE::EventServiceSingleton::instance()->registerEventServiceUser(buildId,
+                                                                       pPHYLayer,
+                                                                       id);
+
+    EMANE::RegistrarProxy registrarProxy{buildId};
+
+    pPHYLayer->initialize(registrarProxy);
+
+    return pPHYLayer;
+  }
+
+  EMANE::CommonPHYHeader shiftTxTime(const EMANE::CommonPHYHeader & header,
+                                     const EMANE::Duration & offset)
+  {
+    return EMANE::CommonPHYHeader{header.getRegistrationId(),
+                                  header.getSubId(),
+                                  header.getSequenceNumber(),
+                                  header.getTxTime() + offset,
+                                  header.getFrequencyGroups(),
+                                  header.getTransmitAntennas(),
+                                  header.getTransmitters(),
+                                  header.getOptionalFilterData()};
+  }
+
+  void dumpDropTables(EMANE::BuildId buildId)
+  {
+    auto results =
+      EMANE::StatisticService::instance()->queryTable(buildId,
+                                                      {"UnicastPacketDropTable0",
+                                                       "BroadcastPacketDropTable0"});
+    for(const auto & entry : results)
+      {
+        for(const auto & row : entry.second.second)
+          {
+            for(const auto & any : row)
+              {
+                std::cout<<any.toString()<<" ";
+              }
+
+            std::cout<<std::endl;
+          }
+      }
+  }
+}
@@ -0,0 +1,819 @@
+/*
+ * Copyright (c) 2026 - Adjacent Link LLC, Bridgewater, New Jersey
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ * * Neither the name of Adjacent Link LLC nor the names of its
+ *   contributors may be used to endorse or promote products derived
+ *   from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "eventservice.h"
+#include "statisticservice.h"
+#include "logservice.h"
+#include "tdmascheduleevent.pb.h"
+
+#include "emane/application/nembuilder.h"
+#include "emane/application/libemane.h"
+#include "emane/transport.h"
+#include "emane/upstreampacket.h"
+#include "emane/downstreampacket.h"
+#include "emane/events/locationevent.h"
+#include "emane/events/tdmascheduleevent.h"
+#include "emane/utils/loglinearhistogram.h"
+#include "emane/utils/parameterconvert.h"
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <cstdlib>
+#include <cstring>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <getopt.h>
+#include <uuid.h>
+#include <sys/resource.h>
+
+#ifndef EMANE_PKGDATADIR
+#define EMANE_PKGDATADIR "/usr/share/emane"
+#endif
+
+namespace
+{
+  void usage();
+
+  struct Load
+  {
+    std::uint16_t u16NEMs_;
+    double dRate_;
+    size_t size_;
+    bool bUnicast_;
+    std::atomic<bool> bOffering_;
+    std::mutex mutex_;
+    EMANE::Utils::LogLinearHistogram latency_;
+  };
+
+  /*
+   * Synthetic in-memory transport. Offers a fixed packet rate using
+   * the platform timer service and records the end-to-end latency
+   * of packets delivered upstream using the send time carried in
+   * the payload.
+   */
+  class LoadTransport : public EMANE::Transport
+  {
+  public:
+    LoadTransport(EMANE::NEMId id,
+                  EMANE::PlatformServiceProvider * pPlatformService,
+                  Load & load):
+      Transport{id,pPlatformService},
+      load_(load),
+      data_(std::max(load.size_,sizeof(EMANE::Clock::rep))),
+      u16NextDestination_{id},
+      timerId_{},
+      u64Sent_{},
+      u64Received_{}{}
+
+    void initialize(EMANE::Registrar &) override{}
+
+    void configure(const EMANE::ConfigurationUpdate &) override{}
+
+    void start() override{}
+
+    // all NEMs are running once postStart is called
+    void postStart() override
+    {
+      if(load_.dRate_ > 0)
+        {
+          auto interval =
+            std::chrono::duration_cast<EMANE::Duration>(EMANE::DoubleSeconds{1 / load_.dRate_});
+
+          // stagger the first transmission of each NEM over the interval
+          auto first = EMANE::Clock::now() + interval * id_ / load_.u16NEMs_;
+
+          timerId_ =
+            pPlatformService_->timerService().schedule(std::bind(&LoadTransport::send,this),
+                                                       first,
+                                                       interval);
+        }
+    }
+
+    void stop() override
+    {
+      pPlatformService_->timerService().cancelTimedEvent(timerId_);
+
+      std::lock_guard<std::mutex> m(load_.mutex_);
+
+      load_.latency_.merge(latency_);
+    }
+
+    void destroy() throw() override{}
+
+    void processUpstreamPacket(EMANE::UpstreamPacket & pkt,
+                               const EMANE::ControlMessages &) override
+    {
+      if(pkt.length() >= sizeof(EMANE::Clock::rep))
+        {
+          EMANE::Clock::rep sendTime{};
+
+          memcpy(&sendTime,pkt.get(),sizeof(sendTime));
+
+          auto latency = EMANE::Clock::now() - EMANE::TimePoint{EMANE::Clock::duration{sendTime}};
+
+          latency_.record(std::max(std::chrono::duration_cast<EMANE::Microseconds>(latency).count(),
+                                   EMANE::Microseconds::rep{}));
+        }
+
+      ++u64Received_;
+    }
+
+    void processUpstreamControl(const EMANE::ControlMessages &) override{}
+
+    std::uint64_t getSent() const
+    {
+      return u64Sent_;
+    }
+
+    std::uint64_t getReceived() const
+    {
+      return u64Received_;
+    }
+
+  private:
+    Load & load_;
+    std::vector<std::uint8_t> data_;
+    EMANE::NEMId u16NextDestination_;
+    EMANE::TimerEventId timerId_;
+    std::atomic<std::uint64_t> u64Sent_;
+    std::atomic<std::uint64_t> u64Received_;
+    EMANE::Utils::LogLinearHistogram latency_;
+
+    void send()
+    {
+      if(!load_.bOffering_)
+        {
+          return;
+        }
+
+      EMANE::NEMId destination{EMANE::NEM_BROADCAST_MAC_ADDRESS};
+
+      if(load_.bUnicast_ && load_.u16NEMs_ > 1)
+        {
+          // round robin over all other NEMs
+          do
+            {
+              u16NextDestination_ = u16NextDestination_ % load_.u16NEMs_ + 1;
+            }
+          while(u16NextDestination_ == id_);
+
+          destination = u16NextDestination_;
+        }
+
+      auto now = EMANE::Clock::now();
+
+      auto sendTime = now.time_since_epoch().count();
+
+      memcpy(data_.data(),&sendTime,sizeof(sendTime));
+
+      EMANE::DownstreamPacket pkt{{id_,destination,0,now},data_.data(),data_.size()};
+
+      sendDownstreamPacket(pkt);
+
+      ++u64Sent_;
+    }
+  };
+
+  struct Model
+  {
+    std::string sLibrary_;
+    EMANE::ConfigurationUpdateRequest request_;
+  };
+
+  Model createModel(const std::string & sModel, const std::string & sDataDir);
+
+  std::string createTDMASchedule(std::uint16_t u16NEMs, EMANE::NEMId id);
+
+  std::string createLocations(std::uint16_t u16NEMs, std::mt19937 & generator);
+
+  // overrides or adds configuration items
+  void update(EMANE::ConfigurationUpdateRequest & request,
+              const EMANE::ConfigurationUpdateRequest & updates);
+
+  bool parseItem(const char * pzItem, EMANE::ConfigurationUpdateRequest & request);
+
+  // reports the worst NEM for each stage of a layer's packet latency table
+  void dumpQueueWait(const std::string & sLayer,
+                     const std::vector<EMANE::BuildId> & buildIds);
+
+  double getCPUSeconds();
+}
+
+int main(int argc, char * argv[])
+{
+  option options[] =
+    {
+     {"help",0,nullptr,'h'},
+     {"nems",1,nullptr,'n'},
+     {"model",1,nullptr,'m'},
+     {"rate",1,nullptr,'r'},
+     {"size",1,nullptr,'s'},
+     {"unicast",0,nullptr,'u'},
+     {"duration",1,nullptr,'d'},
+     {"mobility",1,nullptr,'l'},
+     {"shim",1,nullptr,'S'},
+     {"mac",1,nullptr,'M'},
+     {"phy",1,nullptr,'P'},
+     {"platform",1,nullptr,'A'},
+     {"datadir",1,nullptr,'D'},
+     {"output",1,nullptr,'o'},
+     {0, 0,nullptr,0},
+    };
+
+  int iOption{};
+  int iOptionIndex{};
+  std::uint16_t u16NEMs{10};
+  std::string sModel{"rfpipe"};
+  double dRate{100};
+  size_t size{512};
+  bool bUnicast{};
+  double dDuration{10};
+  double dMobilityRate{1};
+  std::string sShim{};
+  EMANE::ConfigurationUpdateRequest macUpdates{};
+  EMANE::ConfigurationUpdateRequest phyUpdates{};
+  EMANE::ConfigurationUpdateRequest platformUpdates{};
+  std::string sDataDir{EMANE_PKGDATADIR};
+  std::string sOutputFile{};
+
+  while((iOption = getopt_long(argc,argv,"hn:m:r:s:ud:l:S:M:P:A:D:o:", &options[0],&iOptionIndex)) != -1)
+    {
+      switch(iOption)
+        {
+        case 'h':
+          // --help
+          usage();
+          return 0;
+
+        case 'n':
+          // --nems
+          u16NEMs = EMANE::Utils::ParameterConvert{optarg}.toUINT16(1,EMANE::NEM_BROADCAST_MAC_ADDRESS - 1);
+          break;
+
+        case 'm':
+          // --model
+          sModel = optarg;
+          break;
+
+        case 'r':
+          // --rate
+          dRate = EMANE::Utils::ParameterConvert{optarg}.toDouble(0);
+          break;
+
+        case 's':
+          // --size
+          size = EMANE::Utils::ParameterConvert{optarg}.toUINT16(sizeof(EMANE::Clock::rep));
+          break;
+
+        case 'u':
+          // --unicast
+          bUnicast = true;
+          break;
+
+        case 'd':
+          // --duration
+          dDuration = EMANE::Utils::ParameterConvert{optarg}.toDouble(0.1);
+          break;
+
+        case 'l':
+          // --mobility
+          dMobilityRate = EMANE::Utils::ParameterConvert{optarg}.toDouble(0);
+          break;
+
+        case 'S':
+          // --shim
+          sShim = optarg;
+          break;
+
+        case 'M':
+          // --mac
+          if(!parseItem(optarg,macUpdates))
+            {
+              return EXIT_FAILURE;
+            }
+          break;
+
+        case 'P':
+          // --phy
+          if(!parseItem(optarg,phyUpdates))
+            {
+              return EXIT_FAILURE;
+            }
+          break;
+
+        case 'A':
+          // --platform
+          if(!parseItem(optarg,platformUpdates))
+            {
+              return EXIT_FAILURE;
+            }
+          break;
+
+        case 'D':
+          // --datadir
+          sDataDir = optarg;
+          break;
+
+        case 'o':
+          // --output
+          sOutputFile = optarg;
+          break;
+
+        case ':':
+          // missing arguement
+          std::cerr<<"-"<<static_cast<char>(iOption)<<"requires an argument"<<std::endl;
+          return EXIT_FAILURE;
+
+        default:
+          std::cerr<<"Unknown option: "<<static_cast<char>(iOption)<<std::endl;
+          return EXIT_FAILURE;
+        }
+    }
+
+  try
+    {
+      EMANE::Application::initialize();
+
+      EMANE::LogService::instance()->setLogLevel(EMANE::ERROR_LEVEL);
+
+      Model model{createModel(sModel,sDataDir)};
+
+      update(model.request_,macUpdates);
+
+      EMANE::ConfigurationUpdateRequest phyRequest{{"fixedantennagain",{"0.0"}},
+                                                   {"fixedantennagainenable",{"on"}},
+                                                   {"frequency",{"2.347G"}},
+                                                   {"propagationmodel",{"freespace"}},
+                                                   {"subid",{"1"}},
+                                                   {"txpower",{"30.0"}}};
+
+      update(phyRequest,phyUpdates);
+
+      // the OTA channel is disabled so all OTA traffic uses the
+      // in-process loopback path
+      EMANE::ConfigurationUpdateRequest platformRequest{{"eventservicegroup",{"224.1.2.8:45703"}},
+                                                        {"eventservicedevice",{"lo"}},
+                                                        {"otamanagerchannelenable",{"off"}},
+                                                        {"controlportendpoint",{"127.0.0.1:47000"}},
+                                                        {"stats.packetlatency.enable",{"on"}}};
+
+      update(platformRequest,platformUpdates);
+
+      Load load{u16NEMs,dRate,size,bUnicast,{true},{},{}};
+
+      EMANE::Application::NEMBuilder nemBuilder{};
+
+      EMANE::Application::NEMs nems{};
+
+      std::vector<LoadTransport *> transports{};
+
+      std::map<std::string,std::vector<EMANE::BuildId>> layerBuildIds{};
+
+      for(EMANE::NEMId id = 1; id <= u16NEMs; ++id)
+        {
+          EMANE::Application::NEMLayers layers{};
+
+          auto transport =
+            nemBuilder.buildTransportLayer_T<LoadTransport>(id,
+                                                            "loadtransport",
+                                                            {},
+                                                            false,
+                                                            load);
+
+          transports.push_back(transport.first);
+
+          layerBuildIds["Transport"].push_back(transport.second->getBuildId());
+
+          layers.push_back(std::move(transport.second));
+
+          if(!sShim.empty())
+            {
+              layers.push_back(nemBuilder.buildShimLayer(id,sShim,{}));
+
+              layerBuildIds["Shim"].push_back(layers.back()->getBuildId());
+            }
+
+          layers.push_back(nemBuilder.buildMACLayer(id,model.sLibrary_,model.request_));
+
+          layerBuildIds["MAC"].push_back(layers.back()->getBuildId());
+
+          layers.push_back(nemBuilder.buildPHYLayer(id,"",phyRequest));
+
+          layerBuildIds["PHY"].push_back(layers.back()->getBuildId());
+
+          nems.push_back(nemBuilder.buildNEM(id,layers,{},false));
+        }
+
+      uuid_t uuid;
+      uuid_generate(uuid);
+
+      auto pNEMManager = nemBuilder.buildNEMManager(uuid,nems,platformRequest);
+
+      std::mt19937 generator{};
+
+      auto pEventService = EMANE::EventServiceSingleton::instance();
+
+      pNEMManager->start();
+
+      // initial positions so that all NEMs are in range before load
+      pEventService->processEventMessage(0,
+                                         EMANE::Events::LocationEvent::IDENTIFIER,
+                                         createLocations(u16NEMs,generator));
+
+      pNEMManager->postStart();
+
+      if(sModel == "tdma")
+        {
+          for(EMANE::NEMId id = 1; id <= u16NEMs; ++id)
+            {
+              pEventService->processEventMessage(id,
+                                                 EMANE::Events::TDMAScheduleEvent::IDENTIFIER,
+                                                 createTDMASchedule(u16NEMs,id));
+            }
+        }
+
+      double dCPUStart{getCPUSeconds()};
+
+      auto start = EMANE::Clock::now();
+
+      auto end = start + std::chrono::duration_cast<EMANE::Duration>(EMANE::DoubleSeconds{dDuration});
+
+      auto mobilityInterval = dMobilityRate > 0 ?
+        std::chrono::duration_cast<EMANE::Duration>(EMANE::DoubleSeconds{1 / dMobilityRate}) :
+        end - start;
+
+      for(auto next = start + mobilityInterval; next < end; next += mobilityInterval)
+        {
+          std::this_thread::sleep_until(next);
+
+          if(dMobilityRate > 0)
+            {
+              pEventService->processEventMessage(0,
+                                                 EMANE::Events::LocationEvent::IDENTIFIER,
+                                                 createLocations(u16NEMs,generator));
+            }
+        }
+
+      std::this_thread::sleep_until(end);
+
+      double dCPUSeconds{getCPUSeconds() - dCPUStart};
+
+      double dElapsedSeconds{std::chrono::duration_cast<EMANE::DoubleSeconds>(EMANE::Clock::now() - start).count()};
+
+      // stop offering load and allow in flight packets to drain
+      load.bOffering_ = false;
+
+      std::this_thread::sleep_for(std::chrono::milliseconds{500});
+
+      pNEMManager->stop();
+
+      std::uint64_t u64Sent{};
+      std::uint64_t u64Received{};
+
+      for(const auto pTransport : transports)
+        {
+          u64Sent += pTransport->getSent();
+          u64Received += pTransport->getReceived();
+        }
+
+      double dCPUPerPacket{u64Sent ? dCPUSeconds * 1000000 / u64Sent : 0};
+
+      std::cout<<"model: "<<sModel<<std::endl;
+      std::cout<<"nems: "<<u16NEMs<<std::endl;
+      std::cout<<"offered packets/second: "<<u16NEMs * dRate<<std::endl;
+      std::cout<<"elapsed seconds: "<<dElapsedSeconds<<std::endl;
+      std::cout<<"sent: "<<u64Sent<<std::endl;
+      std::cout<<"received: "<<u64Received<<std::endl;
+      std::cout<<"sent packets/second: "<<u64Sent / dElapsedSeconds<<std::endl;
+      std::cout<<"received packets/second: "<<u64Received / dElapsedSeconds<<std::endl;
+      std::cout<<"cpu seconds: "<<dCPUSeconds<<std::endl;
+      std::cout<<"cpu microseconds/sent packet: "<<dCPUPerPacket<<std::endl;
+      std::cout<<"end-to-end latency microseconds p50: "<<load.latency_.getPercentile(50)
+               <<" p99: "<<load.latency_.getPercentile(99)
+               <<" p99.9: "<<load.latency_.getPercentile(99.9)
+               <<" max: "<<load.latency_.getMax()<<std::endl;
+      std::cout<<std::endl;
+
+      for(const auto & sLayer : {"Transport","Shim","MAC","PHY"})
+        {
+          auto iter = layerBuildIds.find(sLayer);
+
+          if(iter != layerBuildIds.end())
+            {
+              dumpQueueWait(sLayer,iter->second);
+            }
+        }
+
+      if(!sOutputFile.empty())
+        {
+          std::ofstream stream{sOutputFile,std::ios::out | std::ios::app};
+
+          if(stream)
+            {
+              if(!stream.tellp())
+                {
+                  stream<<"model,nems,offered,sent,received,rxpps,cpuus,p50us,p99us,maxus"<<std::endl;
+                }
+
+              stream<<sModel<<","
+                    <<u16NEMs<<","
+                    <<u16NEMs * dRate<<","
+                    <<u64Sent<<","
+                    <<u64Received<<","
+                    <<u64Received / dElapsedSeconds<<","
+                    <<dCPUPerPacket<<","
+                    <<load.latency_.getPercentile(50)<<","
+                    <<load.latency_.getPercentile(99)<<","
+                    <<load.latency_.getMax()<<std::endl;
+            }
+        }
+
+      pNEMManager->destroy();
+    }
+  catch(EMANE::Exception & exp)
+    {
+      std::cerr<<exp.what()<<std::endl;
+      return EXIT_FAILURE;
+    }
+
+  return EXIT_SUCCESS;
+}
+
+namespace
+{
+  void usage()
+  {
+    std::cout<<"usage: platformspeed [OPTIONS]..."<<std::endl;
+    std::cout<<std::endl;
+    std::cout<<"Builds complete NEM stacks in a single process, offers load using an"<<std::endl;
+    std::cout<<"in-memory transport and reports aggregate throughput, CPU per packet,"<<std::endl;
+    std::cout<<"end-to-end latency and per layer queue wait."<<std::endl;
+    std::cout<<std::endl;
+    std::cout<<"options:"<<std::endl;
+    std::cout<<"  -h, --help                     Print this message and exit."<<std::endl;
+    std::cout<<"  -n, --nems COUNT               Number of NEMs."<<std::endl;
+    std::cout<<"                                   default: 10"<<std::endl;
+    std::cout<<"  -m, --model MODEL              MAC model: rfpipe, ieee80211abg, tdma or"<<std::endl;
+    std::cout<<"                                   bentpipe."<<std::endl;
+    std::cout<<"                                   default: rfpipe"<<std::endl;
+    std::cout<<"  -r, --rate PPS                 Packets per second offered by each NEM."<<std::endl;
+    std::cout<<"                                   default: 100"<<std::endl;
+    std::cout<<"  -s, --size BYTES               Packet size."<<std::endl;
+    std::cout<<"                                   default: 512"<<std::endl;
+    std::cout<<"  -u, --unicast                  Send unicast round robin instead of broadcast."<<std::endl;
+    std::cout<<"  -d, --duration SECONDS         Load duration."<<std::endl;
+    std::cout<<"                                   default: 10"<<std::endl;
+    std::cout<<"  -l, --mobility HZ              Location event rate, 0 to disable."<<std::endl;
+    std::cout<<"                                   default: 1"<<std::endl;
+    std::cout<<"  -S, --shim LIBRARY             Shim layer library to add to each NEM."<<std::endl;
+    std::cout<<"  -M, --mac NAME=VALUE           MAC configuration item."<<std::endl;
+    std::cout<<"  -P, --phy NAME=VALUE           PHY configuration item."<<std::endl;
+    std::cout<<"  -A, --platform NAME=VALUE      Platform configuration item."<<std::endl;
+    std::cout<<"  -D, --datadir DIR              Directory containing installed model files."<<std::endl;
+    std::cout<<"                                   default: "<<EMANE_PKGDATADIR<<std::endl;
+    std::cout<<"  -o, --output CSVFILE           Append a summary row to a CSV file."<<std::endl;
+    std::cout<<std::endl;
+  }
+
+  Model createModel(const std::string & sModel, const std::string & sDataDir)
+  {
+    std::string sXMLDir{"file://" + sDataDir + "/xml/models/mac/"};
+
+    if(sModel == "rfpipe")
+      {
+        return {"rfpipemaclayer",
+                {{"datarate",{"100M"}},
+                 {"pcrcurveuri",{sXMLDir + "rfpipe/rfpipepcr.xml"}}}};
+      }
+    else if(sModel == "ieee80211abg")
+      {
+        return {"ieee80211abgmaclayer",
+                {{"mode",{"1"}},
+                 {"unicastrate",{"12"}},
+                 {"multicastrate",{"12"}},
+                 {"pcrcurveuri",{sXMLDir + "ieee80211abg/ieee80211pcr.xml"}}}};
+      }
+    else if(sModel == "tdma")
+      {
+        return {"tdmaeventschedulerradiomodel",
+                {{"pcrcurveuri",{sXMLDir + "tdmaeventscheduler/tdmabasemodelpcr.xml"}}}};
+      }
+    else if(sModel == "bentpipe")
+      {
+        // a single process mode transponder, the PCR curve must be
+        // specified using --mac pcrcurveuri=URI
+        return {"emane-model-bentpipe",
+                {{"transponder.receive.frequency",{"0:2.347G"}},
+                 {"transponder.receive.bandwidth",{"0:1M"}},
+                 {"transponder.receive.antenna",{"0:0"}},
+                 {"transponder.receive.action",{"0:process"}},
+                 {"transponder.receive.enable",{"0:on"}},
+                 {"transponder.transmit.pcrcurveindex",{"0:0"}},
+                 {"transponder.transmit.frequency",{"0:2.347G"}},
+                 {"transponder.transmit.bandwidth",{"0:1M"}},
+                 {"transponder.transmit.antenna",{"0:0"}},
+                 {"transponder.transmit.ubend.delay",{"0:na"}},
+                 {"transponder.transmit.datarate",{"0:100M"}},
+                 {"transponder.transmit.power",{"0:30"}},
+                 {"transponder.transmit.tosmap",{"0:0-255"}},
+                 {"transponder.transmit.slotperframe",{"0:na"}},
+                 {"transponder.transmit.slotsize",{"0:na"}},
+                 {"transponder.transmit.txslots",{"0:na"}},
+                 {"transponder.transmit.mtu",{"0:65535"}},
+                 {"transponder.transmit.enable",{"0:on"}},
+                 {"antenna.defines",{"0:omni;0.0;0"}}}};
+      }
+
+    throw EMANE::makeException<EMANE::ConfigurationException>("unknown model %s",
+                                                              sModel.c_str());
+  }
+
+  std::string createTDMASchedule(std::uint16_t u16NEMs, EMANE::NEMId id)
+  {
+    // one transmit slot per NEM, receive in all others
+    EMANEMessage::TDMAScheduleEvent event;
+
+    auto pStructure = event.mutable_structure();
+    pStructure->set_slotsperframe(u16NEMs);
+    pStructure->set_framespermultiframe(1);
+    pStructure->set_slotdurationmicroseconds(1000);
+    pStructure->set_slotoverheadmicroseconds(0);
+    pStructure->set_bandwidthhz(1000000);
+
+    event.set_frequencyhz(2347000000);
+    event.set_dataratebps(54000000);
+    event.set_serviceclass(0);
+    event.set_powerdbm(30);
+
+    auto pFrame = event.add_frames();
+    pFrame->set_index(0);
+
+    for(std::uint16_t i = 0; i < u16NEMs; ++i)
+      {
+        auto pSlot = pFrame->add_slots();
+        pSlot->set_index(i);
+
+        if(i + 1 == id)
+          {
+            pSlot->set_type(EMANEMessage::TDMAScheduleEvent::Frame::Slot::SLOT_TX);
+          }
+        else
+          {
+            pSlot->set_type(EMANEMessage::TDMAScheduleEvent::Frame::Slot::SLOT_RX);
+          }
+      }
+
+    std::string sSerialization;
+
+    if(!event.SerializeToString(&sSerialization))
+      {
+        throw EMANE::SerializationException("unable to serialize TDMA schedule");
+      }
+
+    return sSerialization;
+  }
+
+  std::string createLocations(std::uint16_t u16NEMs, std::mt19937 & generator)
+  {
+    // nodes move within a ~1km square
+    std::uniform_real_distribution<double> distribution{-0.005,0.005};
+
+    EMANE::Events::Locations locations{};
+
+    for(EMANE::NEMId id = 1; id <= u16NEMs; ++id)
+      {
+        locations.emplace_back(id,
+                               EMANE::Position{40.0 + distribution(generator),
+                                   -74.0 + distribution(generator),
+                                   3.0},
+                               std::make_pair(EMANE::Orientation{},false),
+                               std::make_pair(EMANE::Velocity{},false));
+      }
+
+    return EMANE::Events::LocationEvent{locations}.serialize();
+  }
+
+  void update(EMANE::ConfigurationUpdateRequest & request,
+              const EMANE::ConfigurationUpdateRequest & updates)
+  {
+    for(const auto & item : updates)
+      {
+        auto iter = std::find_if(request.begin(),
+                                 request.end(),
+                                 [&item](const EMANE::ConfigurationNameStringValues & entry)
+                                 {
+                                   return entry.first == item.first;
+                                 });
+
+        if(iter != request.end())
+          {
+            iter->second = item.second;
+          }
+        else
+          {
+            request.push_back(item);
+          }
+      }
+  }
+
+  bool parseItem(const char * pzItem, EMANE::ConfigurationUpdateRequest & request)
+  {
+    std::string sItem{pzItem};
+
+    auto pos = sItem.find('=');
+
+    if(pos == std::string::npos)
+      {
+        std::cerr<<"invalid configuration item: "<<sItem<<std::endl;
+        return false;
+      }
+
+    request.push_back({sItem.substr(0,pos),{sItem.substr(pos+1)}});
+
+    return true;
+  }
+
+  void dumpQueueWait(const std::string & sLayer,
+                     const std::vector<EMANE::BuildId> & buildIds)
+  {
+    // stage -> count, worst p50, worst p99, worst max
+    std::map<std::string,std::array<std::uint64_t,4>> stages{};
+
+    for(auto buildId : buildIds)
+      {
+        auto results =
+          EMANE::StatisticService::instance()->queryTable(buildId,{"PacketLatencyTable"});
+
+        for(const auto & entry : results)
+          {
+            for(const auto & row : entry.second.second)
+              {
+                auto & stage = stages[row[0].asString()];
+
+                stage[0] += row[1].asUINT64();
+                stage[1] = std::max(stage[1],row[2].asUINT64());
+                stage[2] = std::max(stage[2],row[3].asUINT64());
+                stage[3] = std::max(stage[3],row[5].asUINT64());
+              }
+          }
+      }
+
+    std::cout<<sLayer<<" latency microseconds (worst NEM)"<<std::endl;
+
+    for(const auto & entry : stages)
+      {
+        std::cout<<"  "
+                 <<std::setiosflags(std::ios::left)
+                 <<std::setw(18)<<entry.first
+                 <<std::resetiosflags(std::ios::left)
+                 <<" count: "<<std::setw(10)<<entry.second[0]
+                 <<" p50: "<<std::setw(8)<<entry.second[1]
+                 <<" p99: "<<std::setw(8)<<entry.second[2]
+                 <<" max: "<<std::setw(8)<<entry.second[3]
+                 <<std::endl;
+      }
+  }
+
+  double getCPUSeconds()
+  {
+    rusage usage{};
+
+    getrusage(RUSAGE_SELF,&usage);
+
+    return usage.ru_utime.tv_sec + usage.ru_utime.tv_usec / 1000000.0 +
+      usage.ru_stime.tv_sec + usage.ru_stime.tv_usec / 1000000.0;
+  }
+}